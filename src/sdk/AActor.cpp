@@ -1,4 +1,5 @@
 #include <vector>
+#include <optional>
 #include <utility/String.hpp>
 
 #include "UObjectArray.hpp"
@@ -12,6 +13,8 @@
 #include "FField.hpp"
 #include "FProperty.hpp"
 #include "UGameEngine.hpp"
+#include "ParamFrame.hpp"
+#include "UObjectClassIndex.hpp"
 
 #include "AActor.hpp"
 
@@ -28,37 +31,28 @@ bool AActor::set_actor_location(const glm::vec3& location, bool sweep, bool tele
         return false;
     }
 
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
-    const auto fvector = sdk::ScriptVector::static_struct();
+    static const auto location_offset = ParamFrame::find_offset(func, L"NewLocation");
+    static const auto sweep_offset = ParamFrame::find_offset(func, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(func, L"bTeleport");
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
+    const auto fvector = sdk::ScriptVector::static_struct();
     const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // Need to dynamically allocate the params because of unknown FHitResult size
-    std::vector<uint8_t> params{};
+    // Sized from the function itself, so the unknown FHitResult size doesn't matter
+    ParamFrame params{func};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&location, (uint8_t*)&location + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> loc = location;
-        params.insert(params.end(), (uint8_t*)&loc, (uint8_t*)&loc + sizeof(glm::vec<3, double>));
+    if (!params) {
+        return false;
     }
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&sweep, (uint8_t*)&sweep + sizeof(bool));
-    // align    
-    params.insert(params.end(), 3, 0);
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
-    // add a bool
-    bool ret = false;
-    void* ret_ptr = &ret;
-    params.insert(params.end(), (uint8_t*)&ret_ptr, (uint8_t*)&ret_ptr + sizeof(void*));
+
+    params.set_vector(location_offset, location, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(func, params.data());
 
-    return ret;
+    return params.get<bool>(ret_offset);
 }
 
 glm::vec3 AActor::get_actor_location() {
@@ -68,27 +62,22 @@ glm::vec3 AActor::get_actor_location() {
         return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
-    const auto fvector = sdk::ScriptVector::static_struct();
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
+    const auto fvector = sdk::ScriptVector::static_struct();
     const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    std::vector<uint8_t> params{};
+    ParamFrame params{func};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), sizeof(glm::vec3), 0);
-    } else {
-        params.insert(params.end(), sizeof(glm::vec<3, double>), 0);
+    if (!params) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
     this->process_event(func, params.data());
 
-    if (!is_ue5) {
-        return *(glm::vec3*)params.data();
-    }
-        
-    return *(glm::vec<3, double>*)params.data();
+    return params.get_vector(ret_offset, is_ue5);
 }
+
 bool AActor::set_actor_rotation(const glm::vec3& rotation, bool teleport) {
     static const auto func = static_class()->find_function(L"K2_SetActorRotation");
 
@@ -96,35 +85,26 @@ bool AActor::set_actor_rotation(const glm::vec3& rotation, bool teleport) {
         return false;
     }
 
-    const auto frotator = sdk::ScriptRotator::static_struct();
+    static const auto rotation_offset = ParamFrame::find_offset(func, L"NewRotation");
+    static const auto teleport_offset = ParamFrame::find_offset(func, L"bTeleportPhysics");
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
+    const auto frotator = sdk::ScriptRotator::static_struct();
     const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // Need to dynamically allocate the params because of unknown FRotator size
-    std::vector<uint8_t> params{};
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&rotation, (uint8_t*)&rotation + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> rot = rotation;
-        params.insert(params.end(), (uint8_t*)&rot, (uint8_t*)&rot + sizeof(glm::vec<3, double>));
-    }
-
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    ParamFrame params{func};
 
-    // align
-    //params.insert(params.end(), 3, 0);
+    if (!params) {
+        return false;
+    }
 
-    // add a bool
-    bool ret = false;
-    void* ret_ptr = &ret;
-    params.insert(params.end(), (uint8_t*)&ret_ptr, (uint8_t*)&ret_ptr + sizeof(void*));
+    params.set_vector(rotation_offset, rotation, is_ue5);
+    params.set(teleport_offset, teleport);
 
     this->process_event(func, params.data());
 
-    return ret;
-};
+    return params.get<bool>(ret_offset);
+}
 
 glm::vec3 AActor::get_actor_rotation() {
     static const auto func = static_class()->find_function(L"K2_GetActorRotation");
@@ -133,29 +113,65 @@ glm::vec3 AActor::get_actor_rotation() {
         return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
-    const auto frotator = sdk::ScriptRotator::static_struct();
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
+    const auto frotator = sdk::ScriptRotator::static_struct();
     const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    std::vector<uint8_t> params{};
+    ParamFrame params{func};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), sizeof(glm::vec3), 0);
-    } else {
-        params.insert(params.end(), sizeof(glm::vec<3, double>), 0);
+    if (!params) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
     this->process_event(func, params.data());
 
-    if (!is_ue5) {
-        return *(glm::vec3*)params.data();
+    return params.get_vector(ret_offset, is_ue5);
+}
+
+namespace detail {
+// Straight from the class index instead of a ProcessEvent on the game thread. The engine sets a component's
+// owner from the first actor in its outer chain, so that's what gets matched here.
+// std::nullopt if the index isn't there
+std::optional<std::vector<UActorComponent*>> find_owned_components(AActor* actor, UClass* uclass, bool first_only) {
+    const auto index = UObjectClassIndex::get();
+    const auto actor_t = AActor::static_class();
+
+    if (index == nullptr || actor_t == nullptr || uclass == nullptr) {
+        return std::nullopt;
     }
 
-    return *(glm::vec<3, double>*)params.data();
+    std::vector<UActorComponent*> result{};
+
+    for (const auto object : index->find_instances(uclass)) try {
+        auto outer = object->get_outer();
+
+        while (outer != nullptr && !outer->is_a(actor_t)) {
+            outer = outer->get_outer();
+        }
+
+        if (outer != (UObject*)actor) {
+            continue;
+        }
+
+        result.push_back((UActorComponent*)object);
+
+        if (first_only) {
+            break;
+        }
+    } catch(...) {
+        continue;
+    }
+
+    return result;
+}
 }
 
 USceneComponent* AActor::get_component_by_class(UClass* uclass) {
+    if (const auto components = detail::find_owned_components(this, uclass, true); components.has_value()) {
+        return !components->empty() ? (USceneComponent*)components->front() : nullptr;
+    }
+
     static const auto func = AActor::static_class()->find_function(L"GetComponentByClass");
 
     if (func == nullptr) {
@@ -360,7 +376,13 @@ void AActor::finish_add_component_ex(sdk::UObject* new_comp) {
     ((sdk::UActorComponent*)new_comp)->register_component_with_world(this->get_world());
 }
 
-std::vector<UActorComponent*> AActor::get_components_by_class(UClass* uclass) {
+TArray<UActorComponent*> AActor::get_components_by_class(UClass* uclass) {
+    if (const auto components = detail::find_owned_components(this, uclass, false); components.has_value()) {
+        TArray<UActorComponent*> result{};
+        result.append(*components);
+        return result;
+    }
+
     static const auto func_candidate_1 = AActor::static_class()->find_function(L"K2_GetComponentsByClass");
     static const auto func_candidate_2 = AActor::static_class()->find_function(L"GetComponentsByClass");
 
@@ -380,18 +402,11 @@ std::vector<UActorComponent*> AActor::get_components_by_class(UClass* uclass) {
 
     this->process_event(func, &params);
 
-    std::vector<UActorComponent*> ret{};
-
-    if (params.ReturnValue.data != nullptr) {
-        for (int i = 0; i < params.ReturnValue.count; ++i) {
-            ret.push_back(params.ReturnValue.data[i]);
-        }
-    }
-
-    return ret;
+    // The engine allocated it with FMalloc, just take ownership of it instead of copying
+    return std::move(params.ReturnValue);
 }
 
-std::vector<UActorComponent*> AActor::get_all_components() {
+TArray<UActorComponent*> AActor::get_all_components() {
     static const auto actor_component_t = sdk::find_uobject<sdk::UClass>(L"Class /Script/Engine.ActorComponent");
 
     if (actor_component_t == nullptr) {
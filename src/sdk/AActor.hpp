@@ -27,6 +27,9 @@ public:
     bool set_actor_rotation(const glm::vec3& rotation, bool teleport);
     glm::vec3 get_actor_rotation();
 
+    // The component queries go through UObjectClassIndex when it's available (ProcessEvent otherwise),
+    // so they work off the game thread but a component added in the last UObjectClassIndex::REFRESH_INTERVAL can be missing.
+    // With more than one match get_component_by_class returns the first one in GUObjectArray order
     USceneComponent* get_component_by_class(UClass* uclass);
     UCameraComponent* get_camera_component();
 
@@ -35,8 +38,8 @@ public:
     void finish_add_component(sdk::UObject* component);
     void finish_add_component_ex(sdk::UObject* component);
 
-    std::vector<UActorComponent*> get_components_by_class(UClass* uclass);
-    std::vector<UActorComponent*> get_all_components();
+    TArray<UActorComponent*> get_components_by_class(UClass* uclass);
+    TArray<UActorComponent*> get_all_components();
 
     void destroy_component(UActorComponent* component);
     void destroy_actor();
@@ -4,6 +4,10 @@
 #include <utility/Scan.hpp>
 #include <utility/Module.hpp>
 
+#include "EngineModule.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "Memory.hpp"
 #include "UObjectArray.hpp"
 
 #include "AHUD.hpp"
@@ -36,11 +40,28 @@ std::optional<size_t> AHUD::get_post_render_index() {
 
         const auto vtable = *(void***)default_object;
 
-        if (vtable == nullptr || IsBadReadPtr(vtable, sizeof(void*) * 100)) {
+        if (vtable == nullptr || !memory::is_readable(vtable, sizeof(void*) * 100)) {
             SPDLOG_ERROR("[AHUD] Failed to find valid HUD vtable");
             return std::nullopt;
         }
 
+        auto& cache = DiscoveryCache::get();
+        const auto engine = sdk::get_ue_module(L"Engine");
+
+        // Checking the one function is a lot cheaper than sizing the vtable and walking it
+        if (const auto cached = cache.get_value("AHUD::PostRenderIndex", engine); cached.has_value() && *cached > 100 && *cached < 300) try {
+            const auto fn = vtable[*cached];
+
+            if (fn != nullptr && memory::is_readable(fn, sizeof(void*)) && utility::find_string_reference_in_path((uintptr_t)fn, L"nullrhi", true)) {
+                SPDLOG_INFO("[AHUD] Using cached post render index: {}", *cached);
+                return (size_t)*cached;
+            }
+
+            cache.invalidate("AHUD::PostRenderIndex");
+        } catch(...) {
+            cache.invalidate("AHUD::PostRenderIndex");
+        }
+
         // It starts pretty high up
         // Try to locate the last index first
         const auto mod_vtable_within = utility::get_module_within((uintptr_t)vtable).value_or(nullptr);
@@ -49,7 +70,7 @@ std::optional<size_t> AHUD::get_post_render_index() {
             const auto& fn = vtable[i];
 
             // Reached the end
-            if (fn == nullptr || IsBadReadPtr(fn, sizeof(void*))) {
+            if (fn == nullptr || !memory::is_readable(fn, sizeof(void*))) {
                 vtable_size = i;
                 break;
             }
@@ -62,7 +83,7 @@ std::optional<size_t> AHUD::get_post_render_index() {
             const auto& fn = vtable[i];
 
             // Reached the end
-            if (fn == nullptr || IsBadReadPtr(fn, sizeof(void*))) {
+            if (fn == nullptr || !memory::is_readable(fn, sizeof(void*))) {
                 vtable_size = i;
                 break;
             }
@@ -70,7 +91,7 @@ std::optional<size_t> AHUD::get_post_render_index() {
             const auto mod_fn_within = utility::get_module_within((uintptr_t)fn).value_or(nullptr);
 
             if (mod_fn_within != nullptr && mod_fn_within == mod_vtable_within) {
-                if (utility::scan_displacement_reference(mod_vtable_within, (uintptr_t)&fn)) {
+                if (sdk::XrefIndex::get(mod_vtable_within).find((uintptr_t)&fn)) {
                     vtable_size = i;
                     break;
                 }
@@ -83,12 +104,13 @@ std::optional<size_t> AHUD::get_post_render_index() {
             const auto& fn = vtable[i];
 
             // Reached the end
-            if (fn == nullptr || IsBadReadPtr(fn, sizeof(void*))) {
+            if (fn == nullptr || !memory::is_readable(fn, sizeof(void*))) {
                 break;
             }
 
             if (utility::find_string_reference_in_path((uintptr_t)fn, L"nullrhi", true)) {
                 SPDLOG_INFO("[AHUD] Found post render index: {}", i);
+                cache.set_value("AHUD::PostRenderIndex", i, engine);
                 return i;
             }
         } catch (...) {
@@ -5,6 +5,8 @@
 #include "ScriptVector.hpp"
 #include "ScriptRotator.hpp"
 #include "FProperty.hpp"
+#include "UFunction.hpp"
+#include "ParamFrame.hpp"
 
 #include "APlayerController.hpp"
 
@@ -15,42 +17,48 @@ UClass* AController::static_class() {
 
 void AController::set_control_rotation(const glm::vec3& newrotation) {
     static const auto func = static_class()->find_function(L"SetControlRotation");
-    const auto frotator = sdk::ScriptRotator::static_struct();
 
+    if (func == nullptr) {
+        return;
+    }
+
+    static const auto rotation_offset = ParamFrame::find_offset(func, L"NewRotation");
+
+    const auto frotator = sdk::ScriptRotator::static_struct();
     const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // Need to dynamically allocate the params because of unknown FRotator size
-    std::vector<uint8_t> params{};
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&newrotation, (uint8_t*)&newrotation + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> rot = newrotation;
-        params.insert(params.end(), (uint8_t*)&rot, (uint8_t*)&rot + sizeof(glm::vec<3, double>));
+    ParamFrame params{func};
+
+    if (!params) {
+        return;
     }
 
+    params.set_vector(rotation_offset, newrotation, is_ue5);
+
     this->process_event(func, params.data());
 }
 
 glm::vec3 AController::get_control_rotation() {
     static const auto func = static_class()->find_function(L"GetControlRotation");
-    const auto frotator = sdk::ScriptVector::static_struct();
 
+    if (func == nullptr) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
+    }
+
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
+
+    const auto frotator = sdk::ScriptRotator::static_struct();
     const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
-    std::vector<uint8_t> params{};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), sizeof(glm::vec3), 0);
-    } else {
-        params.insert(params.end(), sizeof(glm::vec<3, double>), 0);
+    ParamFrame params{func};
+
+    if (!params) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
     }
+
     this->process_event(func, params.data());
 
-    if (!is_ue5) {
-        return *(glm::vec3*)params.data();
-    }
-    return *(glm::vec<3, double>*)params.data();
+    return params.get_vector(ret_offset, is_ue5);
 }
 
 bool AController::is_local_player_controller() {
@@ -1,4 +1,5 @@
 #include <array>
+#include <mutex>
 #include <string_view>
 
 #include <spdlog/spdlog.h>
@@ -11,6 +12,10 @@
 
 #include "threading/GameThreadWorker.hpp"
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "Memory.hpp"
 #include "Utility.hpp"
 
 #include "CVar.hpp"
@@ -20,19 +25,16 @@ namespace sdk {
 std::optional<uintptr_t> find_alternate_cvar_ref(std::wstring_view str, uint32_t known_default, HMODULE module) {
     SPDLOG_INFO("Performing alternate scan for cvar \"{}\"", utility::narrow(str));
 
-    const auto str_data = utility::scan_string(module, str.data());
+    const auto str_data = sdk::ModuleStrings::get(module).find(str);
 
     if (!str_data) {
         SPDLOG_ERROR("Failed to find string for cvar \"{}\"", utility::narrow(str.data()));
         return std::nullopt;
     }
 
-    const auto module_base = (uintptr_t)module;
-    const auto module_size = utility::get_module_size(module);
-    auto str_ref = utility::scan_displacement_reference(module, *str_data);
     std::optional<uintptr_t> result{};
 
-    while (str_ref) {
+    for (const auto str_ref : sdk::XrefIndex::get(module).find_all(*str_data)) {
         // This is a last resort so maybe come up with something more robust later...
         std::array<uint8_t, 6+8> mov_r8d_mov_rsp { 
             0x41, 0xB8, 0x00, 0x00, 0x00, 0x00,
@@ -47,15 +49,12 @@ std::optional<uintptr_t> find_alternate_cvar_ref(std::wstring_view str, uint32_t
         mov     r8d, 4
         mov     [rsp+20h], 4
         */
-        result = utility::scan_data_reverse(*str_ref, 50, mov_r8d_mov_rsp.data(), mov_r8d_mov_rsp.size());
+        result = utility::scan_data_reverse(str_ref, 50, mov_r8d_mov_rsp.data(), mov_r8d_mov_rsp.size());
 
         if (result) {
             SPDLOG_INFO("Found alternate cvar reference at {:x}", *result);
             break;
         }
-
-        const auto delta = *module_size - ((*str_ref + 1) - module_base);
-        str_ref = utility::scan_displacement_reference(*str_ref + 1, delta, *str_data);
     }
 
     if (!result) {
@@ -258,7 +257,7 @@ std::optional<uintptr_t> resolve_cvar_from_address(uintptr_t start, std::wstring
 }
 
 std::optional<uintptr_t> find_cvar_by_description(std::wstring_view str, std::wstring_view cvar_name, uint32_t known_default, HMODULE module, bool stop_at_first_mov) {
-    auto str_data = utility::scan_string(module, str.data());
+    auto str_data = sdk::ModuleStrings::get(module).find(str);
 
     std::optional<uintptr_t> str_ref{};
 
@@ -274,7 +273,7 @@ std::optional<uintptr_t> find_cvar_by_description(std::wstring_view str, std::ws
 
     // This scans for the cvar description string ref.
     if (!str_ref) {
-        str_ref = utility::scan_displacement_reference(module, *str_data);
+        str_ref = sdk::XrefIndex::get(module).find(*str_data);
 
         if (!str_ref) {
             SPDLOG_ERROR("Failed to find reference to string for {}", utility::narrow(str.data()));
@@ -291,14 +290,14 @@ std::optional<ConsoleVariableDataWrapper> find_cvar_data(std::wstring_view modul
     SPDLOG_INFO("Attempting to locate {} {} cvar", utility::narrow(module_name.data()), utility::narrow(name.data()));
 
     const auto module = sdk::get_ue_module(module_name.data());
-    const auto str = utility::scan_string(module, name.data());
+    const auto str = sdk::ModuleStrings::get(module).find(name);
 
     if (!str) {
         SPDLOG_ERROR("Failed to find {} string!", utility::narrow(name.data()));
         return std::nullopt;
     }
 
-    const auto str_ref = utility::scan_displacement_reference(module, *str);
+    const auto str_ref = sdk::XrefIndex::get(module).find(*str);
 
     if (!str_ref) {
         SPDLOG_ERROR("Failed to find {} string reference!");
@@ -344,14 +343,14 @@ IConsoleVariable** find_cvar(std::wstring_view module_name, std::wstring_view na
 
     }
 
-    const auto str = utility::scan_string(module, name.data());
+    const auto str = sdk::ModuleStrings::get(module).find(name);
 
     if (!str) {
         SPDLOG_ERROR("Failed to find {} string!", utility::narrow(name.data()));
         return nullptr;
     }
 
-    const auto str_ref = utility::scan_displacement_reference(module, *str);
+    const auto str_ref = sdk::XrefIndex::get(module).find(*str);
 
     if (!str_ref) {
         SPDLOG_ERROR("Failed to find {} string reference!", utility::narrow(name.data()));
@@ -370,6 +369,10 @@ IConsoleVariable** find_cvar(std::wstring_view module_name, std::wstring_view na
 
 std::optional<ConsoleVariableDataWrapper> find_cvar_data_cached(std::wstring_view module_name, std::wstring_view name, bool stop_at_first_mov) {
     static std::unordered_map<std::wstring, uintptr_t> cache{};
+    static std::mutex mutex{};
+
+    // Whole lookup under the lock, two threads scanning for the same cvar is just wasted time
+    std::scoped_lock _{mutex};
 
     // The module name is irrelevant here, what are the chances that two modules have the same cvar name?
     if (auto it = cache.find(name.data()); it != cache.end()) {
@@ -380,10 +383,22 @@ std::optional<ConsoleVariableDataWrapper> find_cvar_data_cached(std::wstring_vie
         return cache[name.data()];
     }
 
+    // Survives restarts as long as the module doesn't change
+    auto& discovery_cache = DiscoveryCache::get();
+    const auto key = "CVarData::" + utility::narrow(name.data());
+
+    if (const auto cached = discovery_cache.get_address(key); cached.has_value() && memory::is_readable((void*)*cached, sizeof(void*))) {
+        SPDLOG_INFO("Using cached {} cvar data at {:x}", utility::narrow(name.data()), *cached);
+
+        cache[name.data()] = *cached;
+        return ConsoleVariableDataWrapper{*cached, name.data()};
+    }
+
     const auto result = find_cvar_data(module_name, name, stop_at_first_mov);
 
     if (result) {
         cache[name.data()] = (uintptr_t)result->address();
+        discovery_cache.set_address(key, (uintptr_t)result->address());
     } else {
         cache[name.data()] = 0;
     }
@@ -393,16 +408,39 @@ std::optional<ConsoleVariableDataWrapper> find_cvar_data_cached(std::wstring_vie
 
 IConsoleVariable** find_cvar_cached(std::wstring_view module_name, std::wstring_view name, bool stop_at_first_mov) {
     static std::unordered_map<std::wstring, IConsoleVariable**> cache{};
+    static std::mutex mutex{};
+
+    std::scoped_lock _{mutex};
 
     // The module name is irrelevant here, what are the chances that two modules have the same cvar name?
     if (auto it = cache.find(name.data()); it != cache.end()) {
         return it->second;
     }
 
+    auto& discovery_cache = DiscoveryCache::get();
+    const auto key = "CVar::" + utility::narrow(name.data());
+
+    if (const auto cached = discovery_cache.get_address(key); cached.has_value()) try {
+        const auto cvar = *(IConsoleVariable**)*cached;
+
+        // Should still be pointing at a registered cvar
+        if (cvar != nullptr && memory::is_readable(cvar, sizeof(void*)) && memory::is_readable(*(void**)cvar, sizeof(void*))) {
+            SPDLOG_INFO("Using cached {} cvar at {:x}", utility::narrow(name.data()), *cached);
+
+            cache[name.data()] = (IConsoleVariable**)*cached;
+            return (IConsoleVariable**)*cached;
+        }
+    } catch(...) {
+    }
+
     const auto result = find_cvar(module_name, name, stop_at_first_mov);
 
     cache[name.data()] = result;
 
+    if (result != nullptr) {
+        discovery_cache.set_address(key, (uintptr_t)result);
+    }
+
     return result;
 }
 
@@ -579,26 +617,21 @@ std::optional<uintptr_t> vr::get_slate_draw_to_vr_render_target_usage_location()
         }
 
         const auto module = sdk::get_ue_module(L"SlateRHIRenderer");
-        const auto module_size = utility::get_module_size(module).value_or(0);
-        const auto module_end = (uintptr_t)module + module_size;
 
         for (int32_t i=-1; i < 2; ++i) {
             const auto cvar_addr = (uintptr_t)cvar->address() + (i * sizeof(void*));
 
-            for (auto ref = utility::scan_displacement_reference(module, cvar_addr); 
-                ref; 
-                ref = utility::scan_displacement_reference(*ref + 4, (module_end - (*ref + 4)), cvar_addr)) 
-            {
-                SPDLOG_INFO("Checking if Slate.DrawToVRRenderTarget is used at {:x}", *ref);
+            for (const auto ref : sdk::XrefIndex::get(module).find_all(cvar_addr)) {
+                SPDLOG_INFO("Checking if Slate.DrawToVRRenderTarget is used at {:x}", ref);
 
-                const auto resolved = utility::resolve_instruction(*ref);
+                const auto resolved = utility::resolve_instruction(ref);
                 if (!resolved) {
-                    SPDLOG_ERROR("Failed to resolve instruction at {:x}", *ref);
+                    SPDLOG_ERROR("Failed to resolve instruction at {:x}", ref);
                     continue;
                 }
 
                 if (resolved->instrux.Operands[0].Type == ND_OP_MEM && resolved->instrux.Operands[1].Type == ND_OP_REG) {
-                    SPDLOG_INFO("Instruction at {:x} is not a usage of Slate.DrawToVRRenderTarget", *ref);
+                    SPDLOG_INFO("Instruction at {:x} is not a usage of Slate.DrawToVRRenderTarget", ref);
                     continue; // this is NOT what we want
                 }
 
@@ -812,7 +845,7 @@ std::optional<IConsoleObject::VtableInfo> IConsoleObject::locate_vtable_indices(
     for (auto i = 0; i < 20; ++i) {
         const auto func = vtable[i];
 
-        if (func == 0 || IsBadReadPtr((void*)func, 1)) {
+        if (func == 0 || !memory::is_readable((void*)func, 1)) {
             SPDLOG_ERROR("Reached end of IConsoleObject vtable at index {}", i);
             break;
         }
@@ -857,7 +890,7 @@ std::optional<IConsoleObject::VtableInfo> IConsoleObject::locate_vtable_indices(
 
                     const auto ip = emu.ctx->Registers.RegRip;
 
-                    if (ip == 0 || IsBadReadPtr((void*)emu.ctx->Registers.RegRip, 4)) {
+                    if (ip == 0 || !memory::is_readable((void*)emu.ctx->Registers.RegRip, 4)) {
                         break;
                     }
 
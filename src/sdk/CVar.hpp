@@ -13,6 +13,7 @@
 
 #include "threading/GameThreadWorker.hpp"
 #include "ConsoleManager.hpp"
+#include "Memory.hpp"
 #include "TArray.hpp"
 
 namespace sdk {
@@ -28,7 +29,7 @@ struct TConsoleVariableData {
             if (!s_valid_states.contains(this)) {
                 // What we're doing here is double checking that this cvar "data" does not actually point to a vtable or something
                 // because if it does, we will unintentionally corrupt the memory
-                const auto is_not_vtable = IsBadReadPtr(*(void**)this, sizeof(void*)) == TRUE;
+                const auto is_not_vtable = !memory::is_readable(*(void**)this, sizeof(void*));
                 s_valid_states[this] = is_not_vtable
                                         || (*(uint32_t*)this <= 8 && *(uint32_t*)((uintptr_t)this + 4) <= 8);
 
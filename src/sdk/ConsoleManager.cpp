@@ -6,6 +6,10 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "Memory.hpp"
 
 #include "ConsoleManager.hpp"
 
@@ -17,14 +21,14 @@ sdk::FConsoleManager** try_find_console_manager(const std::wstring& string_candi
     const auto now = std::chrono::steady_clock::now();
 
     const auto core_module = sdk::get_ue_module(L"Core");
-    const auto candidate_string = utility::scan_string(core_module, string_candidate.c_str());
+    const auto candidate_string = sdk::ModuleStrings::get(core_module).find(string_candidate);
 
     if (!candidate_string) {
         SPDLOG_ERROR("Failed to find {} string", utility::narrow(string_candidate));
         return nullptr;
     }
 
-    const auto candidate_stringref = utility::scan_displacement_reference(core_module, *candidate_string);
+    const auto candidate_stringref = sdk::XrefIndex::get(core_module).find(*candidate_string);
 
     if (!candidate_stringref) {
         SPDLOG_ERROR("Failed to find {} stringref", utility::narrow(string_candidate));
@@ -59,7 +63,7 @@ sdk::FConsoleManager** try_find_console_manager(const std::wstring& string_candi
         }
 
         // hinges on IConsoleManager actually being constructed and assigned
-        if (!IsBadReadPtr((void*)*displacement, sizeof(void*)) && !IsBadReadPtr(*(void**)*displacement, sizeof(void*))) {
+        if (sdk::memory::is_readable((void*)*displacement, sizeof(void*)) && sdk::memory::is_readable(*(void**)*displacement, sizeof(void*))) {
             global_variable_references[*displacement]++;
 
             if (!highest_global_variable_reference || global_variable_references[*displacement] > std::get<1>(*highest_global_variable_reference)) {
@@ -96,6 +100,18 @@ FConsoleManager* FConsoleManager::get() {
             L"Current detail mode;",
         };
 
+        auto& cache = sdk::DiscoveryCache::get();
+
+        if (const auto cached = cache.get_address("FConsoleManager::GConsoleManager"); cached.has_value()) try {
+            const auto manager = *(sdk::FConsoleManager**)*cached;
+
+            if (manager != nullptr && memory::is_readable(manager, sizeof(void*)) && memory::is_readable(*(void**)manager, sizeof(void*))) {
+                SPDLOG_INFO("Using cached IConsoleManager at {:x}", *cached);
+                return (FConsoleManager**)*cached;
+            }
+        } catch(...) {
+        }
+
         const auto now = std::chrono::steady_clock::now();
 
         for (const auto& candidate : candidates) {
@@ -104,6 +120,8 @@ FConsoleManager* FConsoleManager::get() {
 
             if (result) {
                 SPDLOG_INFO("Took {}ms to search through all candidates", std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - now).count());
+
+                cache.set_address("FConsoleManager::GConsoleManager", (uintptr_t)result);
                 return result;
             }
         }
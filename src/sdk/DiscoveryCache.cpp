@@ -0,0 +1,409 @@
+#include <fstream>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <nlohmann/json.hpp>
+
+#include <utility/Module.hpp>
+#include <utility/String.hpp>
+
+#include "DiscoveryCache.hpp"
+
+namespace sdk {
+DiscoveryCache& DiscoveryCache::get() {
+    static DiscoveryCache cache{};
+    return cache;
+}
+
+DiscoveryCache::DiscoveryCache() {
+    if (!s_enabled) {
+        return;
+    }
+
+    m_path = s_path_override.value_or(get_default_path());
+    load();
+}
+
+DiscoveryCache::~DiscoveryCache() {
+    flush();
+}
+
+std::optional<uint64_t> DiscoveryCache::get_value(std::string_view key, HMODULE module) {
+    std::scoped_lock _{m_mutex};
+
+    const auto entry = find_locked(key);
+
+    if (!entry || entry->is_address) {
+        return std::nullopt;
+    }
+
+    // Recorded against some other module than the one being asked about
+    if (entry->module != get_module_name(module != nullptr ? module : utility::get_executable()).value_or("")) {
+        return std::nullopt;
+    }
+
+    return entry->value;
+}
+
+void DiscoveryCache::set_value(std::string_view key, uint64_t value, HMODULE module) {
+    std::scoped_lock _{m_mutex};
+    insert_locked(key, module != nullptr ? module : utility::get_executable(), value, false);
+}
+
+std::optional<uintptr_t> DiscoveryCache::get_address(std::string_view key) {
+    std::scoped_lock _{m_mutex};
+
+    const auto entry = find_locked(key);
+
+    if (!entry || !entry->is_address) {
+        return std::nullopt;
+    }
+
+    if (!is_mapped((uintptr_t)entry->value, false)) {
+        m_entries.erase(std::string{key});
+        return std::nullopt;
+    }
+
+    return (uintptr_t)entry->value;
+}
+
+std::optional<uintptr_t> DiscoveryCache::get_function(std::string_view key) {
+    const auto address = get_address(key);
+
+    if (!address || !is_mapped(*address, true)) {
+        return std::nullopt;
+    }
+
+    return address;
+}
+
+void DiscoveryCache::set_address(std::string_view key, uintptr_t address) {
+    const auto module = utility::get_module_within(address);
+
+    if (!module || *module == nullptr) {
+        SPDLOG_ERROR("[DiscoveryCache] Not caching {}, 0x{:x} is not inside a module", key, address);
+        return;
+    }
+
+    std::scoped_lock _{m_mutex};
+    insert_locked(key, *module, (uint64_t)(address - (uintptr_t)*module), true);
+}
+
+void DiscoveryCache::invalidate(std::string_view key) {
+    std::scoped_lock _{m_mutex};
+
+    if (m_entries.erase(std::string{key}) > 0) {
+        SPDLOG_INFO("[DiscoveryCache] Invalidated {}", key);
+        m_dirty = true;
+    }
+}
+
+void DiscoveryCache::clear() {
+    std::scoped_lock _{m_mutex};
+
+    m_entries.clear();
+    m_modules.clear();
+    m_module_checked.clear();
+
+    m_dirty = true;
+}
+
+void DiscoveryCache::flush() try {
+    // Held throughout so an older snapshot can't be written over a newer one
+    std::scoped_lock file_lock{m_file_mutex};
+    std::string contents{};
+
+    {
+        std::scoped_lock _{m_mutex};
+
+        if (!m_dirty || !s_enabled || m_path.empty()) {
+            return;
+        }
+
+        contents = serialize_locked();
+        m_dirty = false;
+    }
+
+    // The file itself is written without holding m_mutex so lookups don't wait on the disk
+    write(contents);
+} catch(...) {
+    SPDLOG_ERROR("[DiscoveryCache] Failed to flush cache to {}", m_path.string());
+}
+
+std::optional<DiscoveryCache::Entry> DiscoveryCache::find_locked(std::string_view key) try {
+    if (!s_enabled) {
+        return std::nullopt;
+    }
+
+    const auto it = m_entries.find(std::string{key});
+
+    if (it == m_entries.end()) {
+        return std::nullopt;
+    }
+
+    auto entry = it->second;
+    const auto handle = GetModuleHandleW(utility::widen(entry.module).c_str());
+
+    // Not loaded (yet), can't say anything about it
+    if (handle == nullptr) {
+        return std::nullopt;
+    }
+
+    // The module only has to be compared once per session
+    auto checked = m_module_checked.find(entry.module);
+
+    if (checked == m_module_checked.end()) {
+        const auto identity = get_identity(handle);
+        const auto stored = m_modules.find(entry.module);
+        const auto matches = identity.has_value() && stored != m_modules.end() && *identity == stored->second;
+
+        checked = m_module_checked.emplace(entry.module, matches).first;
+
+        if (!matches) {
+            SPDLOG_INFO("[DiscoveryCache] {} changed since the cache was written, dropping its entries", entry.module);
+            forget_module_locked(entry.module);
+            m_dirty = true;
+        }
+    }
+
+    if (!checked->second) {
+        return std::nullopt;
+    }
+
+    if (entry.is_address) {
+        entry.value += (uint64_t)handle;
+    }
+
+    return entry;
+} catch(...) {
+    return std::nullopt;
+}
+
+void DiscoveryCache::insert_locked(std::string_view key, HMODULE module, uint64_t value, bool is_address) try {
+    if (!s_enabled) {
+        return;
+    }
+
+    const auto name = get_module_name(module);
+    const auto identity = get_identity(module);
+
+    if (!name || !identity) {
+        SPDLOG_ERROR("[DiscoveryCache] Not caching {}, failed to identify module", key);
+        return;
+    }
+
+    // Whatever we had for an older build of this module is useless now
+    if (const auto it = m_modules.find(*name); it != m_modules.end() && it->second != *identity) {
+        forget_module_locked(*name);
+    }
+
+    m_modules[*name] = *identity;
+    m_module_checked[*name] = true;
+    m_entries[std::string{key}] = Entry{ *name, value, is_address };
+
+    SPDLOG_INFO("[DiscoveryCache] Cached {} ({}+0x{:x})", key, *name, value);
+    m_dirty = true;
+} catch(...) {
+    SPDLOG_ERROR("[DiscoveryCache] Failed to cache {}", key);
+}
+
+void DiscoveryCache::forget_module_locked(const std::string& module) {
+    std::erase_if(m_entries, [&](const auto& entry) {
+        return entry.second.module == module;
+    });
+
+    m_modules.erase(module);
+}
+
+void DiscoveryCache::load() try {
+    std::ifstream file{m_path};
+
+    if (!file) {
+        SPDLOG_INFO("[DiscoveryCache] No cache at {}", m_path.string());
+        return;
+    }
+
+    const auto j = nlohmann::json::parse(file, nullptr, false);
+
+    if (j.is_discarded() || !j.is_object()) {
+        SPDLOG_ERROR("[DiscoveryCache] Cache at {} is corrupt, ignoring it", m_path.string());
+        return;
+    }
+
+    if (j.value("version", 0u) != VERSION) {
+        SPDLOG_INFO("[DiscoveryCache] Cache at {} is from a different version, ignoring it", m_path.string());
+        return;
+    }
+
+    for (const auto& [name, value] : j.at("modules").items()) {
+        m_modules[name] = Identity{
+            value.at("timestamp").get<uint32_t>(),
+            value.at("image_size").get<uint32_t>(),
+            value.at("checksum").get<uint32_t>(),
+            value.at("header_hash").get<uint64_t>()
+        };
+    }
+
+    for (const auto& [key, value] : j.at("entries").items()) {
+        m_entries[key] = Entry{
+            value.at("module").get<std::string>(),
+            value.at("value").get<uint64_t>(),
+            value.at("is_address").get<bool>()
+        };
+    }
+
+    SPDLOG_INFO("[DiscoveryCache] Loaded {} entries from {}", m_entries.size(), m_path.string());
+} catch(...) {
+    SPDLOG_ERROR("[DiscoveryCache] Failed to load cache from {}", m_path.string());
+
+    m_entries.clear();
+    m_modules.clear();
+}
+
+std::string DiscoveryCache::serialize_locked() const {
+    nlohmann::json j{};
+    j["version"] = VERSION;
+    j["modules"] = nlohmann::json::object();
+    j["entries"] = nlohmann::json::object();
+
+    for (const auto& [name, identity] : m_modules) {
+        j["modules"][name] = {
+            { "timestamp", identity.timestamp },
+            { "image_size", identity.image_size },
+            { "checksum", identity.checksum },
+            { "header_hash", identity.header_hash }
+        };
+    }
+
+    for (const auto& [key, entry] : m_entries) {
+        j["entries"][key] = {
+            { "module", entry.module },
+            { "value", entry.value },
+            { "is_address", entry.is_address }
+        };
+    }
+
+    return j.dump(4);
+}
+
+void DiscoveryCache::write(const std::string& contents) try {
+    if (m_path.has_parent_path()) {
+        std::filesystem::create_directories(m_path.parent_path());
+    }
+
+    // Write it out to the side first so a crash halfway through doesn't leave a broken cache
+    auto temp_path = m_path;
+    temp_path += L".tmp";
+
+    {
+        std::ofstream file{temp_path, std::ios::trunc};
+
+        if (!file) {
+            SPDLOG_ERROR("[DiscoveryCache] Failed to open {} for writing", temp_path.string());
+            return;
+        }
+
+        file << contents;
+    }
+
+    std::filesystem::rename(temp_path, m_path);
+} catch(...) {
+    SPDLOG_ERROR("[DiscoveryCache] Failed to save cache to {}", m_path.string());
+}
+
+std::optional<DiscoveryCache::Identity> DiscoveryCache::get_identity(HMODULE module) try {
+    if (module == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto base = (uintptr_t)module;
+    const auto dos = (IMAGE_DOS_HEADER*)base;
+
+    if (dos->e_magic != IMAGE_DOS_SIGNATURE) {
+        return std::nullopt;
+    }
+
+    const auto nt = (IMAGE_NT_HEADERS*)(base + dos->e_lfanew);
+
+    if (nt->Signature != IMAGE_NT_SIGNATURE) {
+        return std::nullopt;
+    }
+
+    Identity result{};
+    result.timestamp = nt->FileHeader.TimeDateStamp;
+    result.image_size = nt->OptionalHeader.SizeOfImage;
+    result.checksum = nt->OptionalHeader.CheckSum;
+
+    // The headers include the section table, so any relinked build changes this too.
+    // The loader rewrites ImageBase to wherever ASLR put the module, so those bytes are hashed as zeroes.
+    // FNV-1a, just needs to be stable between runs
+    const auto header_size = std::min<size_t>(nt->OptionalHeader.SizeOfHeaders, 0x1000);
+    const auto image_base_start = (size_t)((uintptr_t)&nt->OptionalHeader.ImageBase - base);
+    const auto image_base_end = image_base_start + sizeof(nt->OptionalHeader.ImageBase);
+    uint64_t hash = 0xCBF29CE484222325;
+
+    for (size_t i = 0; i < header_size; ++i) {
+        const auto is_image_base = i >= image_base_start && i < image_base_end;
+
+        hash ^= is_image_base ? 0 : *(uint8_t*)(base + i);
+        hash *= 0x100000001B3;
+    }
+
+    result.header_hash = hash;
+
+    return result;
+} catch(...) {
+    return std::nullopt;
+}
+
+std::optional<std::string> DiscoveryCache::get_module_name(HMODULE module) try {
+    const auto path = utility::get_module_pathw(module);
+
+    if (!path) {
+        return std::nullopt;
+    }
+
+    auto name = utility::narrow(std::filesystem::path{*path}.filename().wstring());
+    std::transform(name.begin(), name.end(), name.begin(), [](char c) { return (char)std::tolower((unsigned char)c); });
+
+    return name;
+} catch(...) {
+    return std::nullopt;
+}
+
+std::filesystem::path DiscoveryCache::get_default_path() try {
+    // Next to whatever module the SDK got linked into, one file per game
+    const auto self = utility::get_module_within((uintptr_t)&DiscoveryCache::get).value_or(nullptr);
+    const auto self_path = utility::get_module_pathw(self != nullptr ? self : utility::get_executable());
+    const auto exe_path = utility::get_module_pathw(utility::get_executable());
+
+    if (!self_path || !exe_path) {
+        return {};
+    }
+
+    const auto directory = std::filesystem::path{*self_path}.parent_path();
+    const auto exe_name = std::filesystem::path{*exe_path}.stem().wstring();
+
+    return directory / L"uesdk_cache" / (exe_name + L".json");
+} catch(...) {
+    return {};
+}
+
+bool DiscoveryCache::is_mapped(uintptr_t address, bool executable) {
+    MEMORY_BASIC_INFORMATION mbi{};
+
+    if (VirtualQuery((void*)address, &mbi, sizeof(mbi)) == 0) {
+        return false;
+    }
+
+    if (mbi.State != MEM_COMMIT || (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) != 0) {
+        return false;
+    }
+
+    if (executable) {
+        return (mbi.Protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY)) != 0;
+    }
+
+    return true;
+}
+}
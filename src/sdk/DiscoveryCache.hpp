@@ -0,0 +1,102 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+#include <string_view>
+#include <unordered_map>
+
+#include <windows.h>
+
+namespace sdk {
+// On-disk cache of what the startup scans found (function addresses, bruteforced offsets, vtable indices)
+// so the next launch of the same build can skip the scanning, disassembly and emulation entirely.
+// Every entry belongs to the module it was found in and is only handed back while that module's
+// identity (PE timestamp, image size, checksum and a hash of the headers) still matches,
+// so patching the game turns everything it touched into a miss and the entries get replaced.
+// Callers still sanity check what they get back and fall through to the full scan if it looks off.
+class DiscoveryCache {
+public:
+    static DiscoveryCache& get();
+
+    // Plain numbers (offsets, indices, flags), tied to the module they were derived from.
+    // nullptr means the executable
+    std::optional<uint64_t> get_value(std::string_view key, HMODULE module = nullptr);
+    void set_value(std::string_view key, uint64_t value, HMODULE module = nullptr);
+
+    // Addresses, stored relative to whatever module they're in.
+    // get_function additionally requires the address to be in executable memory
+    std::optional<uintptr_t> get_address(std::string_view key);
+    std::optional<uintptr_t> get_function(std::string_view key);
+    void set_address(std::string_view key, uintptr_t address);
+
+    // For entries that came back but didn't survive the caller's re-validation
+    void invalidate(std::string_view key);
+    void clear();
+
+    // Changes only live in memory until this writes them out, which the DiscoveryGraph does once
+    // the startup scans are done and the destructor does again at shutdown. Nothing happens if nothing changed
+    void flush();
+
+    // Both have to be called before anything touches the cache to have an effect
+    static void set_enabled(bool enabled) {
+        s_enabled = enabled;
+    }
+
+    static void set_path(const std::filesystem::path& path) {
+        s_path_override = path;
+    }
+
+    static bool is_enabled() {
+        return s_enabled;
+    }
+
+public:
+    constexpr static inline uint32_t VERSION = 2;
+
+private:
+    struct Identity {
+        uint32_t timestamp{0};
+        uint32_t image_size{0};
+        uint32_t checksum{0};
+        uint64_t header_hash{0};
+
+        bool operator==(const Identity& other) const = default;
+    };
+
+    struct Entry {
+        std::string module{};
+        uint64_t value{0};
+        bool is_address{false};
+    };
+
+    DiscoveryCache();
+    ~DiscoveryCache();
+
+    std::optional<Entry> find_locked(std::string_view key);
+    void insert_locked(std::string_view key, HMODULE module, uint64_t value, bool is_address);
+    void forget_module_locked(const std::string& module);
+
+    void load();
+    std::string serialize_locked() const;
+    void write(const std::string& contents);
+
+    static std::optional<Identity> get_identity(HMODULE module);
+    static std::optional<std::string> get_module_name(HMODULE module);
+    static std::filesystem::path get_default_path();
+    static bool is_mapped(uintptr_t address, bool executable);
+
+    std::mutex m_mutex{};
+    std::mutex m_file_mutex{}; // one flush at a time
+    std::filesystem::path m_path{};
+    std::unordered_map<std::string, Entry> m_entries{};
+    std::unordered_map<std::string, Identity> m_modules{}; // what the entries were recorded against
+    std::unordered_map<std::string, bool> m_module_checked{}; // compared against the loaded module this session
+    bool m_dirty{false};
+
+    static inline bool s_enabled{true};
+    static inline std::optional<std::filesystem::path> s_path_override{};
+};
+}
@@ -0,0 +1,248 @@
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "FName.hpp"
+#include "FNamePool.hpp"
+#include "FMalloc.hpp"
+#include "ConsoleManager.hpp"
+#include "UEngine.hpp"
+#include "DynamicRHI.hpp"
+#include "UGameViewportClient.hpp"
+#include "FRenderTargetPool.hpp"
+#include "UObjectHashTables.hpp"
+#include "UObjectArray.hpp"
+#include "FViewport.hpp"
+#include "AHUD.hpp"
+#include "Slate.hpp"
+#include "UObjectNameIndex.hpp"
+#include "UObjectClassIndex.hpp"
+#include "UStructTree.hpp"
+#include "UObjectScan.hpp"
+#include "DiscoveryCache.hpp"
+
+#include "DiscoveryGraph.hpp"
+
+namespace sdk {
+DiscoveryGraph& DiscoveryGraph::get() {
+    // Leaked on purpose, workers might still be running when the process goes down
+    static auto graph = new DiscoveryGraph{};
+    return *graph;
+}
+
+DiscoveryGraph::DiscoveryGraph() {
+    // Only module scans, these can all go at once
+    add("FName::get_constructor", {}, [] { return FName::get_constructor().has_value(); });
+    add("FName::get_to_string", {}, [] { return FName::get_to_string().has_value(); });
+    add("FMalloc::get", {}, [] { return FMalloc::get() != nullptr; });
+    add("FConsoleManager::get", {}, [] { return FConsoleManager::get() != nullptr; });
+    add("UEngine::get_lvalue", {}, [] { return UEngine::get_lvalue() != nullptr; });
+    add("FDynamicRHI::get", {}, [] { return FDynamicRHI::get() != nullptr; });
+    add("UGameViewportClient::get_draw_function", {}, [] { return UGameViewportClient::get_draw_function().has_value(); });
+    add("FRenderTargetPool::get_find_free_element_fn", {}, [] { return FRenderTargetPool::get_find_free_element_fn().has_value(); });
+    add("FUObjectHashTables::get", {}, [] { return FUObjectHashTables::get() != nullptr; });
+
+    add("FNamePool::get", {"FName::get_to_string"}, [] { return FNamePool::get() != nullptr; });
+    add("FViewport::update", {"UGameViewportClient::get_draw_function"}, [] { return FViewport::get_debug_canvas_index().has_value(); });
+    add("slate::locate_draw_window_renderthread_fn", {"FConsoleManager::get"}, [] { return slate::locate_draw_window_renderthread_fn().has_value(); });
+
+    // Settles the UObject/UStruct/FProperty offsets, so anything reading objects has to come after it
+    add("FUObjectArray::get", {"FName::get_constructor", "FName::get_to_string", "FNamePool::get"}, [] { return FUObjectArray::get() != nullptr; });
+
+    add("AHUD::get_post_render_index", {"FUObjectArray::get"}, [] { return AHUD::get_post_render_index().has_value(); });
+    add("UObjectNameIndex::get", {"FUObjectArray::get"}, [] { return UObjectNameIndex::get() != nullptr; });
+    add("UStructTree::rebuild", {"FUObjectArray::get"}, [] { UStructTree::rebuild(); return UStructTree::size() > 0; });
+
+    // Both sweep GUObjectArray on the scan pool, which only runs one scan at a time anyway
+    add("UObjectClassIndex::refresh", {"UStructTree::rebuild"}, [] {
+        const auto index = UObjectClassIndex::get();
+
+        if (index == nullptr) {
+            return false;
+        }
+
+        index->refresh();
+        return true;
+    });
+}
+
+void DiscoveryGraph::add(std::string_view name, std::vector<std::string_view> dependencies, std::function<bool()> fn) {
+    auto& node = m_nodes.emplace_back();
+    const auto index = m_nodes.size() - 1;
+
+    node.name = name;
+    node.fn = std::move(fn);
+    node.future = node.promise.get_future().share();
+    node.timing.name = name;
+
+    for (const auto dependency : dependencies) {
+        const auto it = std::find_if(m_nodes.begin(), m_nodes.end() - 1, [&](const Node& other) { return other.name == dependency; });
+
+        if (it == m_nodes.end() - 1) {
+            SPDLOG_ERROR("[DiscoveryGraph] {} depends on {} which hasn't been added", name, dependency);
+            continue;
+        }
+
+        const auto dependency_index = (size_t)std::distance(m_nodes.begin(), it);
+
+        node.dependencies.push_back(dependency_index);
+        m_nodes[dependency_index].dependents.push_back(index);
+    }
+
+    node.remaining = node.dependencies.size();
+}
+
+void DiscoveryGraph::warm_up_async() {
+    std::scoped_lock _{m_mutex};
+
+    if (m_started) {
+        return;
+    }
+
+    m_started = true;
+    m_start_time = std::chrono::steady_clock::now();
+    m_unfinished = m_nodes.size();
+
+    SPDLOG_INFO("[DiscoveryGraph] Starting {} nodes on the scan pool ({} workers)", m_nodes.size(), UObjectScan::get_num_workers());
+
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        if (m_nodes[i].remaining == 0) {
+            schedule(i);
+        }
+    }
+}
+
+void DiscoveryGraph::wait() {
+    warm_up_async();
+
+    std::unique_lock lock{m_mutex};
+    m_done_cv.wait(lock, [this] { return m_unfinished == 0; });
+}
+
+std::shared_future<void> DiscoveryGraph::get_future(std::string_view name) {
+    warm_up_async();
+
+    for (const auto& node : m_nodes) {
+        if (node.name == name) {
+            return node.future;
+        }
+    }
+
+    return {};
+}
+
+void DiscoveryGraph::schedule(size_t index) {
+    // One submission per node rather than a few long running loops,
+    // so whichever worker isn't running a node right now can help out with the scans the others start
+    UObjectScan::submit([this, index] { run_node(index); });
+}
+
+void DiscoveryGraph::run_node(size_t index) {
+    auto& node = m_nodes[index];
+
+    {
+        std::scoped_lock _{m_mutex};
+        node.timing.start_ms = elapsed_ms();
+    }
+
+    bool found = false;
+
+    try {
+        ZoneScopedN("sdk::DiscoveryGraph::run_node");
+        found = node.fn();
+    } catch(...) {
+        SPDLOG_ERROR("[DiscoveryGraph] Exception occurred in {}", node.name);
+    }
+
+    const auto end_ms = elapsed_ms();
+
+    std::vector<size_t> ready{};
+    bool all_done = false;
+
+    {
+        std::scoped_lock _{m_mutex};
+
+        node.timing.found = found;
+        node.timing.finished = true;
+        node.timing.duration_ms = end_ms - node.timing.start_ms;
+
+        // Dependencies are always done before us, so their critical paths are final
+        double longest_dependency = 0.0;
+
+        for (const auto dependency : node.dependencies) {
+            longest_dependency = std::max(longest_dependency, m_nodes[dependency].timing.critical_path_ms);
+        }
+
+        node.timing.critical_path_ms = longest_dependency + node.timing.duration_ms;
+        node.promise.set_value();
+
+        for (const auto dependent : node.dependents) {
+            if (--m_nodes[dependent].remaining == 0) {
+                ready.push_back(dependent);
+            }
+        }
+
+        all_done = --m_unfinished == 0;
+    }
+
+    for (const auto dependent : ready) {
+        schedule(dependent);
+    }
+
+    if (all_done) {
+        m_done_cv.notify_all();
+
+        // Everything the nodes found goes to disk in one go instead of once per entry
+        DiscoveryCache::get().flush();
+
+        log_report();
+    }
+}
+
+std::vector<DiscoveryGraph::Timing> DiscoveryGraph::get_timings() const {
+    std::scoped_lock _{m_mutex};
+
+    std::vector<Timing> result{};
+    result.reserve(m_nodes.size());
+
+    for (const auto& node : m_nodes) {
+        result.push_back(node.timing);
+    }
+
+    return result;
+}
+
+void DiscoveryGraph::log_report() const {
+    auto timings = get_timings();
+
+    std::sort(timings.begin(), timings.end(), [](const Timing& a, const Timing& b) {
+        return a.start_ms < b.start_ms;
+    });
+
+    double wall_ms = 0.0;
+    double serial_ms = 0.0;
+    double critical_path_ms = 0.0;
+
+    for (const auto& timing : timings) {
+        if (!timing.finished) {
+            SPDLOG_INFO("[DiscoveryGraph] {:<45} still running", timing.name);
+            continue;
+        }
+
+        SPDLOG_INFO("[DiscoveryGraph] {:<45} {:>9.2f} ms -> {:>9.2f} ms ({:.2f} ms){}",
+            timing.name, timing.start_ms, timing.start_ms + timing.duration_ms, timing.duration_ms, timing.found ? "" : " [not found]");
+
+        wall_ms = std::max(wall_ms, timing.start_ms + timing.duration_ms);
+        serial_ms += timing.duration_ms;
+        critical_path_ms = std::max(critical_path_ms, timing.critical_path_ms);
+    }
+
+    SPDLOG_INFO("[DiscoveryGraph] Wall {:.2f} ms, critical path {:.2f} ms, serial {:.2f} ms", wall_ms, critical_path_ms, serial_ms);
+}
+
+double DiscoveryGraph::elapsed_ms() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start_time).count();
+}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <future>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <condition_variable>
+
+namespace sdk {
+// Runs the expensive one-time lookups (GUObjectArray, FName, GEngine, GMalloc...) up front,
+// in parallel on the UObjectScan pool wherever they don't depend on each other.
+// They're all function local statics, so if something asks for one while a node is still working on it
+// it just waits for that node like it normally would, and anything not started yet runs on the caller instead.
+class DiscoveryGraph {
+public:
+    struct Timing {
+        std::string_view name{};
+        bool found{false};
+        bool finished{false};
+        double start_ms{0.0}; // since warm_up_async
+        double duration_ms{0.0};
+        double critical_path_ms{0.0}; // longest dependency chain ending with this node
+    };
+
+    static DiscoveryGraph& get();
+
+    // Returns right away. Only the first call does anything
+    void warm_up_async();
+
+    // Blocks until every node finished. Starts the warm up if nobody did yet
+    void wait();
+
+    // Done when that node and everything it depends on has run.
+    // Starts the warm up if nobody did yet, invalid future if there's no node by that name
+    std::shared_future<void> get_future(std::string_view name);
+
+    std::vector<Timing> get_timings() const;
+    void log_report() const;
+
+private:
+    struct Node {
+        std::string_view name{};
+        std::function<bool()> fn{};
+
+        std::vector<size_t> dependencies{};
+        std::vector<size_t> dependents{};
+        size_t remaining{0}; // dependencies that haven't finished
+
+        std::promise<void> promise{};
+        std::shared_future<void> future{};
+        Timing timing{};
+    };
+
+    DiscoveryGraph();
+
+    // Dependencies have to be added before the nodes that use them, so the graph can't have cycles
+    void add(std::string_view name, std::vector<std::string_view> dependencies, std::function<bool()> fn);
+    void schedule(size_t index);
+    void run_node(size_t index);
+    double elapsed_ms() const;
+
+    mutable std::mutex m_mutex{};
+    std::condition_variable m_done_cv{};
+
+    std::vector<Node> m_nodes{};
+    size_t m_unfinished{0};
+    bool m_started{false};
+
+    std::chrono::steady_clock::time_point m_start_time{};
+};
+}
@@ -4,6 +4,7 @@
 #include <utility/Scan.hpp>
 
 #include "EngineModule.hpp"
+#include "SignatureDatabase.hpp"
 
 #include "DynamicRHI.hpp"
 
@@ -12,58 +13,15 @@ FDynamicRHI* FDynamicRHI::get() {
     static FDynamicRHI** instance = []() -> FDynamicRHI** {
         SPDLOG_INFO("Searching for FDynamicRHI instance...");
 
-        // Scans for a string reference inside InitNullRHI
-        const auto module = sdk::get_ue_module(L"RHI");
-        const auto str = utility::scan_string(module, L"NullDrvFailure");
+        const auto result = SignatureDatabase::get().resolve("FDynamicRHI::GDynamicRHI");
 
-        if (!str) {
-            SPDLOG_ERROR("Failed to find FDynamicRHI instance (no string)");
+        if (!result) {
+            SPDLOG_ERROR("Failed to find FDynamicRHI instance");
             return nullptr;
         }
 
-        const auto ref = utility::scan_displacement_reference(module, *str);
-
-        if (!ref) {
-            SPDLOG_ERROR("Failed to find FDynamicRHI instance (no string reference)");
-            return nullptr;
-        }
-
-        const auto resolved = utility::resolve_instruction(*ref);
-
-        if (!resolved) {
-            SPDLOG_ERROR("Failed to find FDynamicRHI instance (cannot resolve instruction)");
-            return nullptr;
-        }
-
-        auto ip = (uint8_t*)resolved->addr;
-
-        for (auto i = 0; i < 100; ++i) {
-            const auto ix = utility::decode_one(ip);
-
-            if (!ix) {
-                SPDLOG_ERROR("Failed to find FDynamicRHI instance (failed to decode instruction @ {:x})", (uintptr_t)ip);
-                return nullptr;
-            }
-
-            if (std::string_view{ix->Mnemonic}.starts_with("MOV") && 
-                ix->Operands[0].Type == ND_OP_MEM &&
-                ix->Operands[1].Type == ND_OP_REG && 
-                ix->Operands[1].Info.Register.Reg == NDR_RAX &&
-                ix->Operands[1].Size == sizeof(void*)) 
-            {
-                const auto result = utility::resolve_displacement((uintptr_t)ip);
-                if (result) {
-                    SPDLOG_INFO("Found FDynamicRHI instance at {:x} (referenced at {:x})", *result, (uintptr_t)ip);
-                    return (FDynamicRHI**)*result;
-                }
-
-                SPDLOG_ERROR("Failed to find FDynamicRHI instance @ {:x}", (uintptr_t)ip);
-            }
-
-            ip += ix->Length;
-        }
-
-        return nullptr;
+        SPDLOG_INFO("Found FDynamicRHI instance at {:x}", *result);
+        return (FDynamicRHI**)*result;
     }();
     
     if (instance == nullptr) {
@@ -5,6 +5,7 @@
 #include "UObjectArray.hpp"
 #include "FObjectProperty.hpp"
 
+#include "Memory.hpp"
 #include "FArrayProperty.hpp"
 
 namespace sdk {
@@ -39,13 +40,13 @@ void FArrayProperty::update_offsets() {
     for (auto i = start; i < start + 0x100; i += sizeof(void*)) try {
         const auto value = *(FProperty**)(attach_children + i);
 
-        if (value == nullptr || IsBadReadPtr(value, sizeof(void*))) {
+        if (value == nullptr || !memory::is_readable(value, sizeof(void*))) {
             continue;
         }
         
         const auto c = value->get_class();
 
-        if (c == nullptr || IsBadReadPtr(c, sizeof(void*))) {
+        if (c == nullptr || !memory::is_readable(c, sizeof(void*))) {
             continue;
         }
 
@@ -9,6 +9,11 @@ class FBoolProperty : public FProperty {
 public:
     static void update_offsets();
 
+    // False until update_offsets found them, everything below reads garbage until then
+    static bool has_offsets() {
+        return s_field_size_offset != 0;
+    }
+
     uint8_t get_field_size() const {
         return *(uint8_t*)((uintptr_t)this + s_field_size_offset);
     }
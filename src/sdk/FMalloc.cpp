@@ -10,6 +10,7 @@
 
 #include "EngineModule.hpp"
 
+#include "Memory.hpp"
 #include "FMalloc.hpp"
 
 namespace sdk {
@@ -81,30 +82,30 @@ FMalloc* FMalloc::get() {
 
             seen_displacements.insert(*disp);
 
-            if (IsBadReadPtr((void*)*disp, sizeof(void*))) {
+            if (!memory::is_readable((void*)*disp, sizeof(void*))) {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
             const auto obj = *(void**)*disp;
 
-            if (IsBadReadPtr(obj, sizeof(void*))) {
+            if (!memory::is_readable(obj, sizeof(void*))) {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
             const auto vtable = *(void***)obj;
 
-            if (IsBadReadPtr(vtable, sizeof(void*) * 30)) {
+            if (!memory::is_readable(vtable, sizeof(void*) * 30)) {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
-            if (IsBadReadPtr(vtable[0], sizeof(void*))) {
+            if (!memory::is_readable(vtable[0], sizeof(void*))) {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
             for (auto i = 0; i < 30; ++i) {
                 const auto fn = (uintptr_t)vtable[i];
 
-                if (IsBadReadPtr((void*)fn, sizeof(void*))) {
+                if (!memory::is_readable((void*)fn, sizeof(void*))) {
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
@@ -162,7 +163,7 @@ FMalloc* FMalloc::get() {
         for (auto i = 1; i < 30; ++i) {
             const auto fn = (uintptr_t)vtable[i];
 
-            if (IsBadReadPtr((void*)fn, sizeof(void*))) {
+            if (!memory::is_readable((void*)fn, sizeof(void*))) {
                 break;
             }
 
@@ -181,7 +182,7 @@ FMalloc* FMalloc::get() {
         /*for (auto i = *s_malloc_index + 1; i < 30; ++i) {
             const auto fn = (uintptr_t)vtable[i];
 
-            if (IsBadReadPtr((void*)fn, sizeof(void*))) {
+            if (!memory::is_readable((void*)fn, sizeof(void*))) {
                 break;
             }
 
@@ -199,7 +200,7 @@ FMalloc* FMalloc::get() {
         for (auto i = *s_malloc_index + 1; i < 30; ++i) {
             const auto fn = (uintptr_t)vtable[i];
 
-            if (IsBadReadPtr((void*)fn, sizeof(void*))) {
+            if (!memory::is_readable((void*)fn, sizeof(void*))) {
                 break;
             }
 
@@ -224,7 +225,7 @@ FMalloc* FMalloc::get() {
         for (auto i = *s_realloc_index + 1; i < 30; ++i) {
             const auto fn = (uintptr_t)vtable[i];
 
-            if (IsBadReadPtr((void*)fn, sizeof(void*))) {
+            if (!memory::is_readable((void*)fn, sizeof(void*))) {
                 break;
             }
 
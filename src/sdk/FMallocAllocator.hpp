@@ -0,0 +1,241 @@
+#pragma once
+
+#include <new>
+#include <array>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+#include <sdk/FMalloc.hpp>
+
+namespace sdk {
+namespace detail {
+inline void* fmalloc_allocate(size_t size, size_t alignment) {
+    const auto m = FMalloc::get();
+
+    if (m == nullptr) {
+        throw std::bad_alloc{};
+    }
+
+    // 0 lets the engine pick, which is 16 for anything that size or bigger
+    const auto result = m->malloc(size, alignment > 16 ? (uint32_t)alignment : 0);
+
+    if (result == nullptr) {
+        throw std::bad_alloc{};
+    }
+
+    return result;
+}
+
+inline void fmalloc_free(void* ptr) {
+    if (auto m = FMalloc::get(); m != nullptr) {
+        m->free(ptr);
+    }
+}
+}
+
+// Goes straight to the engine's GMalloc, so containers using it live on the same heap as the engine's own stuff
+// and can have their memory handed to (or taken from) the engine.
+// Throws std::bad_alloc if GMalloc wasn't found, so don't use it for anything that has to work before that.
+template<typename T>
+struct FMallocAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    FMallocAllocator() noexcept = default;
+
+    template<typename U>
+    FMallocAllocator(const FMallocAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return (T*)detail::fmalloc_allocate(n * sizeof(T), alignof(T));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept {
+        detail::fmalloc_free(ptr);
+    }
+
+    template<typename U>
+    bool operator==(const FMallocAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+// Per thread free lists of small blocks on top of GMalloc, for the short lived stuff (name strings, parameter buffers, query results)
+// that would otherwise be a malloc and a free every time. Every block is still its own GMalloc allocation,
+// so a block freed on a different thread than it came from just ends up cached on that thread instead.
+// Each size class keeps at most MAX_CACHED blocks, anything past that and anything bigger than the biggest class goes right back.
+class FMallocPool {
+public:
+    constexpr static inline size_t MIN_BLOCK_SIZE = 16;
+    constexpr static inline size_t NUM_CLASSES = 6; // 16, 32, 64, 128, 256, 512
+    constexpr static inline size_t MAX_BLOCK_SIZE = MIN_BLOCK_SIZE << (NUM_CLASSES - 1);
+    constexpr static inline size_t MAX_CACHED = 64;
+
+    struct Stats {
+        uint64_t hits{0};
+        uint64_t misses{0};
+        uint64_t bypassed{0}; // too big or too aligned for the pool
+        size_t cached{0};
+    };
+
+    static void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        if (size > MAX_BLOCK_SIZE || alignment > MIN_BLOCK_SIZE) {
+            if (!s_destroyed) {
+                ++get().m_stats.bypassed;
+            }
+
+            return detail::fmalloc_allocate(size, alignment);
+        }
+
+        const auto index = get_class(size);
+
+        // Still the whole class size with this thread's pool gone. free() goes by size, so the block
+        // can end up cached on another thread and handed out for anything else in the class
+        if (s_destroyed) {
+            return detail::fmalloc_allocate(get_class_size(index), MIN_BLOCK_SIZE);
+        }
+
+        auto& pool = get();
+        auto& list = pool.m_free[index];
+
+        if (list.count > 0) {
+            ++pool.m_stats.hits;
+            --pool.m_stats.cached;
+            --list.count;
+
+            const auto block = list.head;
+            list.head = block->next;
+            return block;
+        }
+
+        ++pool.m_stats.misses;
+        return detail::fmalloc_allocate(get_class_size(index), MIN_BLOCK_SIZE);
+    }
+
+    // size and alignment have to be the same as what it was allocated with
+    static void free(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        // Also after this thread's pool is gone, e.g. from some other thread_local's destructor
+        if (size > MAX_BLOCK_SIZE || alignment > MIN_BLOCK_SIZE || s_destroyed) {
+            detail::fmalloc_free(ptr);
+            return;
+        }
+
+        auto& pool = get();
+        auto& list = pool.m_free[get_class(size)];
+
+        if (list.count >= MAX_CACHED) {
+            detail::fmalloc_free(ptr);
+            return;
+        }
+
+        list.head = new (ptr) Block{list.head};
+        ++list.count;
+        ++pool.m_stats.cached;
+    }
+
+    // This thread's numbers only
+    static Stats get_stats() {
+        return !s_destroyed ? get().m_stats : Stats{};
+    }
+
+    // Hands everything this thread has cached back to GMalloc
+    static void trim() {
+        if (!s_destroyed) {
+            get().release();
+        }
+    }
+
+    static size_t get_class(size_t size) {
+        size_t index = 0;
+
+        while ((MIN_BLOCK_SIZE << index) < size) {
+            ++index;
+        }
+
+        return index;
+    }
+
+    static size_t get_class_size(size_t index) {
+        return MIN_BLOCK_SIZE << index;
+    }
+
+private:
+    struct Block {
+        Block* next{nullptr};
+    };
+
+    struct FreeList {
+        Block* head{nullptr};
+        size_t count{0};
+    };
+
+    static FMallocPool& get() {
+        thread_local FMallocPool pool{};
+        return pool;
+    }
+
+    ~FMallocPool() {
+        release();
+        s_destroyed = true;
+    }
+
+    void release() {
+        for (auto& list : m_free) {
+            while (list.head != nullptr) {
+                const auto next = list.head->next;
+                detail::fmalloc_free(list.head);
+                list.head = next;
+            }
+
+            list.count = 0;
+        }
+
+        m_stats.cached = 0;
+    }
+
+    static inline thread_local bool s_destroyed{false};
+
+    std::array<FreeList, NUM_CLASSES> m_free{};
+    Stats m_stats{};
+};
+
+// FMallocAllocator that goes through the calling thread's FMallocPool
+template<typename T>
+struct FMallocPoolAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    FMallocPoolAllocator() noexcept = default;
+
+    template<typename U>
+    FMallocPoolAllocator(const FMallocPoolAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length{};
+        }
+
+        return (T*)FMallocPool::allocate(n * sizeof(T), alignof(T));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        FMallocPool::free(ptr, n * sizeof(T), alignof(T));
+    }
+
+    template<typename U>
+    bool operator==(const FMallocPoolAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+}
@@ -9,8 +9,14 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "SignatureDatabase.hpp"
 
+#include "Memory.hpp"
 #include "FName.hpp"
+#include "FNamePool.hpp"
 
 namespace sdk {
 /*
@@ -69,111 +75,24 @@ namespace detail {
 // Used as fallback if ToString is inlined
 std::optional<uintptr_t> s_init_name_pool{};
 std::optional<uintptr_t> s_name_pool{};
-
-std::optional<FName::ConstructorFn> get_constructor_from_candidate(std::wstring_view module_candidate, std::wstring_view str_candidate) try {
-    ZoneScopedN("sdk::detail::get_constructor_from_candidate");
-    SPDLOG_INFO("FName::get_constructor_from_candidate: str_candidate={}", utility::narrow(str_candidate.data()));
-
-    const auto module = sdk::get_ue_module(module_candidate.data());
-
-    if (module == nullptr) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to get module {}", utility::narrow(module_candidate.data()));
-        return std::nullopt;
-    }
-
-    const auto str_data = utility::scan_string(module, str_candidate.data());
-
-    if (!str_data) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to get string data for {}", utility::narrow(str_candidate.data()));
-        return std::nullopt;
-    }
-
-    SPDLOG_INFO("FName::get_constructor_from_candidate: str_data={:x}", *str_data);
-
-    const auto str_ref = utility::scan_displacement_reference(module, *str_data);
-
-    if (!str_ref) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to get string reference for {}", utility::narrow(str_candidate.data()));
-        return std::nullopt;
-    }
-
-    SPDLOG_INFO("FName::get_constructor_from_candidate: str_ref={:x}", *str_ref);
-
-    const auto next_instr = *str_ref + 4;
-    const auto call_instr = utility::scan_mnemonic(next_instr, 10, "CALL");
-
-    if (!call_instr) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to get call instruction for {}", utility::narrow(str_candidate.data()));
-        return std::nullopt;
-    }
-
-    SPDLOG_INFO("FName::get_constructor_from_candidate: call_instr={:x}", *call_instr);
-
-    const auto decoded = utility::decode_one((uint8_t*)*call_instr);
-
-    if (!decoded) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to decode call instruction for {}", utility::narrow(str_candidate.data()));
-        return std::nullopt;
-    }
-
-    const auto displacement = utility::resolve_displacement(*call_instr);
-
-    if (!displacement) {
-        SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to resolve displacement for {}", utility::narrow(str_candidate.data()));
-        return std::nullopt;
-    }
-
-    std::optional<FName::ConstructorFn> result{};
-
-    if (decoded->BranchInfo.IsIndirect) {
-        SPDLOG_INFO("FName::get_constructor_from_candidate: indirect call");
-        if (*displacement == 0) {
-            SPDLOG_ERROR("FName::get_constructor_from_candidate: indirect call with null displacement");
-            return std::nullopt;
-        }
-
-        result = *(FName::ConstructorFn*)*displacement;
-    } else {
-        SPDLOG_INFO("FName::get_constructor_from_candidate: direct call");
-        result = (FName::ConstructorFn)*displacement;
-    }
-
-    SPDLOG_INFO("FName::get_constructor_from_candidate: result={:x}", (uintptr_t)*result);
-    return result;
-} catch(...) {
-    SPDLOG_ERROR("FName::get_constructor_from_candidate: Failed to get constructor from candidate due to exception");
-    return std::nullopt;
-}
 }
 
 std::optional<FName::ConstructorFn> FName::get_constructor() {
     static auto result = []() -> std::optional<FName::ConstructorFn> {
         ZoneScopedN("sdk::FName::get_constructor static init");
 
-        struct Candidate {
-            std::wstring_view module;
-            std::wstring_view str;
-        };
-
-        std::vector<Candidate> candidates {
-            Candidate{L"SlateCore", L"FTagMetaData"},
-            Candidate{L"SlateCore", L"FNavigationMetaData"}
-        };
-
         const auto now = std::chrono::high_resolution_clock::now();
+        const auto constructor = SignatureDatabase::get().resolve("FName::Constructor");
 
-        for (const auto& candidate : candidates) {
-            const auto constructor = detail::get_constructor_from_candidate(candidate.module, candidate.str);
-
-            if (constructor) {
-                const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - now).count();
-                SPDLOG_INFO("FName::get_constructor: Found constructor in {} ms", time_elapsed);
-                return constructor;
-            }
+        if (!constructor) {
+            SPDLOG_ERROR("FName::get_constructor: Failed to find constructor");
+            return std::nullopt;
         }
 
-        SPDLOG_ERROR("FName::get_constructor: Failed to find constructor");
-        return std::nullopt;
+        const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - now).count();
+        SPDLOG_INFO("FName::get_constructor: Found constructor in {} ms", time_elapsed);
+
+        return (FName::ConstructorFn)*constructor;
     }();
 
     return result;
@@ -199,7 +118,7 @@ std::optional<FName::ToStringFn> inlined_find_to_string() try {
     };
 
     for (auto candidate : candidates) {
-        const auto str_data = utility::scan_string(module, candidate.data());
+        const auto str_data = sdk::ModuleStrings::get(module).find(candidate);
 
         if (!str_data) {
             SPDLOG_ERROR("FName::get_to_string (inlined): Failed to get string data");
@@ -208,7 +127,7 @@ std::optional<FName::ToStringFn> inlined_find_to_string() try {
         
         SPDLOG_INFO("FName::get_to_string (inlined): str_data={:x}", *str_data);
 
-        const auto str_ref = utility::scan_displacement_reference(module, *str_data);
+        const auto str_ref = sdk::XrefIndex::get(module).find(*str_data);
 
         if (!str_ref) {
             SPDLOG_ERROR("FName::get_to_string  (inlined): Failed to get string reference");
@@ -232,7 +151,7 @@ std::optional<FName::ToStringFn> inlined_find_to_string() try {
                     const auto displacement = utility::resolve_displacement(instr.addr);
 
                     if (instr.instrux.BranchInfo.IsIndirect) {
-                        if (!IsBadReadPtr((void*)*displacement, sizeof(void*))) {
+                        if (memory::is_readable((void*)*displacement, sizeof(void*))) {
                             return *(FName::ToStringFn*)*displacement;
                         }
                     } else {
@@ -302,7 +221,7 @@ std::optional<FName::ToStringFn> standard_find_to_string() {
         return std::nullopt;
     }
 
-    const auto str_data = utility::scan_string(module, L"TAutoWeakObjectPtr<%s%s>");
+    const auto str_data = sdk::ModuleStrings::get(module).find(L"TAutoWeakObjectPtr<%s%s>");
 
     if (!str_data) {
         SPDLOG_ERROR("FName::get_to_string: Failed to get string data");
@@ -311,7 +230,7 @@ std::optional<FName::ToStringFn> standard_find_to_string() {
     
     SPDLOG_INFO("FName::get_to_string: str_data={:x}", *str_data);
 
-    const auto str_ref = utility::scan_displacement_reference(module, *str_data);
+    const auto str_ref = sdk::XrefIndex::get(module).find(*str_data);
 
     if (!str_ref) {
         SPDLOG_ERROR("FName::get_to_string: Failed to get string reference");
@@ -491,13 +410,44 @@ std::optional<FName::ToStringFn> FName::get_to_string() {
         ZoneScopedN("sdk::FName::get_to_string static init");
         SPDLOG_INFO("FName::get_to_string");
 
-        const auto inlined_result = detail::inlined_find_to_string();
+        auto& cache = DiscoveryCache::get();
+
+        if (const auto cached = cache.get_function("FName::ToString"); cached.has_value()) {
+            const auto init_name_pool = cache.get_function("FName::InitNamePool");
+            const auto name_pool = cache.get_address("FName::NamePool");
+
+            // The pool is only ever found together with the standard ToString
+            if (init_name_pool.has_value() == name_pool.has_value()) {
+                SPDLOG_INFO("FName::get_to_string: Using cached ToString at {:x}", *cached);
+
+                detail::s_init_name_pool = init_name_pool;
+                detail::s_name_pool = name_pool;
+
+                return (FName::ToStringFn)*cached;
+            }
+
+            cache.invalidate("FName::ToString");
+        }
+
+        auto result = detail::inlined_find_to_string();
+
+        if (!result) {
+            result = detail::standard_find_to_string();
+        }
 
-        if (inlined_result) {
-            return inlined_result;
+        if (result) {
+            cache.set_address("FName::ToString", (uintptr_t)*result);
+
+            if (detail::s_init_name_pool && detail::s_name_pool) {
+                cache.set_address("FName::InitNamePool", *detail::s_init_name_pool);
+                cache.set_address("FName::NamePool", *detail::s_name_pool);
+            } else {
+                cache.invalidate("FName::InitNamePool");
+                cache.invalidate("FName::NamePool");
+            }
         }
 
-        return detail::standard_find_to_string();
+        return result;
     }();
 
     return result;
@@ -515,6 +465,32 @@ FName::FName(std::wstring_view name, EFindName find_type) {
     fn(this, name.data(), static_cast<uint32_t>(find_type));
 }
 
+std::optional<FNameCasePreserving> FName::find(std::wstring_view name) try {
+    const auto constructor = get_constructor();
+
+    if (!constructor) {
+        return std::nullopt;
+    }
+
+    // The constructor wants a null terminated string
+    wchar_t buffer[1024]{};
+
+    if (name.size() >= std::size(buffer)) {
+        return FNameCasePreserving{};
+    }
+
+    std::copy(name.begin(), name.end(), buffer);
+    buffer[name.size()] = L'\0';
+
+    // Big enough for either layout
+    FNameCasePreserving result{};
+    (*constructor)(&result, buffer, static_cast<uint32_t>(EFindName::Find));
+
+    return result;
+} catch(...) {
+    return std::nullopt;
+}
+
 std::wstring FName::to_string() const {
     static bool once = true;
 
@@ -532,69 +508,149 @@ std::wstring FName::to_string() const {
     const auto fn = *to_string;
     TArray<wchar_t> buffer{};
 
-    if (detail::s_init_name_pool && detail::s_name_pool) {
-        try {
-            const auto** blocks = (const uint8_t**)((uintptr_t)*detail::s_name_pool + (sizeof(void*) * 2));
+    if (const auto pool = FNamePool::get(); pool != nullptr) {
+        const auto name = pool->get_name(this->a1);
 
-            const auto block_index = this->a1 >> 16;
-            const auto offset = this->a1 & ((1 << 16) - 1);
+        if (!name) {
+            return std::wstring{};
+        }
 
-            // Case preserving not supported atm
-            struct FNameEntryHeader {
-                uint16_t wide : 1;
-                uint16_t hash : 5;
-                uint16_t len : 10;
-            };
+        std::wstring result{*name};
 
-            struct FNameEntry {
-                FNameEntryHeader header;
-                union
-                {
-                    char ansi_name[1024];
-                    wchar_t wide_name[1024];
-                };
-            };
+        if (this->a2 != 0) {
+            result += L"_" + std::to_wstring(this->a2 - 1);
+        }
 
-            const auto block = blocks[block_index];
-            const auto name_entry = (FNameEntry*)(block + 2 * offset);
+        return result;
+    } else {
+        // The usual non-inlined version
+        fn(this, &buffer);
+    }
 
-            const auto len = std::min<uint32_t>(name_entry->header.len, 1024);
+    if (buffer.data != nullptr && buffer.count > 0) {
+        return buffer.data;
+    }
 
-            if (name_entry->header.wide) {
-                std::wstring result{};
-                result.resize(len);
+    return std::wstring{};
+}
 
-                memcpy(result.data(), name_entry->wide_name, len * sizeof(wchar_t));
+std::optional<size_t> FName::match_end(std::wstring_view str) const try {
+    // Also makes sure we've looked for the name pool
+    if (!get_to_string()) {
+        return 0;
+    }
 
-                if (this->a2 != 0) {
-                    result += L"_" + std::to_wstring(this->a2 - 1);
-                }
+    const auto slow_path = [&]() -> std::optional<size_t> {
+        const auto name = to_string();
 
-                return result;
-            }
+        if (!str.ends_with(name)) {
+            return std::nullopt;
+        }
+
+        return name.size();
+    };
+
+    const auto pool = FNamePool::get();
+
+    if (pool == nullptr) {
+        return slow_path();
+    }
+
+    const auto name_entry = pool->get_entry(this->a1);
+
+    if (!name_entry) {
+        return slow_path();
+    }
+
+    auto remaining = str;
+    size_t matched = 0;
+
+    // Same as to_string, uses a2 directly
+    if (const auto number = this->a2; number != 0) {
+        // "_" + (number - 1), written backwards into a stack buffer
+        wchar_t buffer[16]{};
+        size_t len = 0;
+
+        const auto value = (int64_t)number - 1;
+        auto digits = (uint64_t)(value < 0 ? -value : value);
+
+        do {
+            buffer[std::size(buffer) - ++len] = L'0' + (wchar_t)(digits % 10);
+            digits /= 10;
+        } while (digits != 0);
+
+        if (value < 0) {
+            buffer[std::size(buffer) - ++len] = L'-';
+        }
 
-            std::string narrow_result{};
-            narrow_result.resize(len);
-            memcpy(narrow_result.data(), name_entry->ansi_name, len);
+        buffer[std::size(buffer) - ++len] = L'_';
 
-            if (this->a2 != 0) {
-                narrow_result += "_" + std::to_string(this->a2 - 1);
+        if (!remaining.ends_with(std::wstring_view{&buffer[std::size(buffer) - len], len})) {
+            return std::nullopt;
+        }
+
+        remaining.remove_suffix(len);
+        matched += len;
+    }
+
+    const auto len = name_entry->len;
+
+    if (remaining.size() < len) {
+        return std::nullopt;
+    }
+
+    const auto tail = remaining.substr(remaining.size() - len);
+
+    if (name_entry->wide) {
+        if (tail != name_entry->wide_name()) {
+            return std::nullopt;
+        }
+
+        return matched + len;
+    }
+
+    const auto ansi_name = name_entry->ansi_name();
+
+    for (uint32_t i = 0; i < len; ++i) {
+        const auto c = (uint8_t)ansi_name[i];
+
+        // widen() might not map this 1:1, compare against the decoded name instead
+        if (c >= 0x80) {
+            const auto decoded = pool->get_name(this->a1);
+
+            if (!decoded || tail != *decoded) {
+                return std::nullopt;
             }
 
-            return utility::widen(narrow_result);
-        } catch(...) {
-            return std::wstring{};
+            return matched + len;
+        }
+
+        if (tail[i] != (wchar_t)c) {
+            return std::nullopt;
         }
-    } else {
-        // The usual non-inlined version
-        fn(this, &buffer);
     }
 
-    if (buffer.data != nullptr && buffer.count > 0) {
-        return buffer.data;
+    return matched + len;
+} catch(...) {
+    return std::nullopt;
+}
+
+void FName::append_to(std::wstring& out) const {
+    const auto pool = FNamePool::get();
+
+    if (pool == nullptr) {
+        out += to_string();
+        return;
     }
 
-    return std::wstring{};
+    if (const auto name = pool->get_name(this->a1); name.has_value()) {
+        out += *name;
+    }
+
+    if (this->a2 != 0) {
+        out += L'_';
+        out += std::to_wstring(this->a2 - 1);
+    }
 }
 
 std::wstring FName::to_string_remove_numbers() const {
@@ -7,6 +7,8 @@
 #include "TArray.hpp"
 
 namespace sdk {
+struct FNameCasePreserving;
+
 enum EFindName {
     Find,
     Add
@@ -27,8 +29,15 @@ struct FName {
         
     }
     FName(std::wstring_view name, EFindName find_type = EFindName::Add);
+
+    // Looks up an existing name without adding it, name doesn't need to be null terminated.
+    // Result is None if it isn't in the pool, std::nullopt if there's no constructor to call
+    static std::optional<FNameCasePreserving> find(std::wstring_view name);
     std::wstring to_string() const;
 
+    // Appends to_string() onto out, skips the temporary when the name pool is available
+    void append_to(std::wstring& out) const;
+
     // Version meant to be used when bruteforcing through memory
     // usually through UObjectArray initialization
     // Has some extra checks to make sure we don't crash when calling to_string
@@ -59,6 +68,15 @@ struct FName {
 
     std::wstring to_string_remove_numbers() const;
 
+    // Checks if str ends with this name (number suffix included) without building a string
+    // when the name pool is available. Returns how many characters of str were matched.
+    std::optional<size_t> match_end(std::wstring_view str) const;
+
+    bool equals(std::wstring_view str) const {
+        const auto matched = match_end(str);
+        return matched.has_value() && *matched == str.size();
+    }
+
     int32_t get_number() const {
         if (s_is_case_preserving) {
             return *(int32_t*)((uintptr_t)&a2 + 4);
@@ -0,0 +1,123 @@
+#include <mutex>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+#include <utility/String.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include "FNamePool.hpp"
+#include "FNameLiteral.hpp"
+
+namespace sdk {
+void FNameLiteral::resolve_all() {
+    ZoneScopedN("sdk::FNameLiteral::resolve_all");
+
+    static std::mutex resolve_mutex{};
+    std::scoped_lock _{resolve_mutex};
+
+    // Taken before looking anything up, so names added while we're at it still count as new next time
+    if (const auto cursor = get_name_pool_cursor(); cursor.has_value()) {
+        s_resolved_cursor.store(*cursor, std::memory_order_relaxed);
+    }
+
+    const auto constructor = FName::get_constructor();
+
+    size_t num_resolved = 0;
+    size_t num_missing = 0;
+
+    for (auto literal = s_head.load(std::memory_order_acquire); literal != nullptr; literal = literal->m_next) {
+        if (literal->m_state.load(std::memory_order_acquire) == State::RESOLVED) {
+            continue;
+        }
+
+        const auto previous = literal->m_state.load(std::memory_order_acquire);
+
+        if (!constructor) {
+            literal->m_state.store(State::UNAVAILABLE, std::memory_order_release);
+            continue;
+        }
+
+        try {
+            // Big enough for either layout, we pick the number at compare time
+            FNameCasePreserving fname{};
+            (*constructor)(&fname, literal->m_name.data(), static_cast<uint32_t>(EFindName::Find));
+
+            if (fname.a1 == 0 && literal->m_name != L"None") {
+                ++num_missing;
+                literal->m_state.store(State::MISSING, std::memory_order_release);
+                continue;
+            }
+
+            literal->m_index = fname.a1;
+            literal->m_a2 = fname.a2;
+            literal->m_a3 = fname.a3;
+            literal->m_state.store(State::RESOLVED, std::memory_order_release);
+
+            ++num_resolved;
+        } catch(...) {
+            // Gets retried, no need to say so every time
+            if (previous != State::UNAVAILABLE) {
+                SPDLOG_ERROR("[FNameLiteral::resolve_all] Failed to resolve {}, will retry", utility::narrow(literal->m_name));
+            }
+
+            literal->m_state.store(State::UNAVAILABLE, std::memory_order_release);
+        }
+    }
+
+    if (!constructor) {
+        static bool reported_unavailable = false;
+
+        if (!std::exchange(reported_unavailable, true)) {
+            SPDLOG_ERROR("[FNameLiteral::resolve_all] No FName constructor, literals will compare by string");
+        }
+
+        return;
+    }
+
+    // Missing ones get retried every so often, only worth saying so again when something new resolved
+    static bool reported = false;
+
+    if (num_resolved > 0 || (num_missing > 0 && !std::exchange(reported, true))) {
+        SPDLOG_INFO("[FNameLiteral::resolve_all] Resolved {} literals ({} not in the name pool yet)", num_resolved, num_missing);
+    }
+}
+
+bool FNameLiteral::should_retry(bool needs_new_names) try {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(RETRY_INTERVAL).count();
+
+    auto last = s_last_retry.load(std::memory_order_relaxed);
+
+    if (now - last < interval) {
+        return false;
+    }
+
+    // Only one thread gets to retry per interval, everyone else keeps comparing strings in the meantime
+    if (!s_last_retry.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    if (!needs_new_names) {
+        return true;
+    }
+
+    // Nothing was added to the pool, so nothing that was missing can be there now.
+    // Without a pool to look at there's no telling, so just retry
+    const auto cursor = get_name_pool_cursor();
+
+    return !cursor.has_value() || *cursor != s_resolved_cursor.load(std::memory_order_relaxed);
+} catch(...) {
+    return false;
+}
+
+std::optional<uint64_t> FNameLiteral::get_name_pool_cursor() {
+    const auto pool = FNamePool::get();
+
+    if (pool == nullptr) {
+        return std::nullopt;
+    }
+
+    return ((uint64_t)pool->get_current_block() << 32) | pool->get_current_byte_cursor();
+}
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+#include "FName.hpp"
+
+namespace sdk {
+// Compile time string usable as a template argument, narrow literals get widened (ASCII only)
+template<size_t N>
+struct FixedString {
+    wchar_t data[N]{};
+
+    consteval FixedString(const wchar_t (&str)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = str[i];
+        }
+    }
+
+    consteval FixedString(const char (&str)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            // Widening a UTF-8 byte on its own gives garbage, use a wide literal (L"...") for those.
+            // Throwing in a consteval turns this into a compile error
+            if ((unsigned char)str[i] > 0x7F) {
+                throw "narrow FName literals have to be ASCII";
+            }
+
+            data[i] = (wchar_t)str[i];
+        }
+    }
+
+    constexpr std::wstring_view view() const {
+        return std::wstring_view{data, N - 1};
+    }
+};
+
+template<size_t N> FixedString(const wchar_t (&)[N]) -> FixedString<N>;
+template<size_t N> FixedString(const char (&)[N]) -> FixedString<N>;
+
+// FName known at compile time. Every instance registers itself at startup and they all get
+// resolved to comparison indices in one batch, after that comparing against an FName is just integer compares.
+// Use it through the _fname literal: if (prop_c->get_name() == "BoolProperty"_fname)
+class FNameLiteral {
+public:
+    FNameLiteral(std::wstring_view name)
+        : m_name{name}
+    {
+        m_next = s_head.load(std::memory_order_relaxed);
+        while (!s_head.compare_exchange_weak(m_next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    FNameLiteral(const FNameLiteral&) = delete;
+    FNameLiteral& operator=(const FNameLiteral&) = delete;
+
+    // Wait at least this long between retrying literals that weren't in the name pool or couldn't be looked up
+    constexpr static inline auto RETRY_INTERVAL = std::chrono::milliseconds{250};
+
+    // Resolves anything that hasn't been yet (missing and unavailable ones included), gets called at the end of FUObjectArray init,
+    // lazily the first time an unresolved literal gets compared, and again for the others every so often
+    static void resolve_all();
+
+    // Resolves everything pending if this one hasn't been looked at yet, if it was missing and names could have been
+    // added since (e.g. a Blueprint loaded after startup), or if looking it up failed last time (e.g. the pool wasn't set up yet)
+    bool ensure_resolved() const {
+        auto state = m_state.load(std::memory_order_acquire);
+
+        if (state == State::UNRESOLVED ||
+            (state == State::MISSING && should_retry(true)) ||
+            (state == State::UNAVAILABLE && should_retry(false)))
+        {
+            resolve_all();
+            state = m_state.load(std::memory_order_acquire);
+        }
+
+        return state == State::RESOLVED;
+    }
+
+    bool matches(const FName& name) const {
+        if (ensure_resolved()) {
+            return name.a1 == m_index && name.get_number() == get_number();
+        }
+
+        // Not in the name pool (yet) or no constructor, compare the string instead
+        return name.equals(m_name);
+    }
+
+    bool is_resolved() const {
+        return m_state.load(std::memory_order_acquire) == State::RESOLVED;
+    }
+
+    std::wstring_view get_name() const {
+        return m_name;
+    }
+
+    // Only meaningful once resolved
+    int32_t get_index() const {
+        return m_index;
+    }
+
+    int32_t get_number() const {
+        return FName::s_is_case_preserving ? m_a3 : m_a2;
+    }
+
+    friend bool operator==(const FName& name, const FNameLiteral& literal) {
+        return literal.matches(name);
+    }
+
+private:
+    enum class State : uint8_t {
+        UNRESOLVED,
+        RESOLVED,
+        MISSING,
+        UNAVAILABLE
+    };
+
+    // Rate limited. With needs_new_names it's also false if the name pool is known not to have grown since the last resolve_all
+    static bool should_retry(bool needs_new_names);
+
+    // Where the name pool's allocator was at, std::nullopt if there's no pool to look at (pre 4.23)
+    static std::optional<uint64_t> get_name_pool_cursor();
+
+    static constinit inline std::atomic<FNameLiteral*> s_head{nullptr};
+    static constinit inline std::atomic<int64_t> s_last_retry{0}; // steady_clock ticks
+    static constinit inline std::atomic<uint64_t> s_resolved_cursor{0}; // name pool cursor as of the last resolve_all
+
+    std::wstring_view m_name{}; // always null terminated, points into the template argument
+    FNameLiteral* m_next{nullptr};
+
+    std::atomic<State> m_state{State::UNRESOLVED};
+    int32_t m_index{0};
+    int32_t m_a2{0}; // number when not case preserving
+    int32_t m_a3{0}; // number when case preserving
+};
+
+namespace detail {
+template<FixedString S>
+inline FNameLiteral fname_literal{S.view()};
+}
+}
+
+template<sdk::FixedString S>
+const sdk::FNameLiteral& operator""_fname() {
+    return sdk::detail::fname_literal<S>;
+}
\ No newline at end of file
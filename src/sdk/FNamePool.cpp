@@ -0,0 +1,177 @@
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <utility/String.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include "FName.hpp"
+#include "FNamePool.hpp"
+
+namespace sdk {
+namespace detail {
+// Found alongside ToString in FName.cpp
+extern std::optional<uintptr_t> s_init_name_pool;
+extern std::optional<uintptr_t> s_name_pool;
+}
+
+std::wstring FNameEntryView::decode() const {
+    if (wide) {
+        return std::wstring{wide_name()};
+    }
+
+    const auto name = ansi_name();
+
+    // Plain ASCII can skip the conversion
+    if (std::all_of(name.begin(), name.end(), [](char c) { return (uint8_t)c < 0x80; })) {
+        return std::wstring{name.begin(), name.end()};
+    }
+
+    return utility::widen(name);
+}
+
+FNamePool* FNamePool::get() {
+    static auto result = []() -> std::unique_ptr<FNamePool> {
+        ZoneScopedN("sdk::FNamePool::get static init");
+
+        // The pool gets located as part of this
+        FName::get_to_string();
+
+        if (!detail::s_init_name_pool || !detail::s_name_pool) {
+            SPDLOG_INFO("[FNamePool::get] Name pool not found, using ToString");
+            return nullptr;
+        }
+
+        SPDLOG_INFO("[FNamePool::get] Reading names from pool at 0x{:x}", *detail::s_name_pool);
+        return std::make_unique<FNamePool>(*detail::s_name_pool);
+    }();
+
+    return result.get();
+}
+
+FNamePool::FNamePool(uintptr_t address)
+    : m_address{address},
+    m_cache{std::make_unique<BlockTable>()}
+{
+}
+
+FNamePool::~FNamePool() {
+    for (auto& table_slot : *m_cache) {
+        const auto table = table_slot.load();
+
+        if (table == nullptr) {
+            continue;
+        }
+
+        for (auto& page_slot : *table) {
+            const auto page = page_slot.load();
+
+            if (page == nullptr) {
+                continue;
+            }
+
+            for (auto& name : *page) {
+                delete name.load();
+            }
+
+            delete page;
+        }
+
+        delete table;
+    }
+}
+
+std::optional<FNameEntryView> FNamePool::get_entry(int32_t comparison_index) const try {
+    const auto block_index = (uint32_t)comparison_index >> BLOCK_OFFSET_BITS;
+    const auto offset = (uint32_t)comparison_index & ((1 << BLOCK_OFFSET_BITS) - 1);
+
+    if (block_index >= MAX_BLOCKS) {
+        return std::nullopt;
+    }
+
+    // Don't trust these if they look off, older layouts might not match
+    if (const auto current_block = get_current_block(); current_block < MAX_BLOCKS) {
+        if (block_index > current_block) {
+            return std::nullopt;
+        }
+
+        if (block_index == current_block && offset * STRIDE >= get_current_byte_cursor()) {
+            return std::nullopt;
+        }
+    }
+
+    const auto block = get_blocks()[block_index];
+
+    if (block == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto entry = block + (offset * STRIDE);
+    const auto header = *(const FNameEntryHeader*)entry;
+
+    return FNameEntryView{
+        header.wide != 0,
+        (uint16_t)std::min<uint32_t>(header.len, MAX_NAME_LENGTH),
+        entry + sizeof(FNameEntryHeader)
+    };
+} catch(...) {
+    return std::nullopt;
+}
+
+template<typename T>
+T* FNamePool::get_or_create(std::atomic<T*>& slot) {
+    auto result = slot.load(std::memory_order_acquire);
+
+    if (result != nullptr) {
+        return result;
+    }
+
+    auto fresh = new T{};
+
+    // Someone else got there first, use theirs
+    if (!slot.compare_exchange_strong(result, fresh, std::memory_order_acq_rel)) {
+        delete fresh;
+        return result;
+    }
+
+    return fresh;
+}
+
+std::optional<std::wstring_view> FNamePool::get_name(int32_t comparison_index) const {
+    const auto block_index = (uint32_t)comparison_index >> BLOCK_OFFSET_BITS;
+    const auto offset = (uint32_t)comparison_index & ((1 << BLOCK_OFFSET_BITS) - 1);
+
+    if (block_index >= MAX_BLOCKS) {
+        return std::nullopt;
+    }
+
+    // Only look, nothing gets allocated for an index until it turns out to be real
+    if (const auto table = (*m_cache)[block_index].load(std::memory_order_acquire); table != nullptr) {
+        if (const auto page = (*table)[offset >> PAGE_BITS].load(std::memory_order_acquire); page != nullptr) {
+            if (const auto cached = (*page)[offset & (PAGE_SIZE - 1)].load(std::memory_order_acquire); cached != nullptr) {
+                return std::wstring_view{*cached};
+            }
+        }
+    }
+
+    // Offset brute forcing throws plenty of garbage indices at us, those shouldn't cost a cache page each
+    const auto entry = get_entry(comparison_index);
+
+    if (!entry) {
+        return std::nullopt;
+    }
+
+    const auto table = get_or_create((*m_cache)[block_index]);
+    const auto page = get_or_create((*table)[offset >> PAGE_BITS]);
+    auto& slot = (*page)[offset & (PAGE_SIZE - 1)];
+
+    auto decoded = std::make_unique<std::wstring>(entry->decode());
+    const std::wstring* existing = nullptr;
+
+    if (!slot.compare_exchange_strong(existing, decoded.get(), std::memory_order_acq_rel)) {
+        return std::wstring_view{*existing};
+    }
+
+    return std::wstring_view{*decoded.release()};
+}
+}
\ No newline at end of file
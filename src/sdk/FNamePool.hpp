@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace sdk {
+// Case preserving not supported atm
+struct FNameEntryHeader {
+    uint16_t wide : 1;
+    uint16_t hash : 5;
+    uint16_t len : 10;
+};
+
+// Points straight into the name pool, nothing is copied
+struct FNameEntryView {
+    bool wide{false};
+    uint16_t len{0};
+    const void* data{nullptr};
+
+    std::string_view ansi_name() const {
+        return wide ? std::string_view{} : std::string_view{(const char*)data, len};
+    }
+
+    std::wstring_view wide_name() const {
+        return wide ? std::wstring_view{(const wchar_t*)data, len} : std::wstring_view{};
+    }
+
+    std::wstring decode() const;
+};
+
+// Reads entries out of the engine's FNamePool (4.23+) without going through FName::ToString
+// The address is the start of the pool, which is where its FNameEntryAllocator lives
+class FNamePool {
+public:
+    // Only available if the pool was found while looking for ToString
+    static FNamePool* get();
+
+    FNamePool(uintptr_t address);
+    ~FNamePool();
+
+    FNamePool(const FNamePool&) = delete;
+    FNamePool& operator=(const FNamePool&) = delete;
+
+    std::optional<FNameEntryView> get_entry(int32_t comparison_index) const;
+
+    // Widened name without the number suffix, decoded once per comparison index
+    // Readers never lock, the view is valid for as long as this object is alive
+    std::optional<std::wstring_view> get_name(int32_t comparison_index) const;
+
+    uintptr_t get_address() const {
+        return m_address;
+    }
+
+    uint32_t get_current_block() const {
+        return *(uint32_t*)(m_address + sizeof(void*));
+    }
+
+    uint32_t get_current_byte_cursor() const {
+        return *(uint32_t*)(m_address + sizeof(void*) + sizeof(uint32_t));
+    }
+
+    const uint8_t* const* get_blocks() const {
+        return (const uint8_t* const*)(m_address + (sizeof(void*) * 2));
+    }
+
+public:
+    constexpr static inline auto MAX_BLOCKS = 1 << 13;
+    constexpr static inline auto BLOCK_OFFSET_BITS = 16;
+    constexpr static inline auto STRIDE = alignof(FNameEntryHeader);
+    constexpr static inline auto MAX_NAME_LENGTH = 1024;
+
+private:
+    constexpr static inline auto PAGE_BITS = 8;
+    constexpr static inline auto PAGE_SIZE = 1 << PAGE_BITS;
+    constexpr static inline auto PAGES_PER_BLOCK = (1 << BLOCK_OFFSET_BITS) / PAGE_SIZE;
+
+    // block -> page -> decoded name, every level only ever gets filled in, never replaced
+    using Page = std::array<std::atomic<const std::wstring*>, PAGE_SIZE>;
+    using PageTable = std::array<std::atomic<Page*>, PAGES_PER_BLOCK>;
+    using BlockTable = std::array<std::atomic<PageTable*>, MAX_BLOCKS>;
+
+    template<typename T>
+    static T* get_or_create(std::atomic<T*>& slot);
+
+    uintptr_t m_address{0};
+    std::unique_ptr<BlockTable> m_cache{};
+};
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include <utility/String.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
 
 #include "FRenderTargetPool.hpp"
 
@@ -27,7 +29,7 @@ std::optional<uintptr_t> FRenderTargetPool::get_find_free_element_fn() {
             }
 
             // Other strings can be used if this one falls flat later on
-            const auto scene_depth_z_strs = utility::scan_strings(module, L"SceneDepthZ", true);
+            const auto scene_depth_z_strs = sdk::ModuleStrings::get(module).find_all(L"SceneDepthZ", true);
 
             if (scene_depth_z_strs.empty()) {
                 SPDLOG_ERROR("Failed to find SceneDepthZ string");
@@ -39,7 +41,7 @@ std::optional<uintptr_t> FRenderTargetPool::get_find_free_element_fn() {
             for (auto scene_depth_z_str : scene_depth_z_strs) {
                 SPDLOG_INFO("Found SceneDepthZ string at {:x}", scene_depth_z_str);
 
-                const auto scene_depth_z_ref = utility::scan_displacement_reference(module, scene_depth_z_str);
+                const auto scene_depth_z_ref = sdk::XrefIndex::get(module).find(scene_depth_z_str);
 
                 if (!scene_depth_z_ref) {
                     SPDLOG_ERROR("Failed to find reference to SceneDepthZ string");
@@ -8,6 +8,9 @@
 
 #include "Utility.hpp"
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "Memory.hpp"
 #include "FSceneView.hpp"
 
 namespace sdk {
@@ -38,7 +41,7 @@ std::optional<uintptr_t> FSceneView::get_constructor_address() {
         // ADDENDUM: We are only finding the references for "r.TranslucentSortPolicy" now
         // we are still making use of "vr.InstancedStereo" but we are checking whether instructions
         // reference data that == L"vr.InstancedStereo" instead of checking for the string reference itself
-        const auto translucent_strings = utility::scan_strings(module, L"r.TranslucentSortPolicy");
+        const auto translucent_strings = sdk::ModuleStrings::get(module).find_all(L"r.TranslucentSortPolicy");
 
         if (translucent_strings.empty()) {
             SPDLOG_ERROR("[FSceneView] Failed to find string references for FSceneView constructor");
@@ -52,7 +55,7 @@ std::optional<uintptr_t> FSceneView::get_constructor_address() {
         for (const auto& translucent_string : translucent_strings) {
             SPDLOG_INFO("[FSceneView] Found r.TranslucentSortPolicy string at 0x{:x}", translucent_string);
 
-            const auto translucent_string_refs_ = utility::scan_displacement_references(module, translucent_string);
+            const auto translucent_string_refs_ = sdk::XrefIndex::get(module).find_all(translucent_string);
 
             translucent_string_refs.insert(translucent_string_refs.end(), translucent_string_refs_.begin(), translucent_string_refs_.end());
         }
@@ -118,7 +121,7 @@ std::optional<uintptr_t> FSceneView::get_constructor_address() {
                 try {
                     const auto potential_string = (wchar_t*)*displacement;
 
-                    if (IsBadReadPtr(potential_string, target_length)) {
+                    if (!memory::is_readable(potential_string, target_length)) {
                         return utility::ExhaustionResult::CONTINUE;
                     }
 
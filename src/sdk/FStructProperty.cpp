@@ -8,6 +8,7 @@
 #include "ScriptMatrix.hpp"
 #include "FProperty.hpp"
 
+#include "Memory.hpp"
 #include "FStructProperty.hpp"
 
 namespace sdk {
@@ -50,10 +51,10 @@ void FStructProperty::bruteforce_struct_offset(FProperty* xplane_prop, FProperty
         const auto z_struct = *(UScriptStruct**)((uintptr_t)zplane_prop + i);
         const auto w_struct = *(UScriptStruct**)((uintptr_t)wplane_prop + i);
 
-        if (x_struct == nullptr || IsBadReadPtr(x_struct, sizeof(void*)) ||
-            y_struct == nullptr || IsBadReadPtr(y_struct, sizeof(void*)) ||
-            z_struct == nullptr || IsBadReadPtr(z_struct, sizeof(void*)) ||
-            w_struct == nullptr || IsBadReadPtr(w_struct, sizeof(void*))) 
+        if (x_struct == nullptr || !memory::is_readable(x_struct, sizeof(void*)) ||
+            y_struct == nullptr || !memory::is_readable(y_struct, sizeof(void*)) ||
+            z_struct == nullptr || !memory::is_readable(z_struct, sizeof(void*)) ||
+            w_struct == nullptr || !memory::is_readable(w_struct, sizeof(void*))) 
         {
             continue;
         }
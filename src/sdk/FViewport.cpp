@@ -1,4 +1,5 @@
 #include <array>
+#include <mutex>
 #include <spdlog/spdlog.h>
 
 #include <bdshemu.h>
@@ -6,6 +7,8 @@
 #include <utility/Emulation.hpp>
 #include <utility/Module.hpp>
 
+#include "EngineModule.hpp"
+#include "DiscoveryCache.hpp"
 #include "UGameViewportClient.hpp"
 
 #include "FViewport.hpp"
@@ -14,7 +17,7 @@ namespace sdk {
 namespace detail {
 std::optional<size_t> debug_canvas_index{};
 std::optional<size_t> viewport_size_xy_index{};
-bool already_updated{false};
+std::once_flag update_once{}; // the getters can be hit from several threads at startup
 
 bool all_indices_found() {
     return debug_canvas_index.has_value() && viewport_size_xy_index.has_value();
@@ -22,12 +25,21 @@ bool all_indices_found() {
 
 // Not a lambda because it makes the try catch block cleaner, less indentation
 void update() try {
-    if (already_updated) {
+    auto& cache = DiscoveryCache::get();
+    const auto engine = sdk::get_ue_module(L"Engine");
+
+    const auto cached_debug_canvas = cache.get_value("FViewport::GetDebugCanvasIndex", engine);
+    const auto cached_viewport_size_xy = cache.get_value("FViewport::GetViewportSizeXYIndex", engine);
+
+    // Nothing to check these against short of emulating Draw again, so just make sure they're sane
+    if (cached_debug_canvas && cached_viewport_size_xy && *cached_debug_canvas < 200 && *cached_viewport_size_xy < 200) {
+        debug_canvas_index = (size_t)*cached_debug_canvas;
+        viewport_size_xy_index = (size_t)*cached_viewport_size_xy;
+
+        SPDLOG_INFO("[FViewport] Using cached indices (GetDebugCanvas {}, GetViewportSizeXY {})", *debug_canvas_index, *viewport_size_xy_index);
         return;
     }
 
-    already_updated = true;
-
     SPDLOG_INFO("[FViewport] Finding GetDebugCanvas and GetViewportSizeXY indices...");
 
     // The code that calls InViewport->GetDebugCanvas() is in UGameViewportClient::Draw, so we need to find that function first
@@ -139,19 +151,24 @@ void update() try {
     if (!viewport_size_xy_index) {
         SPDLOG_ERROR("[FViewport] Failed to find GetViewportSizeXY index");
     }
+
+    if (all_indices_found()) {
+        cache.set_value("FViewport::GetDebugCanvasIndex", *debug_canvas_index, engine);
+        cache.set_value("FViewport::GetViewportSizeXYIndex", *viewport_size_xy_index, engine);
+    }
 } catch(...) {
     SPDLOG_ERROR("[FViewport] Failed to find GetDebugCanvas index, exception occurred during scan");
 }
 }
 
 std::optional<size_t> FViewport::get_debug_canvas_index() {
-    detail::update();
+    std::call_once(detail::update_once, detail::update);
 
     return detail::debug_canvas_index;
 }
 
 std::optional<size_t> FViewport::get_viewport_size_xy_index() {
-    detail::update();
+    std::call_once(detail::update_once, detail::update);
 
     return detail::viewport_size_xy_index;
 }
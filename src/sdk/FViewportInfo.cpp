@@ -8,6 +8,7 @@
 #include <utility/Module.hpp>
 #include <utility/Scan.hpp>
 
+#include "Memory.hpp"
 #include "FViewportInfo.hpp"
 
 namespace sdk {
@@ -25,21 +26,21 @@ IViewportRenderTargetProvider* FViewportInfo::get_rt_provider(FRHITexture2D* kno
 
             const auto ptr = *(uintptr_t*)((uintptr_t)this + i);
 
-            if (ptr == 0 || IsBadReadPtr((void*)ptr, sizeof(void*))) {
+            if (ptr == 0 || !memory::is_readable((void*)ptr, sizeof(void*))) {
                 SPDLOG_INFO("  Invalid pointer at offset 0x{:x}", i);
                 continue;
             }
 
             const auto vtable = *(uintptr_t*)ptr;
 
-            if (vtable == 0 || IsBadReadPtr((void*)vtable, sizeof(void*))) {
+            if (vtable == 0 || !memory::is_readable((void*)vtable, sizeof(void*))) {
                 SPDLOG_INFO("  Invalid vtable at offset 0x{:x}", i);
                 continue;
             }
 
             const auto first_func = *(uintptr_t*)vtable;
 
-            if (first_func == 0 || IsBadReadPtr((void*)first_func, sizeof(void*))) {
+            if (first_func == 0 || !memory::is_readable((void*)first_func, sizeof(void*))) {
                 SPDLOG_INFO("  Invalid first function at offset 0x{:x}", i);
                 continue;
             }
@@ -85,7 +86,7 @@ IViewportRenderTargetProvider* FViewportInfo::get_rt_provider(FRHITexture2D* kno
 
             const auto rax = emu.ctx->Registers.RegRax;
 
-            if (rax != 0 && !IsBadReadPtr((void*)rax, sizeof(void*) + 0x20)) {
+            if (rax != 0 && memory::is_readable((void*)rax, sizeof(void*) + 0x20)) {
                 const auto resource = (sdk::FSlateResource*)rax;
 
                 if (auto result = utility::scan_ptr((uintptr_t)resource + sizeof(void*), 0x20, (uintptr_t)known_tex)) {
@@ -5,6 +5,9 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "Memory.hpp"
 #include "Globals.hpp"
 
 namespace sdk {
@@ -19,14 +22,14 @@ float& get_near_clipping_plane() {
         SPDLOG_INFO("Attempting to find GNearClippingPlane");
 
         const auto engine = sdk::get_ue_module(L"Engine");
-        const auto bEnableOnScreenDebugMessages_str = utility::scan_string(engine, L"bEnableOnScreenDebugMessages", true);
+        const auto bEnableOnScreenDebugMessages_str = sdk::ModuleStrings::get(engine).find(L"bEnableOnScreenDebugMessages", true);
 
         if (!bEnableOnScreenDebugMessages_str) {
             SPDLOG_ERROR("Failed to find bEnableOnScreenDebugMessages string, cannot find GNearClippingPlane");
             return nullptr;
         }
 
-        const auto bEnableOnScreenDebugMessages_ref = utility::scan_displacement_reference(engine, *bEnableOnScreenDebugMessages_str);
+        const auto bEnableOnScreenDebugMessages_ref = sdk::XrefIndex::get(engine).find(*bEnableOnScreenDebugMessages_str);
 
         if (!bEnableOnScreenDebugMessages_ref) {
             SPDLOG_ERROR("Failed to find reference to bEnableOnScreenDebugMessages string, cannot find GNearClippingPlane");
@@ -99,10 +102,10 @@ float& get_near_clipping_plane() {
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
-                if (!IsBadReadPtr((void*)*last_ptr_store, sizeof(uintptr_t)) && !IsBadReadPtr(*(void**)*last_ptr_store, sizeof(uintptr_t))) { // means it's a modular build
+                if (memory::is_readable((void*)*last_ptr_store, sizeof(uintptr_t)) && memory::is_readable(*(void**)*last_ptr_store, sizeof(uintptr_t))) { // means it's a modular build
                     last_ptr_store = *(uintptr_t*)*last_ptr_store;
 
-                    if (!IsBadReadPtr((void*)*last_ptr_store, sizeof(uintptr_t)) && !IsBadReadPtr(*(void**)*last_ptr_store, sizeof(uintptr_t))) { // Means it's now the wrong pointer, it should just be a float at this point, not a valid pointer
+                    if (memory::is_readable((void*)*last_ptr_store, sizeof(uintptr_t)) && memory::is_readable(*(void**)*last_ptr_store, sizeof(uintptr_t))) { // Means it's now the wrong pointer, it should just be a float at this point, not a valid pointer
                         last_ptr_store = orig_store;
                         return utility::ExhaustionResult::CONTINUE;
                     }
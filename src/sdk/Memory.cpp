@@ -0,0 +1,149 @@
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "Memory.hpp"
+
+namespace sdk {
+namespace memory {
+std::vector<common::MemoryRegion> VirtualQueryProvider::snapshot() {
+    ZoneScopedN("sdk::memory::VirtualQueryProvider::snapshot");
+
+    SYSTEM_INFO si{};
+    GetSystemInfo(&si);
+
+    std::vector<common::MemoryRegion> result{};
+
+    auto address = (uintptr_t)si.lpMinimumApplicationAddress;
+    const auto max_address = (uintptr_t)si.lpMaximumApplicationAddress;
+
+    while (address < max_address) {
+        MEMORY_BASIC_INFORMATION mbi{};
+
+        if (VirtualQuery((void*)address, &mbi, sizeof(mbi)) == 0 || mbi.RegionSize == 0) {
+            break;
+        }
+
+        // Unreadable ones too, so lookups that land in them don't have to ask again
+        if (const auto region = to_region(mbi); region.has_value()) {
+            result.push_back(*region);
+        }
+
+        address = (uintptr_t)mbi.BaseAddress + mbi.RegionSize;
+    }
+
+    return result;
+}
+
+std::optional<common::MemoryRegion> VirtualQueryProvider::query(uintptr_t address) {
+    MEMORY_BASIC_INFORMATION mbi{};
+
+    if (VirtualQuery((void*)address, &mbi, sizeof(mbi)) == 0) {
+        return std::nullopt;
+    }
+
+    return to_region(mbi);
+}
+
+std::optional<common::MemoryRegion> VirtualQueryProvider::to_region(const MEMORY_BASIC_INFORMATION& mbi) {
+    constexpr auto readable_mask = PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY
+                                 | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY;
+
+    common::MemoryRegion region{};
+    region.start = (uintptr_t)mbi.BaseAddress;
+    region.size = mbi.RegionSize;
+    region.readable = mbi.State == MEM_COMMIT
+                    && (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS)) == 0
+                    && (mbi.Protect & readable_mask) != 0;
+
+    return region;
+}
+
+common::MemoryRegionMap& get_region_map() {
+    // Leaked on purpose, other threads can still be checking pointers at exit
+    static auto map = new common::MemoryRegionMap{std::make_unique<VirtualQueryProvider>()};
+    return *map;
+}
+
+bool is_readable(const void* address, size_t size) try {
+    return get_region_map().is_readable(address, size);
+} catch(...) {
+    return false;
+}
+
+std::unique_ptr<common::MemoryBackend> make_in_process_backend() {
+    return std::make_unique<common::InProcessBackend>([](uintptr_t address, size_t size) {
+        return is_readable((const void*)address, size);
+    });
+}
+
+std::unique_ptr<common::CachedBackend> make_process_backend(HANDLE process) {
+    return std::make_unique<common::CachedBackend>([process](uintptr_t address, void* out, size_t size) {
+        SIZE_T bytes_read{};
+        return ReadProcessMemory(process, (const void*)address, out, size, &bytes_read) != FALSE && bytes_read == size;
+    });
+}
+
+std::unique_ptr<DumpBackend> DumpBackend::open(const std::filesystem::path& path) try {
+    ZoneScopedN("sdk::memory::DumpBackend::open");
+
+    std::unique_ptr<DumpBackend> result{new DumpBackend{}};
+
+    result->m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (result->m_file == INVALID_HANDLE_VALUE) {
+        SPDLOG_ERROR("[DumpBackend::open] Failed to open {}", path.string());
+        return nullptr;
+    }
+
+    LARGE_INTEGER file_size{};
+
+    if (!GetFileSizeEx(result->m_file, &file_size) || file_size.QuadPart == 0) {
+        return nullptr;
+    }
+
+    result->m_mapping = CreateFileMappingW(result->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (result->m_mapping == nullptr) {
+        SPDLOG_ERROR("[DumpBackend::open] Failed to map {}", path.string());
+        return nullptr;
+    }
+
+    // Mapping the whole thing is fine, the OS only pages in what gets read
+    result->m_view = MapViewOfFile(result->m_mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (result->m_view == nullptr) {
+        SPDLOG_ERROR("[DumpBackend::open] Failed to map a view of {}", path.string());
+        return nullptr;
+    }
+
+    result->m_image = common::ImageBackend::from_minidump({(const uint8_t*)result->m_view, (size_t)file_size.QuadPart});
+
+    if (!result->m_image.has_value()) {
+        SPDLOG_ERROR("[DumpBackend::open] {} is not a minidump with memory in it", path.string());
+        return nullptr;
+    }
+
+    SPDLOG_INFO("[DumpBackend::open] Opened {} ({} memory ranges)", path.string(), result->m_image->get_segments().size());
+
+    return result;
+} catch(...) {
+    SPDLOG_ERROR("[DumpBackend::open] Exception occurred");
+    return nullptr;
+}
+
+DumpBackend::~DumpBackend() {
+    if (m_view != nullptr) {
+        UnmapViewOfFile(m_view);
+    }
+
+    if (m_mapping != nullptr) {
+        CloseHandle(m_mapping);
+    }
+
+    if (m_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_file);
+    }
+}
+}
+}
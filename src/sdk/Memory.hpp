@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <optional>
+#include <filesystem>
+
+#include <windows.h>
+
+#include "common/MemoryBackend.hpp"
+#include "common/MemoryRegionMap.hpp"
+
+// Cheap replacement for IsBadReadPtr, for the loops that poke at thousands of
+// candidate pointers while brute forcing offsets
+namespace sdk {
+namespace memory {
+class VirtualQueryProvider : public common::MemoryRegionProvider {
+public:
+    std::vector<common::MemoryRegion> snapshot() override;
+    std::optional<common::MemoryRegion> query(uintptr_t address) override;
+
+private:
+    static std::optional<common::MemoryRegion> to_region(const MEMORY_BASIC_INFORMATION& mbi);
+};
+
+common::MemoryRegionMap& get_region_map();
+
+// Same answer as !IsBadReadPtr(address, size) most of the time, minus the page probing
+bool is_readable(const void* address, size_t size);
+
+// Backends for FUObjectArrayReader and friends.
+// In process reads check is_readable first, other processes go through ReadProcessMemory with a page cache in front
+std::unique_ptr<common::MemoryBackend> make_in_process_backend();
+std::unique_ptr<common::CachedBackend> make_process_backend(HANDLE process);
+
+// A minidump mapped read-only, the memory list in it is what gets read
+class DumpBackend : public common::MemoryBackend {
+public:
+    using MemoryBackend::read;
+
+    static std::unique_ptr<DumpBackend> open(const std::filesystem::path& path);
+
+    DumpBackend(const DumpBackend&) = delete;
+    DumpBackend& operator=(const DumpBackend&) = delete;
+    virtual ~DumpBackend();
+
+    bool read(uintptr_t address, void* out, size_t size) override {
+        return m_image->read(address, out, size);
+    }
+
+private:
+    DumpBackend() = default;
+
+    HANDLE m_file{INVALID_HANDLE_VALUE};
+    HANDLE m_mapping{nullptr};
+    const void* m_view{nullptr};
+    std::optional<common::ImageBackend> m_image{};
+};
+}
+}
@@ -0,0 +1,235 @@
+#include <cstring>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <utility/Module.hpp>
+#include <utility/String.hpp>
+
+#include "ModuleRegistry.hpp"
+
+namespace sdk {
+bool ModuleInfo::is_code(uintptr_t address) const {
+    return std::any_of(code.begin(), code.end(), [&](const ModuleSection& section) {
+        return section.contains(address);
+    });
+}
+
+std::optional<uintptr_t> ModuleInfo::find_export(std::string_view name) const {
+    const auto it = exports.find(std::string{name});
+
+    if (it == exports.end()) {
+        return std::nullopt;
+    }
+
+    return it->second;
+}
+
+std::vector<ModuleSection> ModuleInfo::get_initialized_data() const {
+    auto result = readonly_data;
+    result.insert(result.end(), writable_data.begin(), writable_data.end());
+
+    std::sort(result.begin(), result.end(), [](const ModuleSection& a, const ModuleSection& b) {
+        return a.start < b.start;
+    });
+
+    return result;
+}
+
+const ModuleInfo* ModuleRegistry::get(HMODULE module) {
+    if (module == nullptr) {
+        return nullptr;
+    }
+
+    // Leaked on purpose, scanners on other threads can still be holding onto these at exit
+    static auto infos = new std::unordered_map<HMODULE, std::unique_ptr<ModuleInfo>>{};
+
+    std::scoped_lock _{s_mutex};
+
+    if (const auto it = infos->find(module); it != infos->end()) {
+        return it->second.get();
+    }
+
+    auto info = build(module);
+    const auto result = info.get();
+
+    // Failures get remembered too, it's not going to turn into a PE image later
+    infos->emplace(module, std::move(info));
+
+    return result;
+}
+
+HMODULE ModuleRegistry::find_ue_module(std::wstring_view name) {
+    static auto found = new std::unordered_map<std::wstring, HMODULE>{};
+
+    const auto key = std::wstring{name};
+
+    {
+        std::scoped_lock _{s_mutex};
+
+        if (const auto it = found->find(key); it != found->end()) {
+            return it->second;
+        }
+    }
+
+    const auto result = find_ue_module_uncached(key);
+
+    // Falling back to the executable on a modular build can just mean it hasn't been loaded yet
+    if (result != utility::get_executable() || get_flavor() == BuildFlavor::MONOLITHIC) {
+        std::scoped_lock _{s_mutex};
+        found->emplace(key, result);
+    }
+
+    return result;
+}
+
+BuildFlavor ModuleRegistry::get_flavor() {
+    static const auto flavor = []() -> BuildFlavor {
+        const auto exe_name = utility::get_module_pathw(utility::get_executable());
+
+        if (exe_name && (exe_name->ends_with(L"UnrealEditor.exe") || exe_name->ends_with(L"UE4Editor.exe"))) {
+            SPDLOG_INFO("[ModuleRegistry::get_flavor] Editor build");
+            return BuildFlavor::EDITOR;
+        }
+
+        if (utility::find_partial_module(L"-Core-Win64-Shipping.dll") != nullptr) {
+            SPDLOG_INFO("[ModuleRegistry::get_flavor] Modular shipping build");
+            return BuildFlavor::SHIPPING;
+        }
+
+        SPDLOG_INFO("[ModuleRegistry::get_flavor] Monolithic build");
+        return BuildFlavor::MONOLITHIC;
+    }();
+
+    return flavor;
+}
+
+HMODULE ModuleRegistry::find_ue_module_uncached(const std::wstring& name) {
+    const auto current_executable = utility::get_executable();
+    const auto exe_name = utility::get_module_pathw(current_executable);
+
+    if (exe_name && exe_name->ends_with(L"UnrealEditor.exe")) {
+        const auto mod = utility::find_partial_module(L"UnrealEditor-" + name + L".dll");
+
+        if (mod != nullptr) {
+            return mod;
+        }
+    }
+
+    if (exe_name && exe_name->ends_with(L"UE4Editor.exe")) {
+        const auto mod = utility::find_partial_module(L"UE4Editor-" + name + L".dll");
+
+        if (mod != nullptr) {
+            return mod;
+        }
+    }
+
+    const auto partial_module = utility::find_partial_module(L"-" + name + L"-Win64-Shipping.dll");
+
+    if (partial_module != nullptr) {
+        return partial_module;
+    }
+
+    return current_executable;
+}
+
+std::unique_ptr<ModuleInfo> ModuleRegistry::build(HMODULE module) try {
+    const auto base = (uintptr_t)module;
+    const auto dos = (IMAGE_DOS_HEADER*)base;
+
+    if (dos->e_magic != IMAGE_DOS_SIGNATURE) {
+        return nullptr;
+    }
+
+    const auto nt = (IMAGE_NT_HEADERS*)(base + dos->e_lfanew);
+
+    if (nt->Signature != IMAGE_NT_SIGNATURE) {
+        return nullptr;
+    }
+
+    auto info = std::make_unique<ModuleInfo>();
+    info->handle = module;
+    info->base = base;
+    info->size = nt->OptionalHeader.SizeOfImage;
+    info->path = utility::get_module_pathw(module).value_or(L"");
+
+    const auto sections = IMAGE_FIRST_SECTION(nt);
+
+    for (WORD i = 0; i < nt->FileHeader.NumberOfSections; ++i) {
+        const auto& header = sections[i];
+
+        if (header.VirtualAddress >= info->size) {
+            continue;
+        }
+
+        ModuleSection section{};
+        section.name = std::string{(const char*)header.Name, strnlen((const char*)header.Name, sizeof(header.Name))};
+        section.start = base + header.VirtualAddress;
+        section.size = std::min<size_t>(header.Misc.VirtualSize != 0 ? header.Misc.VirtualSize : header.SizeOfRawData, info->size - header.VirtualAddress);
+        section.characteristics = header.Characteristics;
+
+        info->sections.push_back(section);
+
+        const auto readable = (header.Characteristics & IMAGE_SCN_MEM_READ) != 0;
+        const auto executable = (header.Characteristics & IMAGE_SCN_MEM_EXECUTE) != 0;
+        const auto writable = (header.Characteristics & IMAGE_SCN_MEM_WRITE) != 0;
+        const auto initialized = (header.Characteristics & IMAGE_SCN_CNT_INITIALIZED_DATA) != 0;
+        const auto discardable = (header.Characteristics & IMAGE_SCN_MEM_DISCARDABLE) != 0;
+
+        if (executable) {
+            info->code.push_back(section);
+        } else if (readable && initialized && !discardable) {
+            (writable ? info->writable_data : info->readonly_data).push_back(section);
+        }
+    }
+
+    for (auto list : { &info->sections, &info->code, &info->readonly_data, &info->writable_data }) {
+        std::sort(list->begin(), list->end(), [](const ModuleSection& a, const ModuleSection& b) {
+            return a.start < b.start;
+        });
+    }
+
+    const auto& exception_directory = nt->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXCEPTION];
+
+    if (exception_directory.VirtualAddress != 0 && exception_directory.VirtualAddress + exception_directory.Size <= info->size) {
+        info->functions = std::span<const RUNTIME_FUNCTION>{
+            (const RUNTIME_FUNCTION*)(base + exception_directory.VirtualAddress),
+            exception_directory.Size / sizeof(RUNTIME_FUNCTION)
+        };
+    }
+
+    const auto& export_directory = nt->OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+
+    if (export_directory.VirtualAddress != 0 && export_directory.VirtualAddress + export_directory.Size <= info->size) {
+        const auto exports = (IMAGE_EXPORT_DIRECTORY*)(base + export_directory.VirtualAddress);
+        const auto names = (const DWORD*)(base + exports->AddressOfNames);
+        const auto ordinals = (const WORD*)(base + exports->AddressOfNameOrdinals);
+        const auto functions = (const DWORD*)(base + exports->AddressOfFunctions);
+
+        info->exports.reserve(exports->NumberOfNames);
+
+        for (DWORD i = 0; i < exports->NumberOfNames; ++i) {
+            if (ordinals[i] >= exports->NumberOfFunctions) {
+                continue;
+            }
+
+            const auto rva = functions[ordinals[i]];
+
+            // Points back into the export directory, it's a "module.function" string for another module
+            if (rva >= export_directory.VirtualAddress && rva < export_directory.VirtualAddress + export_directory.Size) {
+                continue;
+            }
+
+            info->exports.emplace((const char*)(base + names[i]), base + rva);
+        }
+    }
+
+    SPDLOG_INFO("[ModuleRegistry::build] {} at {:x}: {} sections ({} code, {} rdata, {} data), {} functions, {} exports",
+        utility::narrow(info->path), base, info->sections.size(), info->code.size(), info->readonly_data.size(), info->writable_data.size(),
+        info->functions.size(), info->exports.size());
+
+    return info;
+} catch(...) {
+    SPDLOG_ERROR("[ModuleRegistry::build] Failed to parse module at {:x}", (uintptr_t)module);
+    return nullptr;
+}
+}
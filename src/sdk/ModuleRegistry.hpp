@@ -0,0 +1,86 @@
+#pragma once
+
+#include <span>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include <windows.h>
+
+namespace sdk {
+struct ModuleSection {
+    std::string name{};
+    uintptr_t start{0};
+    size_t size{0};
+    uint32_t characteristics{0};
+
+    uintptr_t end() const {
+        return start + size;
+    }
+
+    bool contains(uintptr_t address) const {
+        return address >= start && address < end();
+    }
+
+    std::span<const uint8_t> bytes() const {
+        return { (const uint8_t*)start, size };
+    }
+};
+
+// Everything the scanners want to know about a module, worked out once from its PE headers
+struct ModuleInfo {
+    HMODULE handle{};
+    uintptr_t base{0};
+    size_t size{0};
+    std::wstring path{};
+
+    // All in address order
+    std::vector<ModuleSection> sections{};
+    std::vector<ModuleSection> code{}; // executable (.text and friends)
+    std::vector<ModuleSection> readonly_data{}; // initialized, not writable, not executable (.rdata)
+    std::vector<ModuleSection> writable_data{}; // initialized, writable, not executable (.data)
+
+    std::span<const RUNTIME_FUNCTION> functions{}; // .pdata
+    std::unordered_map<std::string, uintptr_t> exports{}; // forwarded exports left out
+
+    bool contains(uintptr_t address) const {
+        return address >= base && address < base + size;
+    }
+
+    bool is_code(uintptr_t address) const;
+    std::optional<uintptr_t> find_export(std::string_view name) const;
+
+    // readonly_data and writable_data merged, where string literals can live
+    std::vector<ModuleSection> get_initialized_data() const;
+};
+
+enum class BuildFlavor : uint8_t {
+    MONOLITHIC, // everything in the executable
+    SHIPPING, // "{game}-{name}-Win64-Shipping.dll"
+    EDITOR, // "UnrealEditor-{name}.dll" / "UE4Editor-{name}.dll"
+};
+
+// Parses each module once and hands the same ModuleInfo to everyone after that,
+// and remembers which module get_ue_module picked for each name.
+class ModuleRegistry {
+public:
+    // nullptr if there's no PE image there. Never changes once built
+    static const ModuleInfo* get(HMODULE module);
+
+    // Backs get_ue_module. Only misses on modular builds are re-checked, the module might just not be loaded yet
+    static HMODULE find_ue_module(std::wstring_view name);
+
+    static BuildFlavor get_flavor();
+
+private:
+    static std::unique_ptr<ModuleInfo> build(HMODULE module);
+    static HMODULE find_ue_module_uncached(const std::wstring& name);
+
+    static inline std::mutex s_mutex{};
+};
+}
@@ -0,0 +1,225 @@
+#include <chrono>
+#include <memory>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <utility/Scan.hpp>
+#include <utility/String.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include "common/StringScanner.hpp"
+
+#include "ModuleRegistry.hpp"
+#include "ModuleStrings.hpp"
+
+namespace sdk {
+ModuleStrings& ModuleStrings::get(HMODULE module) {
+    // Leaked on purpose, scans can still be going on other threads at exit
+    static auto mutex = new std::mutex{};
+    static auto instances = new std::unordered_map<HMODULE, std::unique_ptr<ModuleStrings>>{};
+
+    std::scoped_lock _{*mutex};
+
+    auto& instance = (*instances)[module];
+
+    if (instance == nullptr) {
+        instance.reset(new ModuleStrings{module});
+    }
+
+    return *instance;
+}
+
+std::vector<ModuleStrings::Needle>& ModuleStrings::get_known() {
+    // Everything the SDK looks up by string in some module
+    static std::vector<Needle> known = [] {
+        std::vector<Needle> result{};
+
+        for (const auto str : {
+            L"NullDrvFailure",
+            L"FTagMetaData",
+            L"FNavigationMetaData",
+            L" Bone: %s, Look At Location : %s, Target Location : %s)",
+            L"Commandlet %s finished execution (result %d)",
+            L"TAutoWeakObjectPtr<%s%s>",
+            L"SceneDepthZ",
+            L"r.TranslucentSortPolicy",
+            L"bEnableOnScreenDebugMessages",
+            L"PC_InputComponent0",
+            L"emulatestereo",
+            L"UEngine::Tick",
+            L"causeevent=",
+            L"CanvasObject",
+            L"/Temp/%s",
+            L"r.DumpingMovie",
+            L"vr.pixeldensity",
+            L"Current detail mode;",
+            L"r.EnableStereoEmulation",
+            L"Slate.DrawToVRRenderTarget",
+            L"r.OneFrameThreadLag",
+            L"++UE",
+            L"++ue",
+        }) {
+            result.push_back(Needle{ common::StringScanner::to_bytes(std::wstring_view{str}), sizeof(char16_t) });
+        }
+
+        return result;
+    }();
+
+    return known;
+}
+
+void ModuleStrings::add_known(std::wstring_view str) {
+    std::scoped_lock _{s_known_mutex};
+
+    auto& known = get_known();
+    const auto needle = Needle{ common::StringScanner::to_bytes(str), sizeof(char16_t) };
+
+    if (std::find(known.begin(), known.end(), needle) == known.end()) {
+        known.push_back(needle);
+    }
+}
+
+void ModuleStrings::add_known(std::string_view str) {
+    std::scoped_lock _{s_known_mutex};
+
+    auto& known = get_known();
+    const auto needle = Needle{ common::StringScanner::to_bytes(str), sizeof(char) };
+
+    if (std::find(known.begin(), known.end(), needle) == known.end()) {
+        known.push_back(needle);
+    }
+}
+
+std::optional<uintptr_t> ModuleStrings::find(std::wstring_view str, bool zero_terminated) {
+    const auto result = find_all(str, zero_terminated);
+
+    if (result.empty()) {
+        return std::nullopt;
+    }
+
+    return result.front();
+}
+
+std::optional<uintptr_t> ModuleStrings::find(std::string_view str, bool zero_terminated) {
+    const auto result = find_all(str, zero_terminated);
+
+    if (result.empty()) {
+        return std::nullopt;
+    }
+
+    return result.front();
+}
+
+std::vector<uintptr_t> ModuleStrings::find_all(std::wstring_view str, bool zero_terminated) {
+    if (m_module == nullptr) {
+        return {};
+    }
+
+    // Too short to be hashed, not worth batching either
+    if (str.size() * sizeof(char16_t) < common::StringScanner::MIN_NEEDLE_SIZE) {
+        return utility::scan_strings(m_module, std::wstring{str}, zero_terminated);
+    }
+
+    return find_all(Needle{ common::StringScanner::to_bytes(str), sizeof(char16_t) }, zero_terminated);
+}
+
+std::vector<uintptr_t> ModuleStrings::find_all(std::string_view str, bool zero_terminated) {
+    if (m_module == nullptr) {
+        return {};
+    }
+
+    if (str.size() < common::StringScanner::MIN_NEEDLE_SIZE) {
+        return utility::scan_strings(m_module, std::string{str}, zero_terminated);
+    }
+
+    return find_all(Needle{ common::StringScanner::to_bytes(str), sizeof(char) }, zero_terminated);
+}
+
+std::vector<uintptr_t> ModuleStrings::find_all(const Needle& needle, bool zero_terminated) {
+    std::scoped_lock _{m_mutex};
+
+    auto it = m_results.find(needle.bytes);
+
+    if (it == m_results.end()) {
+        scan_locked(needle);
+        it = m_results.find(needle.bytes);
+    }
+
+    std::vector<uintptr_t> result{};
+
+    if (it == m_results.end()) {
+        return result;
+    }
+
+    for (const auto& match : it->second) {
+        if (!zero_terminated || match.zero_terminated) {
+            result.push_back(match.address);
+        }
+    }
+
+    return result;
+}
+
+void ModuleStrings::scan_locked(const Needle& needle) try {
+    ZoneScopedN("sdk::ModuleStrings::scan_locked");
+
+    const auto now = std::chrono::steady_clock::now();
+
+    const auto info = ModuleRegistry::get(m_module);
+
+    if (info == nullptr) {
+        SPDLOG_ERROR("[ModuleStrings::scan_locked] {:x} is not a module", (uintptr_t)m_module);
+        return;
+    }
+
+    common::StringScanner scanner{};
+    std::vector<Needle> batch{};
+
+    const auto add = [&](const Needle& n) {
+        if (m_results.contains(n.bytes) || std::find(batch.begin(), batch.end(), n) != batch.end()) {
+            return;
+        }
+
+        if (scanner.add(n.bytes)) {
+            batch.push_back(n);
+        }
+    };
+
+    add(needle);
+
+    {
+        std::scoped_lock __{s_known_mutex};
+
+        for (const auto& known : get_known()) {
+            add(known);
+        }
+    }
+
+    // Everything in the batch gets an entry, a miss is just as final as a hit
+    for (const auto& n : batch) {
+        m_results[n.bytes];
+    }
+
+    for (const auto& section_info : info->get_initialized_data()) {
+        const auto section = section_info.bytes();
+
+        scanner.scan(section, [&](size_t id, size_t offset) {
+            const auto& n = batch[id];
+            const auto end = offset + n.bytes.size();
+
+            Match match{};
+            match.address = (uintptr_t)section.data() + offset;
+            match.zero_terminated = end + n.char_size <= section.size() &&
+                std::all_of(section.begin() + end, section.begin() + end + n.char_size, [](uint8_t b) { return b == 0; });
+
+            m_results[n.bytes].push_back(match);
+        });
+    }
+
+    SPDLOG_INFO("[ModuleStrings::scan_locked] Scanned {:x} for {} strings in {}ms",
+        (uintptr_t)m_module, batch.size(), std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - now).count());
+} catch(...) {
+    SPDLOG_ERROR("[ModuleStrings::scan_locked] Exception occurred while scanning {:x}", (uintptr_t)m_module);
+}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include <windows.h>
+
+namespace sdk {
+// String lookups in a module's data sections, batched.
+// The first lookup in a module scans for every string the SDK is known to look for (plus the one asked for)
+// in a single pass over its initialized, non-executable sections and keeps all of the results,
+// so the other lookups in that module are just a map lookup instead of another walk over the whole image.
+// Strings nobody knew about up front get batched together with any other pending ones into another pass.
+// Results are in address order, same as utility::scan_string(s) would give.
+class ModuleStrings {
+public:
+    // Always hands back something, a nullptr module just never finds anything
+    static ModuleStrings& get(HMODULE module);
+
+    std::optional<uintptr_t> find(std::wstring_view str, bool zero_terminated = false);
+    std::optional<uintptr_t> find(std::string_view str, bool zero_terminated = false);
+    std::vector<uintptr_t> find_all(std::wstring_view str, bool zero_terminated = false);
+    std::vector<uintptr_t> find_all(std::string_view str, bool zero_terminated = false);
+
+    // Gets included in the next pass over every module
+    static void add_known(std::wstring_view str);
+    static void add_known(std::string_view str);
+
+private:
+    struct Needle {
+        std::string bytes{};
+        size_t char_size{1};
+
+        bool operator==(const Needle& other) const = default;
+    };
+
+    struct Match {
+        uintptr_t address{};
+        bool zero_terminated{false};
+    };
+
+    ModuleStrings(HMODULE module)
+        : m_module{module}
+    {
+    }
+
+    std::vector<uintptr_t> find_all(const Needle& needle, bool zero_terminated);
+    void scan_locked(const Needle& needle);
+
+    static std::vector<Needle>& get_known();
+
+    HMODULE m_module{};
+
+    std::mutex m_mutex{};
+    std::unordered_map<std::string, std::vector<Match>> m_results{}; // keyed on the needle's bytes
+
+    static inline std::mutex s_known_mutex{};
+};
+}
@@ -0,0 +1,124 @@
+#include <bit>
+#include <algorithm>
+
+#include "UFunction.hpp"
+#include "FField.hpp"
+#include "FProperty.hpp"
+#include "UProperty.hpp"
+
+#include "ParamFrame.hpp"
+
+namespace sdk {
+ParamArena& ParamArena::get() {
+    static thread_local ParamArena arena{};
+    return arena;
+}
+
+void* ParamArena::push(size_t size, size_t alignment) {
+    const auto fits = [&](Block& block) -> uint8_t* {
+        const auto base = (uintptr_t)block.data.get();
+        const auto start = ((base + block.used + alignment - 1) & ~(alignment - 1)) - base;
+
+        if (start + size > block.size) {
+            return nullptr;
+        }
+
+        block.used = start + size;
+        return block.data.get() + start;
+    };
+
+    if (!m_blocks.empty()) {
+        if (const auto result = fits(m_blocks[m_current]); result != nullptr) {
+            return result;
+        }
+
+        // Anything past the current block is free, reuse the next one if it's big enough
+        if (m_current + 1 < m_blocks.size()) {
+            auto& next = m_blocks[m_current + 1];
+            next.used = 0;
+
+            if (const auto result = fits(next); result != nullptr) {
+                ++m_current;
+                return result;
+            }
+        }
+    }
+
+    // Frames still live in the earlier blocks so those stay, only the free ones past us get replaced
+    const auto previous_size = m_blocks.empty() ? 0 : m_blocks.back().size;
+    const auto block_size = std::max({MIN_BLOCK_SIZE, previous_size * 2, std::bit_ceil(size + alignment)});
+
+    Block block{};
+    block.data = std::make_unique<uint8_t[]>(block_size);
+    block.size = block_size;
+
+    const auto index = m_blocks.empty() ? 0 : m_current + 1;
+
+    m_blocks.resize(index);
+    m_blocks.push_back(std::move(block));
+    m_current = index;
+
+    return fits(m_blocks[m_current]);
+}
+
+ParamFrame::ParamFrame(UFunction* fn) {
+    auto& arena = ParamArena::get();
+    m_marker = arena.mark();
+
+    if (fn == nullptr) {
+        return;
+    }
+
+    m_size = get_frame_size(fn);
+
+    if (m_size == 0) {
+        return;
+    }
+
+    size_t alignment = 16;
+
+    if (const auto min_alignment = fn->get_min_alignment(); min_alignment > 0 && min_alignment <= 64 && std::has_single_bit((uint32_t)min_alignment)) {
+        alignment = std::max<size_t>(alignment, min_alignment);
+    }
+
+    m_data = (uint8_t*)arena.push(m_size, alignment);
+    std::memset(m_data, 0, m_size);
+}
+
+int32_t ParamFrame::find_offset(UFunction* fn, std::wstring_view name) {
+    if (fn == nullptr) {
+        return -1;
+    }
+
+    if (const auto prop = fn->find_property(name); prop != nullptr) {
+        return prop->get_offset();
+    }
+
+    if (const auto prop = fn->find_uproperty(name); prop != nullptr) {
+        return prop->get_offset();
+    }
+
+    return -1;
+}
+
+size_t ParamFrame::get_frame_size(UFunction* fn) try {
+    if (fn == nullptr) {
+        return 0;
+    }
+
+    if (const auto properties_size = fn->get_properties_size(); properties_size > 0 && properties_size <= 0x10000) {
+        return (size_t)properties_size;
+    }
+
+    // PropertiesSize is off, pad generously past the last parameter instead
+    int32_t max_offset = 0;
+
+    for (auto param = fn->get_child_properties(); param != nullptr; param = param->get_next()) {
+        max_offset = std::max(max_offset, ((FProperty*)param)->get_offset());
+    }
+
+    return (size_t)max_offset + 0x400;
+} catch(...) {
+    return 0;
+}
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "Math.hpp"
+
+namespace sdk {
+class UFunction;
+
+// Per thread stack of memory for ProcessEvent parameter blobs.
+// Frames are released in reverse order (ParamFrame does that), so after the first few calls
+// on a thread nothing gets allocated anymore, nested ProcessEvents just go further up the stack.
+class ParamArena {
+public:
+    struct Marker {
+        size_t block{0};
+        size_t used{0};
+    };
+
+    static ParamArena& get();
+
+    void* push(size_t size, size_t alignment);
+
+    Marker mark() const {
+        if (m_blocks.empty()) {
+            return Marker{};
+        }
+
+        return Marker{ m_current, m_blocks[m_current].used };
+    }
+
+    void release(const Marker& marker) {
+        if (m_blocks.empty()) {
+            return;
+        }
+
+        m_current = marker.block;
+        m_blocks[m_current].used = marker.used;
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data{};
+        size_t size{0};
+        size_t used{0};
+    };
+
+    constexpr static inline size_t MIN_BLOCK_SIZE = 16 * 1024;
+
+    std::vector<Block> m_blocks{};
+    size_t m_current{0};
+};
+
+// Zeroed parameter blob for a UFunction, sized and aligned from its PropertiesSize/MinAlignment.
+// Lives on the thread's ParamArena until it goes out of scope.
+class ParamFrame {
+public:
+    ParamFrame(UFunction* fn);
+    ~ParamFrame() {
+        ParamArena::get().release(m_marker);
+    }
+
+    ParamFrame(const ParamFrame&) = delete;
+    ParamFrame& operator=(const ParamFrame&) = delete;
+
+    // Offset of the parameter called name, -1 if fn doesn't have one
+    static int32_t find_offset(UFunction* fn, std::wstring_view name);
+
+    // Size the frame needs, 0 if it doesn't look sane
+    static size_t get_frame_size(UFunction* fn);
+
+    bool is_valid() const {
+        return m_data != nullptr;
+    }
+
+    explicit operator bool() const {
+        return is_valid();
+    }
+
+    uint8_t* data() const {
+        return m_data;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+    // Writes with a negative offset (parameter wasn't found) are dropped
+    template<typename T>
+    void set(int32_t offset, const T& value) {
+        if (offset < 0 || (size_t)offset + sizeof(T) > m_size) {
+            return;
+        }
+
+        std::memcpy(m_data + offset, &value, sizeof(T));
+    }
+
+    template<typename T>
+    T get(int32_t offset) const {
+        T result{};
+
+        if (offset < 0 || (size_t)offset + sizeof(T) > m_size) {
+            return result;
+        }
+
+        std::memcpy(&result, m_data + offset, sizeof(T));
+        return result;
+    }
+
+    // FVector/FRotator, which are doubles on UE5
+    void set_vector(int32_t offset, const glm::vec3& value, bool is_double) {
+        if (is_double) {
+            set(offset, glm::vec<3, double>{value});
+        } else {
+            set(offset, value);
+        }
+    }
+
+    glm::vec3 get_vector(int32_t offset, bool is_double) const {
+        if (is_double) {
+            return glm::vec3{get<glm::vec<3, double>>(offset)};
+        }
+
+        return get<glm::vec3>(offset);
+    }
+
+private:
+    ParamArena::Marker m_marker{};
+    uint8_t* m_data{nullptr};
+    size_t m_size{0};
+};
+}
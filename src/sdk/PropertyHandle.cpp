@@ -0,0 +1,123 @@
+#include <spdlog/spdlog.h>
+
+#include <utility/String.hpp>
+
+#include "UClass.hpp"
+#include "FField.hpp"
+#include "FProperty.hpp"
+#include "UProperty.hpp"
+#include "FBoolProperty.hpp"
+#include "UBoolProperty.hpp"
+#include "FNameLiteral.hpp"
+
+#include "PropertyHandle.hpp"
+
+namespace sdk {
+PropertyView::PropertyView(const UStruct* owner, std::wstring_view name)
+    : m_owner{owner}
+{
+    if (owner == nullptr) {
+        return;
+    }
+
+    if (m_fproperty = owner->find_property(name); m_fproperty != nullptr) {
+        m_offset = m_fproperty->get_offset();
+        resolve_bool();
+    } else if (m_uproperty = owner->find_uproperty(name); m_uproperty != nullptr) {
+        m_offset = m_uproperty->get_offset();
+        resolve_ubool(m_uproperty);
+    } else {
+        SPDLOG_ERROR("[PropertyView] Failed to find {}", utility::narrow(name));
+    }
+}
+
+PropertyView::PropertyView(const UStruct* owner, const FName& name)
+    : m_owner{owner}
+{
+    if (owner == nullptr) {
+        return;
+    }
+
+    if (m_fproperty = owner->find_property(name); m_fproperty != nullptr) {
+        m_offset = m_fproperty->get_offset();
+        resolve_bool();
+    } else if (m_uproperty = owner->find_uproperty(name); m_uproperty != nullptr) {
+        m_offset = m_uproperty->get_offset();
+        resolve_ubool(m_uproperty);
+    } else {
+        SPDLOG_ERROR("[PropertyView] Failed to find {}", utility::narrow(name.to_string()));
+    }
+}
+
+PropertyView::PropertyView(const UStruct* owner, const FNameLiteral& name)
+    : m_owner{owner}
+{
+    if (owner == nullptr) {
+        return;
+    }
+
+    if (m_fproperty = owner->find_property(name); m_fproperty != nullptr) {
+        m_offset = m_fproperty->get_offset();
+        resolve_bool();
+    } else if (m_uproperty = owner->find_uproperty(name); m_uproperty != nullptr) {
+        m_offset = m_uproperty->get_offset();
+        resolve_ubool(m_uproperty);
+    } else {
+        SPDLOG_ERROR("[PropertyView] Failed to find {}", utility::narrow(name.get_name()));
+    }
+}
+
+void PropertyView::resolve_bool() {
+    // Before 4.25 the property chain is UProperties all the way down, even when it came through find_property
+    if (FField::is_ufield_only()) {
+        resolve_ubool((UProperty*)m_fproperty);
+        return;
+    }
+
+    const auto c = m_fproperty->get_class();
+
+    if (c == nullptr || c->get_name() != "BoolProperty"_fname) {
+        return;
+    }
+
+    FBoolProperty::update_offsets();
+
+    const auto prop = (FBoolProperty*)m_fproperty;
+
+    // Same as FBoolProperty::get_value_from_object. Works for native bools too, and for bitfields
+    // declared as wider types (uint32 bFoo : 1 has a FieldSize of 4) where reading a bool at the offset gets the wrong bit.
+    // If the offsets couldn't be found the mask stays 0 and it gets read as a plain bool
+    if (FBoolProperty::has_offsets() && prop->get_byte_mask() != 0) {
+        m_byte_offset = prop->get_byte_offset();
+        m_byte_mask = prop->get_byte_mask();
+    }
+}
+
+void PropertyView::resolve_ubool(UProperty* prop) {
+    const auto c = prop->get_class();
+
+    if (c == nullptr || c->get_fname() != "BoolProperty"_fname) {
+        return;
+    }
+
+    UBoolProperty::update_offsets();
+
+    const auto bool_prop = (UBoolProperty*)prop;
+
+    // Same deal as resolve_bool, the layout didn't change when UProperty became FProperty
+    if (UBoolProperty::has_offsets() && bool_prop->get_byte_mask() != 0) {
+        m_byte_offset = bool_prop->get_byte_offset();
+        m_byte_mask = bool_prop->get_byte_mask();
+    }
+}
+
+bool PropertyView::applies_to(const UObject* object) const {
+    if (object == nullptr || !is_valid()) {
+        return false;
+    }
+
+    const auto c = object->get_class();
+
+    return c != nullptr && c->is_a((UStruct*)m_owner);
+}
+}
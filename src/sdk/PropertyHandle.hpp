@@ -0,0 +1,185 @@
+#pragma once
+
+#include <span>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <string_view>
+
+#include "UObject.hpp"
+
+namespace sdk {
+class UStruct;
+class FProperty;
+class UProperty;
+class FNameLiteral;
+
+// Property on a struct resolved to an offset once, meant to be kept around (usually as a static)
+// and applied to as many objects as needed without going through find_property again.
+// The objects passed in are assumed to be instances of the owner (or a subclass), nothing checks that per object.
+class PropertyView {
+public:
+    PropertyView() = default;
+    PropertyView(const UStruct* owner, std::wstring_view name);
+    PropertyView(const UStruct* owner, const FName& name);
+    PropertyView(const UStruct* owner, const FNameLiteral& name);
+
+    bool is_valid() const {
+        return m_offset >= 0;
+    }
+
+    explicit operator bool() const {
+        return is_valid();
+    }
+
+    const UStruct* get_owner() const {
+        return m_owner;
+    }
+
+    // One of these is set depending on which chain it came from
+    FProperty* get_fproperty() const {
+        return m_fproperty;
+    }
+
+    UProperty* get_uproperty() const {
+        return m_uproperty;
+    }
+
+    int32_t get_offset() const {
+        return m_offset;
+    }
+
+    // Only set for BoolProperty, 0 otherwise
+    uint8_t get_byte_mask() const {
+        return m_byte_mask;
+    }
+
+    // Slower than the handle itself, but catches objects that don't have the property
+    bool applies_to(const UObject* object) const;
+
+    void* get_data(const UObject* object) const {
+        return (void*)((uintptr_t)object + m_offset);
+    }
+
+protected:
+    void resolve_bool();
+    void resolve_ubool(UProperty* prop);
+
+    const UStruct* m_owner{nullptr};
+    FProperty* m_fproperty{nullptr};
+    UProperty* m_uproperty{nullptr};
+    int32_t m_offset{-1};
+    uint8_t m_byte_offset{0};
+    uint8_t m_byte_mask{0};
+};
+
+// Typed PropertyView, T has to match the property's in-memory type.
+// bool handles understand bitfield BoolProperties, everything else is read as a plain T at the offset.
+// The span versions have no per object branching for trivially copyable types so they can get vectorized,
+// the spans must not contain null objects.
+template<typename T>
+class PropertyHandle : public PropertyView {
+public:
+    using PropertyView::PropertyView;
+
+    T& get(UObject* object) const requires (!std::is_same_v<T, bool>) {
+        return *(T*)get_data(object);
+    }
+
+    const T& get(const UObject* object) const requires (!std::is_same_v<T, bool>) {
+        return *(const T*)get_data(object);
+    }
+
+    T read(const UObject* object) const {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (m_byte_mask != 0) {
+                return (*(const uint8_t*)((uintptr_t)object + m_offset + m_byte_offset) & m_byte_mask) != 0;
+            }
+        }
+
+        return *(const T*)get_data(object);
+    }
+
+    void write(UObject* object, const T& value) const {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (m_byte_mask != 0) {
+                auto& byte = *(uint8_t*)((uintptr_t)object + m_offset + m_byte_offset);
+                byte = (byte & ~m_byte_mask) | (value ? m_byte_mask : 0);
+                return;
+            }
+        }
+
+        *(T*)get_data(object) = value;
+    }
+
+    // Gathers the property from every object into out, out needs to be at least objects.size()
+    void read(std::span<UObject* const> objects, std::span<T> out) const {
+        const auto count = std::min(objects.size(), out.size());
+        const auto offset = (uintptr_t)m_offset;
+
+        if constexpr (std::is_same_v<T, bool>) {
+            if (m_byte_mask != 0) {
+                const auto byte_offset = offset + m_byte_offset;
+                const auto mask = m_byte_mask;
+
+                for (size_t i = 0; i < count; ++i) {
+                    out[i] = (*(const uint8_t*)((uintptr_t)objects[i] + byte_offset) & mask) != 0;
+                }
+
+                return;
+            }
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            const auto dst = out.data();
+            const auto src = objects.data();
+
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy(&dst[i], (const void*)((uintptr_t)src[i] + offset), sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = *(const T*)((uintptr_t)objects[i] + offset);
+            }
+        }
+    }
+
+    // Scatters values[i] into objects[i]
+    void write(std::span<UObject* const> objects, std::span<const T> values) const {
+        const auto count = std::min(objects.size(), values.size());
+
+        if constexpr (std::is_same_v<T, bool>) {
+            if (m_byte_mask != 0) {
+                for (size_t i = 0; i < count; ++i) {
+                    write(objects[i], values[i]);
+                }
+
+                return;
+            }
+        }
+
+        const auto offset = (uintptr_t)m_offset;
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            const auto src = values.data();
+            const auto dst = objects.data();
+
+            for (size_t i = 0; i < count; ++i) {
+                std::memcpy((void*)((uintptr_t)dst[i] + offset), &src[i], sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                *(T*)((uintptr_t)objects[i] + offset) = values[i];
+            }
+        }
+    }
+
+    // Same value into every object
+    void write(std::span<UObject* const> objects, const T& value) const {
+        for (const auto object : objects) {
+            write(object, value);
+        }
+    }
+};
+}
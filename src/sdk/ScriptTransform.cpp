@@ -13,26 +13,32 @@ sdk::UScriptStruct* ScriptTransform::static_struct() {
 }
 
 std::vector<uint8_t> ScriptTransform::create_dynamic_struct(const glm::vec3& location, const glm::vec4& rotation, const glm::vec3& scale) {
-    static const bool is_ue5 = ScriptVector::static_struct()->get_struct_size() == sizeof(glm::vec<3, double>);
-
     std::vector<uint8_t> out{};
     out.insert(out.end(), static_struct()->get_struct_size(), 0);
 
+    write_to(out.data(), location, rotation, scale);
+
+    return out;
+}
+
+void ScriptTransform::write_to(void* out, const glm::vec3& location, const glm::vec4& rotation, const glm::vec3& scale) {
+    static const bool is_ue5 = ScriptVector::static_struct()->get_struct_size() == sizeof(glm::vec<3, double>);
+
     // quaternion, vec3, vec3
     static const auto quat_offset = static_struct()->find_property(L"Rotation")->get_offset();
     static const auto loc_offset = static_struct()->find_property(L"Translation")->get_offset();
     static const auto scale_offset = static_struct()->find_property(L"Scale3D")->get_offset();
 
+    const auto data = (uint8_t*)out;
+
     if (is_ue5) {
-        *(glm::vec<4, double>*)(out.data() + quat_offset) = rotation;
-        *(glm::vec<3, double>*)(out.data() + loc_offset) = location;
-        *(glm::vec<3, double>*)(out.data() + scale_offset) = scale;
+        *(glm::vec<4, double>*)(data + quat_offset) = rotation;
+        *(glm::vec<3, double>*)(data + loc_offset) = location;
+        *(glm::vec<3, double>*)(data + scale_offset) = scale;
     } else {
-        *(glm::vec4*)(out.data() + quat_offset) = rotation;
-        *(glm::vec3*)(out.data() + loc_offset) = location;
-        *(glm::vec3*)(out.data() + scale_offset) = scale;
+        *(glm::vec4*)(data + quat_offset) = rotation;
+        *(glm::vec3*)(data + loc_offset) = location;
+        *(glm::vec3*)(data + scale_offset) = scale;
     }
-
-    return out;
 }
 }
\ No newline at end of file
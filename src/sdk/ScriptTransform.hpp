@@ -12,6 +12,9 @@ public:
 
     static std::vector<uint8_t> create_dynamic_struct(const glm::vec3& location, const glm::vec4& rotation, const glm::vec3& scale);
 
+    // Same as create_dynamic_struct but into existing memory, out needs to be at least get_struct_size() bytes
+    static void write_to(void* out, const glm::vec3& location, const glm::vec4& rotation, const glm::vec3& scale);
+
 protected:
 };
 }
\ No newline at end of file
@@ -0,0 +1,576 @@
+#include <regex>
+#include <chrono>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <utility/Scan.hpp>
+#include <utility/Module.hpp>
+#include <utility/String.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include "EngineModule.hpp"
+#include "ModuleRegistry.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "UObjectScan.hpp"
+#include "Memory.hpp"
+
+#include "SignatureDatabase.hpp"
+
+namespace sdk {
+namespace steps {
+SignatureStep string(std::wstring_view str, bool zero_terminated) {
+    return SignatureStep{
+        "string(" + utility::narrow(std::wstring{str}) + (zero_terminated ? ",0)" : ")"),
+        [str = std::wstring{str}, zero_terminated](HMODULE module, uintptr_t) {
+            return ModuleStrings::get(module).find_all(str, zero_terminated);
+        }
+    };
+}
+
+SignatureStep pattern(std::string_view pattern) {
+    return SignatureStep{
+        "pattern(" + std::string{pattern} + ")",
+        [pattern = std::string{pattern}](HMODULE module, uintptr_t) {
+            std::vector<uintptr_t> result{};
+
+            const auto info = ModuleRegistry::get(module);
+
+            if (info == nullptr) {
+                return result;
+            }
+
+            for (const auto& section : info->code) {
+                for (auto match = utility::scan(section.start, section.size, pattern); match; match = utility::scan(*match + 1, section.end() - (*match + 1), pattern)) {
+                    result.push_back(*match);
+                }
+            }
+
+            return result;
+        }
+    };
+}
+
+SignatureStep xrefs() {
+    return SignatureStep{
+        "xrefs",
+        [](HMODULE module, uintptr_t address) {
+            return XrefIndex::get(module).find_all(address);
+        }
+    };
+}
+
+SignatureStep instruction() {
+    return SignatureStep{
+        "instruction",
+        [](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            const auto resolved = utility::resolve_instruction(address);
+
+            if (!resolved) {
+                return {};
+            }
+
+            return { resolved->addr };
+        }
+    };
+}
+
+SignatureStep offset(int64_t delta) {
+    return SignatureStep{
+        "offset(" + std::to_string(delta) + ")",
+        [delta](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            return { (uintptr_t)((int64_t)address + delta) };
+        }
+    };
+}
+
+SignatureStep scan_mnemonic(std::string_view mnemonic, size_t max_bytes) {
+    return SignatureStep{
+        "scan_mnemonic(" + std::string{mnemonic} + "," + std::to_string(max_bytes) + ")",
+        [mnemonic = std::string{mnemonic}, max_bytes](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            const auto result = utility::scan_mnemonic(address, max_bytes, mnemonic);
+
+            if (!result) {
+                return {};
+            }
+
+            return { *result };
+        }
+    };
+}
+
+SignatureStep find_instructions(std::string_view description, size_t max_instructions, std::function<bool(const INSTRUX&)> predicate) {
+    return SignatureStep{
+        "find_instructions(" + std::string{description} + "," + std::to_string(max_instructions) + ")",
+        [max_instructions, predicate](HMODULE, uintptr_t address) {
+            std::vector<uintptr_t> result{};
+            auto ip = (uint8_t*)address;
+
+            for (size_t i = 0; i < max_instructions; ++i) {
+                const auto ix = utility::decode_one(ip);
+
+                if (!ix) {
+                    break;
+                }
+
+                if (predicate(*ix)) {
+                    result.push_back((uintptr_t)ip);
+                }
+
+                ip += ix->Length;
+            }
+
+            return result;
+        }
+    };
+}
+
+SignatureStep find_reachable_instructions(std::string_view description, size_t max_instructions, std::function<bool(const INSTRUX&)> predicate) {
+    return SignatureStep{
+        "find_reachable_instructions(" + std::string{description} + "," + std::to_string(max_instructions) + ")",
+        [max_instructions, predicate](HMODULE, uintptr_t address) {
+            std::vector<uintptr_t> result{};
+
+            utility::exhaustive_decode((uint8_t*)address, max_instructions, [&](INSTRUX& ix, uintptr_t ip) -> utility::ExhaustionResult {
+                if (predicate(ix)) {
+                    result.push_back(ip);
+                }
+
+                if (std::string_view{ix.Mnemonic}.starts_with("CALL")) {
+                    return utility::ExhaustionResult::STEP_OVER;
+                }
+
+                return utility::ExhaustionResult::CONTINUE;
+            });
+
+            return result;
+        }
+    };
+}
+
+SignatureStep displacement() {
+    return SignatureStep{
+        "displacement",
+        [](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            const auto result = utility::resolve_displacement(address);
+
+            if (!result) {
+                return {};
+            }
+
+            return { *result };
+        }
+    };
+}
+
+SignatureStep call_target() {
+    return SignatureStep{
+        "call_target",
+        [](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            const auto decoded = utility::decode_one((uint8_t*)address);
+            const auto target = utility::resolve_displacement(address);
+
+            if (!decoded || !target) {
+                return {};
+            }
+
+            if (!decoded->BranchInfo.IsIndirect) {
+                return { *target };
+            }
+
+            if (*target == 0 || *(uintptr_t*)*target == 0) {
+                return {};
+            }
+
+            return { *(uintptr_t*)*target };
+        }
+    };
+}
+
+SignatureStep dereference() {
+    return SignatureStep{
+        "dereference",
+        [](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            if (address == 0 || !memory::is_readable((void*)address, sizeof(void*))) {
+                return {};
+            }
+
+            return { *(uintptr_t*)address };
+        }
+    };
+}
+
+SignatureStep function_start() {
+    return SignatureStep{
+        "function_start",
+        [](HMODULE, uintptr_t address) -> std::vector<uintptr_t> {
+            const auto result = utility::find_function_start(address);
+
+            if (!result) {
+                return {};
+            }
+
+            return { *result };
+        }
+    };
+}
+}
+
+SignatureDatabase& SignatureDatabase::get() {
+    // Leaked on purpose, resolve_all work might still be running on the scan pool when the process goes down
+    static auto database = new SignatureDatabase{};
+    return *database;
+}
+
+namespace detail {
+// Whether the instruction right before call_ip (at most 32 bytes back) loads a wide string literal into rdx,
+// like every FName(TEXT("...")) does before calling the constructor
+bool is_called_with_literal(uintptr_t call_ip) try {
+    for (size_t back = 7; back <= 32; ++back) {
+        const auto ip = call_ip - back;
+
+        // lea rdx, [rip+disp32]
+        if (*(uint8_t*)ip != 0x48 || *(uint8_t*)(ip + 1) != 0x8D || *(uint8_t*)(ip + 2) != 0x15) {
+            continue;
+        }
+
+        const auto lea = utility::decode_one((uint8_t*)ip);
+
+        if (!lea || lea->Instruction != ND_INS_LEA || lea->Operands[0].Info.Register.Reg != NDR_RDX) {
+            continue;
+        }
+
+        // Has to decode cleanly up to the call, otherwise those bytes were the middle of something else
+        auto next = ip + lea->Length;
+
+        while (next < call_ip) {
+            const auto ix = utility::decode_one((uint8_t*)next);
+
+            if (!ix || std::string_view{ix->Mnemonic}.starts_with("CALL")) {
+                break;
+            }
+
+            next += ix->Length;
+        }
+
+        if (next != call_ip) {
+            continue;
+        }
+
+        const auto str = (const wchar_t*)(ip + lea->Length + (int64_t)(int32_t)lea->Displacement);
+
+        if (!memory::is_readable(str, sizeof(wchar_t) * 2)) {
+            continue;
+        }
+
+        size_t length = 0;
+
+        while (length < 64 && memory::is_readable(&str[length], sizeof(wchar_t)) && str[length] >= 0x20 && str[length] < 0x7F) {
+            ++length;
+        }
+
+        if (length > 0 && length < 64 && str[length] == 0) {
+            return true;
+        }
+    }
+
+    return false;
+} catch(...) {
+    return false;
+}
+}
+
+SignatureDatabase::SignatureDatabase() {
+    // FName::FName(const TCHAR*, EFindName), called right after the string gets loaded into rdx
+    for (const auto str : { L"FTagMetaData", L"FNavigationMetaData" }) {
+        add(Signature{
+            .name = "FName::Constructor",
+            .module = L"SlateCore",
+            .steps = {
+                steps::string(str),
+                steps::xrefs(),
+                steps::offset(4),
+                steps::scan_mnemonic("CALL", 10),
+                steps::call_target()
+            },
+            .validate = [](uintptr_t address) -> bool {
+                // Checked by looking at how it gets called rather than calling it,
+                // anything that made it this far could be an arbitrary function.
+                // The real one gets called all over its module with a string literal in rdx
+                const auto module = utility::get_module_within(address);
+
+                if (!module || *module == nullptr) {
+                    return false;
+                }
+
+                size_t literal_calls = 0;
+
+                for (const auto ref : XrefIndex::get(*module).find_all(address)) {
+                    // call rel32, the ref is the rel32 right after the opcode
+                    if (*(uint8_t*)(ref - 1) != 0xE8) {
+                        continue;
+                    }
+
+                    if (detail::is_called_with_literal(ref - 1) && ++literal_calls >= FNAME_MIN_LITERAL_CALLS) {
+                        return true;
+                    }
+                }
+
+                SPDLOG_INFO("[SignatureDatabase] {:x} is only called with a string literal {} times, not FName::FName", address, literal_calls);
+                return false;
+            }
+        });
+    }
+
+    // InitNullRHI references its failure string shortly before storing the new RHI into GDynamicRHI
+    add(Signature{
+        .name = "FDynamicRHI::GDynamicRHI",
+        .module = L"RHI",
+        .steps = {
+            steps::string(L"NullDrvFailure"),
+            steps::xrefs(),
+            steps::instruction(),
+            steps::find_instructions("mov [mem], rax", 100, [](const INSTRUX& ix) {
+                return std::string_view{ix.Mnemonic}.starts_with("MOV") &&
+                    ix.Operands[0].Type == ND_OP_MEM &&
+                    ix.Operands[1].Type == ND_OP_REG &&
+                    ix.Operands[1].Info.Register.Reg == NDR_RAX &&
+                    ix.Operands[1].Size == sizeof(void*);
+            }),
+            steps::displacement()
+        }
+    });
+
+    // UEngine::CalibrateTilt, the first global it loads from is GEngine
+    add(Signature{
+        .name = "UEngine::GEngine",
+        .module = L"Engine",
+        .steps = {
+            steps::string(L"CALIBRATEMOTION"),
+            steps::xrefs(),
+            steps::function_start(),
+            steps::find_instructions("mov reg, [rip+x]", 50, [](const INSTRUX& ix) {
+                return ix.Instruction == ND_INS_MOV &&
+                    ix.Operands[0].Type == ND_OP_REG &&
+                    ix.Operands[1].Type == ND_OP_MEM &&
+                    ix.Operands[1].Info.Memory.IsRipRel;
+            }),
+            steps::displacement()
+        },
+        .validate = [](uintptr_t address) -> bool {
+            return memory::is_readable((void*)address, sizeof(void*));
+        }
+    });
+
+    // RegisterComponentWithWorld gets called right after the input component is created,
+    // it's the first called function that references "ActorComponent" somewhere down its calls
+    add(Signature{
+        .name = "UActorComponent::RegisterComponentWithWorld",
+        .module = L"Engine",
+        .steps = {
+            steps::string(L"PC_InputComponent0"),
+            steps::xrefs(),
+            steps::offset(4),
+            steps::find_reachable_instructions("rip relative call", 300, [](const INSTRUX& ix) {
+                return ix.IsRipRelative && std::string_view{ix.Mnemonic}.starts_with("CALL");
+            }),
+            steps::displacement()
+        },
+        .validate = [](uintptr_t address) -> bool {
+            return static_cast<bool>(utility::find_string_reference_in_path(address, L"ActorComponent"));
+        }
+    });
+}
+
+void SignatureDatabase::add(Signature signature) {
+    std::scoped_lock _{m_mutex};
+
+    auto it = m_entries.find(signature.name);
+
+    if (it == m_entries.end()) {
+        it = m_entries.try_emplace(std::string{signature.name}).first;
+    }
+
+    it->second.candidates.push_back(std::move(signature));
+}
+
+std::optional<uintptr_t> SignatureDatabase::resolve(std::string_view name) {
+    Entry* entry{};
+
+    {
+        std::scoped_lock _{m_mutex};
+
+        const auto it = m_entries.find(name);
+
+        if (it == m_entries.end()) {
+            SPDLOG_ERROR("[SignatureDatabase::resolve] No signature named {}", name);
+            return std::nullopt;
+        }
+
+        entry = &it->second;
+    }
+
+    std::call_once(entry->once, [&] {
+        entry->result = resolve_entry(name, *entry);
+    });
+
+    return entry->result;
+}
+
+void SignatureDatabase::resolve_all() {
+    ZoneScopedN("sdk::SignatureDatabase::resolve_all");
+
+    std::vector<std::string> names{};
+
+    {
+        std::scoped_lock _{m_mutex};
+
+        for (const auto& [name, entry] : m_entries) {
+            names.push_back(name);
+        }
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    UObjectScan::run_tasks(names.size(), [&](size_t index) {
+        resolve(names[index]);
+    });
+
+    SPDLOG_INFO("[SignatureDatabase::resolve_all] Resolved {} signatures in {}ms", names.size(),
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - now).count());
+}
+
+std::optional<uintptr_t> SignatureDatabase::resolve_entry(std::string_view name, Entry& entry) try {
+    ZoneScopedN("sdk::SignatureDatabase::resolve_entry");
+
+    auto& cache = DiscoveryCache::get();
+
+    // Validation is the same for all candidates of a name
+    const auto& validate = entry.candidates.front().validate;
+
+    if (const auto cached = cache.get_address(name); cached.has_value()) {
+        if (!validate || validate(*cached)) {
+            SPDLOG_INFO("[SignatureDatabase::resolve] Using cached {} at {:x}", name, *cached);
+            return cached;
+        }
+
+        cache.invalidate(name);
+    }
+
+    for (const auto& signature : entry.candidates) {
+        const auto any_version = signature.min_version == EngineVersion{0, 0} && signature.max_version == EngineVersion{UINT32_MAX, UINT32_MAX};
+
+        if (!any_version) {
+            const auto version = get_engine_version();
+
+            if (version && (*version < signature.min_version || *version > signature.max_version)) {
+                continue;
+            }
+        }
+
+        const auto module = sdk::get_ue_module(signature.module.data());
+
+        if (module == nullptr) {
+            continue;
+        }
+
+        for (const auto address : run(signature, module)) {
+            if (signature.validate && !signature.validate(address)) {
+                continue;
+            }
+
+            SPDLOG_INFO("[SignatureDatabase::resolve] Found {} at {:x}", name, address);
+
+            cache.set_address(name, address);
+            return address;
+        }
+    }
+
+    SPDLOG_ERROR("[SignatureDatabase::resolve] Failed to find {}", name);
+    return std::nullopt;
+} catch(...) {
+    SPDLOG_ERROR("[SignatureDatabase::resolve] Exception occurred while resolving {}", name);
+    return std::nullopt;
+}
+
+std::vector<uintptr_t> SignatureDatabase::run(const Signature& signature, HMODULE module) {
+    std::vector<uintptr_t> current{ 0 };
+    std::string key = std::to_string((uintptr_t)module);
+
+    for (const auto& step : signature.steps) {
+        key += "|" + step.description;
+
+        {
+            std::scoped_lock _{m_memo_mutex};
+
+            if (const auto it = m_memo.find(key); it != m_memo.end()) {
+                current = it->second;
+
+                if (current.empty()) {
+                    break;
+                }
+
+                continue;
+            }
+        }
+
+        std::vector<uintptr_t> next{};
+
+        for (const auto address : current) try {
+            for (const auto result : step.fn(module, address)) {
+                if (next.size() < MAX_CANDIDATES && std::find(next.begin(), next.end(), result) == next.end()) {
+                    next.push_back(result);
+                }
+            }
+        } catch(...) {
+            // Bad candidate, the others still count
+        }
+
+        {
+            std::scoped_lock _{m_memo_mutex};
+            m_memo.try_emplace(key, next);
+        }
+
+        current = std::move(next);
+
+        if (current.empty()) {
+            SPDLOG_INFO("[SignatureDatabase::run] {} ran dry at {}", signature.name, step.description);
+            break;
+        }
+    }
+
+    return current;
+}
+
+std::optional<EngineVersion> SignatureDatabase::get_engine_version() {
+    static const auto result = []() -> std::optional<EngineVersion> {
+        // Same thing search_for_version looks for, "++UE4+Release-4.27" etc
+        const std::wregex regex_pattern{LR"(\+\+ue[45].*?([45])\.(\d+))", std::regex::icase};
+        const auto exe = utility::get_executable();
+
+        for (const auto prefix : { L"++UE", L"++ue" }) {
+            for (const auto address : ModuleStrings::get(exe).find_all(prefix)) try {
+                const auto str = (const wchar_t*)address;
+                const std::wstring value{str, wcsnlen(str, 256)};
+
+                std::wsmatch matches{};
+
+                if (std::regex_search(value, matches, regex_pattern)) {
+                    const auto version = EngineVersion{ (uint32_t)std::stoul(matches[1].str()), (uint32_t)std::stoul(matches[2].str()) };
+
+                    SPDLOG_INFO("[SignatureDatabase::get_engine_version] {}.{}", version.major, version.minor);
+                    return version;
+                }
+            } catch(...) {
+            }
+        }
+
+        SPDLOG_INFO("[SignatureDatabase::get_engine_version] No version string, not filtering signatures");
+        return std::nullopt;
+    }();
+
+    return result;
+}
+}
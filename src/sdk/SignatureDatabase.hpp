@@ -0,0 +1,110 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+#include <windows.h>
+#include <bddisasm.h>
+
+namespace sdk {
+// A step turns one address into any number of addresses.
+// The description doubles as the key intermediate results get shared on,
+// so two steps with the same description have to do the same thing.
+struct SignatureStep {
+    std::string description{};
+    std::function<std::vector<uintptr_t>(HMODULE module, uintptr_t address)> fn{};
+};
+
+namespace steps {
+// First step only, every occurrence of the string in the module's data sections
+SignatureStep string(std::wstring_view str, bool zero_terminated = false);
+// First step only, every match of the pattern in the module's code sections
+SignatureStep pattern(std::string_view pattern);
+
+// Every displacement/rel32 pointing at the address
+SignatureStep xrefs();
+// Displacement -> start of the instruction it belongs to
+SignatureStep instruction();
+SignatureStep offset(int64_t delta);
+// First instruction within max_bytes whose mnemonic starts with mnemonic
+SignatureStep scan_mnemonic(std::string_view mnemonic, size_t max_bytes);
+// Every instruction in the next max_instructions (straight line) that matches
+SignatureStep find_instructions(std::string_view description, size_t max_instructions, std::function<bool(const INSTRUX&)> predicate);
+// Same but follows branches and steps over calls, like utility::exhaustive_decode
+SignatureStep find_reachable_instructions(std::string_view description, size_t max_instructions, std::function<bool(const INSTRUX&)> predicate);
+// Whatever the instruction's displacement points at
+SignatureStep displacement();
+// Call destination, reads through the pointer for indirect calls
+SignatureStep call_target();
+SignatureStep dereference();
+SignatureStep function_start();
+}
+
+struct EngineVersion {
+    uint32_t major{0};
+    uint32_t minor{0};
+
+    auto operator<=>(const EngineVersion& other) const = default;
+};
+
+// Where to look, how to get there, and how to tell whether what came out is right
+struct Signature {
+    std::string_view name{}; // also the DiscoveryCache key
+    std::wstring_view module{}; // for get_ue_module
+    std::vector<SignatureStep> steps{};
+
+    // Inclusive, skipped on builds outside of it. Builds with no version string match everything
+    EngineVersion min_version{0, 0};
+    EngineVersion max_version{UINT32_MAX, UINT32_MAX};
+
+    std::function<bool(uintptr_t)> validate{};
+};
+
+// Resolves the discovery chains that boil down to "find string -> xref -> next CALL -> resolve" from data,
+// so a new engine build just needs another Signature instead of another hand written chain.
+// Signatures sharing a name are candidates for the same thing and get tried in the order they were added,
+// the first result that passes validation wins. Chains that start the same share their intermediate results,
+// and on top of that every string and xref lookup goes through ModuleStrings/XrefIndex.
+class SignatureDatabase {
+public:
+    static SignatureDatabase& get();
+
+    void add(Signature signature);
+
+    // Resolves once and remembers it, concurrent callers wait for the first one
+    std::optional<uintptr_t> resolve(std::string_view name);
+
+    // Everything at once, spread over the UObjectScan pool. Returns when all of them are done
+    void resolve_all();
+
+    static std::optional<EngineVersion> get_engine_version();
+
+private:
+    struct Entry {
+        std::vector<Signature> candidates{};
+        std::once_flag once{};
+        std::optional<uintptr_t> result{};
+    };
+
+    SignatureDatabase();
+
+    std::optional<uintptr_t> resolve_entry(std::string_view name, Entry& entry);
+    std::vector<uintptr_t> run(const Signature& signature, HMODULE module);
+
+    std::mutex m_mutex{};
+    std::map<std::string, Entry, std::less<>> m_entries{}; // never erased from, entries stay put
+
+    std::mutex m_memo_mutex{};
+    std::unordered_map<std::string, std::vector<uintptr_t>> m_memo{}; // module + step descriptions so far -> addresses
+
+    constexpr static inline size_t MAX_CANDIDATES = 256; // per step, some patterns match all over the place
+    constexpr static inline size_t FNAME_MIN_LITERAL_CALLS = 4; // call sites passing a string literal before a candidate counts as FName::FName
+};
+}
@@ -4,6 +4,7 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "XrefIndex.hpp"
 #include "CVar.hpp"
 #include "Slate.hpp"
 
@@ -35,7 +36,7 @@ std::optional<uintptr_t> locate_draw_window_renderthread_fn() {
             func = utility::find_function_start(*func - 1))
         {
             SPDLOG_INFO("Checking if {:x} is SlateRHIRenderer::DrawWindow_RenderThread", *func);
-            auto ref = utility::scan_displacement_reference(module, *func);
+            auto ref = sdk::XrefIndex::get(module).find(*func);
 
             if (!ref) {
                 // Fallback scan for obfuscated binaries
@@ -47,7 +48,7 @@ std::optional<uintptr_t> locate_draw_window_renderthread_fn() {
                     ref = utility::scan_relative_reference_strict(module, *func, "E9");
 
                     if (ref) {
-                        ref = utility::scan_displacement_reference(module, *ref - 1);
+                        ref = sdk::XrefIndex::get(module).find(*ref - 1);
                     }
                 } catch(...) {
 
@@ -6,6 +6,7 @@
 #include <utility/Module.hpp>
 #include <tracy/Tracy.hpp>
 
+#include "Memory.hpp"
 #include "StereoStuff.hpp"
 
 // The first pointer returned that we run into
@@ -48,7 +49,7 @@ void* FRHITexture::get_native_resource() const {
                 return *first_index_that_wasnt_self;
             }
 
-            if (func == nullptr || IsBadReadPtr(func, 1)) {
+            if (func == nullptr || !sdk::memory::is_readable(func, 1)) {
                 SPDLOG_ERROR("Encountered bad function pointer at index {} before finding GetNativeResource", i);
                 throw std::runtime_error("Encountered bad function pointer before finding GetNativeResource");
                 return 0;
@@ -67,13 +68,13 @@ void* FRHITexture::get_native_resource() const {
                 continue;
             }
 
-            if (potential_resource == nullptr || IsBadReadPtr(potential_resource, sizeof(void*))) {
+            if (potential_resource == nullptr || !sdk::memory::is_readable(potential_resource, sizeof(void*))) {
                 continue;
             }
 
             const auto potential_vtable = *(void**)potential_resource;
 
-            if (potential_vtable == nullptr || IsBadReadPtr(potential_vtable, sizeof(void*))) {
+            if (potential_vtable == nullptr || !sdk::memory::is_readable(potential_vtable, sizeof(void*))) {
                 continue;
             }
 
@@ -133,13 +134,13 @@ void* FRHITexture::get_native_resource() const {
             for (uintptr_t offset = sizeof(void*); offset <= 0x30; offset += sizeof(void*)) {
                 const auto potential_resource = *(void**)((uintptr_t)returned_object + offset);
 
-                if (potential_resource == nullptr || IsBadReadPtr(potential_resource, sizeof(void*))) {
+                if (potential_resource == nullptr || !sdk::memory::is_readable(potential_resource, sizeof(void*))) {
                     continue;
                 }
 
                 const auto potential_vtable = *(void***)potential_resource;
 
-                if (potential_vtable == nullptr || IsBadReadPtr(potential_vtable, sizeof(void*))) {
+                if (potential_vtable == nullptr || !sdk::memory::is_readable(potential_vtable, sizeof(void*))) {
                     continue;
                 }
 
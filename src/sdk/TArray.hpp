@@ -1,9 +1,26 @@
 #pragma once
 
+#include <new>
+#include <span>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
 #include <type_traits>
+#include <initializer_list>
+
 #include <sdk/FMalloc.hpp>
 
 namespace sdk {
+// Whether a T can be moved to a new address with a memcpy, which lets TArray grow with a single FMalloc::realloc.
+// Specialize it for engine types that are relocatable without being trivially copyable
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 template<typename T>
 struct TArrayLite {
     T* data{nullptr};
@@ -49,6 +66,15 @@ struct TArray {
 
     TArray() = default;
 
+    // Exactly one allocation, for building ProcessEvent parameters and the like
+    TArray(std::initializer_list<T> list) {
+        append(std::span<const T>{list.begin(), list.size()});
+    }
+
+    explicit TArray(std::span<const T> elements) {
+        append(elements);
+    }
+
     // Delete copy constructor and copy assignment operator
     TArray(const TArray&) = delete;
     TArray& operator=(const TArray&) = delete;
@@ -69,6 +95,8 @@ struct TArray {
         }
 
         data = nullptr;
+        count = 0;
+        capacity = 0;
     }
 
     // begin/end
@@ -107,7 +135,38 @@ struct TArray {
         return count == 0;
     }
 
-    void clear(bool shrink = true) {
+    int32_t max_size() const {
+        return capacity;
+    }
+
+    // Non-owning view, only valid while this array is alive and isn't modified
+    std::span<T> span() {
+        return {data, (size_t)count};
+    }
+
+    std::span<const T> span() const {
+        return {data, (size_t)count};
+    }
+
+    T& front() {
+        return data[0];
+    }
+
+    T& back() {
+        return data[count - 1];
+    }
+
+    const T& front() const {
+        return data[0];
+    }
+
+    const T& back() const {
+        return data[count - 1];
+    }
+
+    // Frees the memory too unless shrink is false, like TArray::Empty vs TArray::Reset.
+    // Never throws, without GMalloc the memory just stays allocated
+    void clear(bool shrink = true) noexcept {
         // trigger destructors
         if constexpr (!std::is_trivially_destructible_v<T>) {
             for (auto i = 0; i < count; ++i) {
@@ -116,8 +175,240 @@ struct TArray {
         }
 
         count = 0;
+
+        if (!shrink || data == nullptr) {
+            return;
+        }
+
+        if (auto m = FMalloc::get(); m != nullptr) {
+            m->free(data);
+
+            data = nullptr;
+            capacity = 0;
+        }
+    }
+
+    void reserve(int32_t new_capacity) {
+        if (new_capacity > capacity) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Gives back whatever isn't being used
+    void shrink() {
+        if (capacity != count) {
+            reallocate(count);
+        }
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (count == capacity) {
+            // args could be pointing into the array, so build it before moving everything
+            T value(std::forward<Args>(args)...);
+            reallocate(calculate_growth(count + 1));
+            return *new (data + count++) T(std::move(value));
+        }
+
+        return *new (data + count++) T(std::forward<Args>(args)...);
+    }
+
+    void push_back(const T& value) {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    void pop_back() {
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            data[count - 1].~T();
+        }
+
+        --count;
+    }
+
+    // Appends all of them with at most one allocation
+    void append(std::span<const T> elements) {
+        if (elements.empty()) {
+            return;
+        }
+
+        reserve(count + (int32_t)elements.size());
+
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            memcpy(data + count, elements.data(), elements.size() * sizeof(T));
+        } else {
+            std::uninitialized_copy(elements.begin(), elements.end(), data + count);
+        }
+
+        count += (int32_t)elements.size();
+    }
+
+    void resize(int32_t new_count) {
+        resize_impl(new_count, [](T* p) { new (p) T(); });
+    }
+
+    void resize(int32_t new_count, const T& value) {
+        resize_impl(new_count, [&](T* p) { new (p) T(value); });
+    }
+
+    template<typename... Args>
+    T& emplace(int32_t index, Args&&... args) {
+        if (index == count) {
+            return emplace_back(std::forward<Args>(args)...);
+        }
+
+        T value(std::forward<Args>(args)...);
+        reserve(count == capacity ? calculate_growth(count + 1) : capacity);
+
+        // Open up a gap at index
+        if constexpr (is_trivially_relocatable_v<T>) {
+            memmove((void*)(data + index + 1), (const void*)(data + index), (count - index) * sizeof(T));
+        } else {
+            new (data + count) T(std::move(data[count - 1]));
+            std::move_backward(data + index, data + count - 1, data + count);
+            data[index].~T();
+        }
+
+        ++count;
+        return *new (data + index) T(std::move(value));
+    }
+
+    T& insert(int32_t index, const T& value) {
+        return emplace(index, value);
+    }
+
+    T& insert(int32_t index, T&& value) {
+        return emplace(index, std::move(value));
     }
 
-    // todo: push_back and stuff...
+    // Keeps the order, everything after it moves down
+    void erase(int32_t index, int32_t num = 1) {
+        if (num <= 0) {
+            return;
+        }
+
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (auto i = index; i < index + num; ++i) {
+                    data[i].~T();
+                }
+            }
+
+            memmove((void*)(data + index), (const void*)(data + index + num), (count - index - num) * sizeof(T));
+        } else {
+            std::move(data + index + num, data + count, data + index);
+
+            for (auto i = count - num; i < count; ++i) {
+                data[i].~T();
+            }
+        }
+
+        count -= num;
+    }
+
+    // Doesn't keep the order, the last element takes its place
+    void erase_swap(int32_t index) {
+        if (index != count - 1) {
+            std::swap(data[index], data[count - 1]);
+        }
+
+        pop_back();
+    }
+
+private:
+    // Same as the engine's DefaultCalculateSlackGrow, minus the allocator size quantization
+    static int32_t calculate_growth(int32_t wanted) {
+        constexpr int64_t FIRST_GROW = 4;
+        constexpr int64_t CONSTANT_GROW = 16;
+
+        if (wanted <= FIRST_GROW) {
+            return (int32_t)FIRST_GROW;
+        }
+
+        return (int32_t)std::min<int64_t>((int64_t)wanted + 3 * (int64_t)wanted / 8 + CONSTANT_GROW, INT32_MAX);
+    }
+
+    // What the engine passes for its default heap allocator, unless T wants more than FMalloc gives by default
+    static constexpr uint32_t get_alignment() {
+        return alignof(T) > 16 ? (uint32_t)alignof(T) : 0;
+    }
+
+    template<typename F>
+    void resize_impl(int32_t new_count, F&& construct) {
+        if (new_count < count) {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (auto i = new_count; i < count; ++i) {
+                    data[i].~T();
+                }
+            }
+
+            count = new_count;
+            return;
+        }
+
+        reserve(new_count);
+
+        for (; count < new_count; ++count) {
+            construct(data + count);
+        }
+    }
+
+    void reallocate(int32_t new_capacity) {
+        const auto m = FMalloc::get();
+
+        if (m == nullptr) {
+            throw std::bad_alloc{};
+        }
+
+        if (new_capacity == 0) {
+            if (data != nullptr) {
+                m->free(data);
+            }
+
+            data = nullptr;
+            capacity = 0;
+            return;
+        }
+
+        const auto size = (size_t)new_capacity * sizeof(T);
+
+        // Engine types are all fine with this, it's what the engine's own TArray does
+        if constexpr (is_trivially_relocatable_v<T>) {
+            const auto new_data = (T*)m->realloc(data, size, get_alignment());
+
+            if (new_data != nullptr) {
+                data = new_data;
+                capacity = new_capacity;
+                return;
+            }
+
+            // No realloc found, malloc + copy + free below does the same thing
+        }
+
+        const auto new_data = (T*)m->malloc(size, get_alignment());
+
+        if (new_data == nullptr) {
+            throw std::bad_alloc{};
+        }
+
+        if (data != nullptr) {
+            if constexpr (is_trivially_relocatable_v<T>) {
+                memcpy((void*)new_data, (const void*)data, (size_t)count * sizeof(T));
+            } else {
+                for (auto i = 0; i < count; ++i) {
+                    new (new_data + i) T(std::move(data[i]));
+                    data[i].~T();
+                }
+            }
+
+            m->free(data);
+        }
+
+        data = new_data;
+        capacity = new_capacity;
+    }
 };
 }
\ No newline at end of file
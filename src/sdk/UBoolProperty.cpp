@@ -0,0 +1,88 @@
+#include <spdlog/spdlog.h>
+
+#include "UObjectArray.hpp"
+#include "UClass.hpp"
+#include "FNameLiteral.hpp"
+
+#include "UBoolProperty.hpp"
+
+namespace sdk {
+void UBoolProperty::update_offsets() {
+    if (s_updated_offsets) {
+        return;
+    }
+
+    s_updated_offsets = true;
+
+    SPDLOG_INFO("[UBoolProperty::update_offsets] Updating offsets");
+
+    const auto fhitresult = sdk::find_uobject<sdk::UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
+
+    if (fhitresult == nullptr) {
+        SPDLOG_ERROR("[UBoolProperty::update_offsets] Failed to find FHitResult");
+        return;
+    }
+
+    // Same trick as FBoolProperty, bBlockingHit and bStartPenetrating are two bitfield bools right next to each other.
+    // These are UObjects though, so they're on the UField chain and their class is a UClass
+    const auto is_bool = [](UField* field) {
+        const auto c = field != nullptr ? field->get_class() : nullptr;
+        return c != nullptr && c->get_fname() == "BoolProperty"_fname;
+    };
+
+    UBoolProperty* first_bool_property{nullptr};
+
+    for (auto field = fhitresult->get_children(); field != nullptr; field = field->get_next()) {
+        if (is_bool(field)) {
+            first_bool_property = (UBoolProperty*)field;
+            break;
+        }
+    }
+
+    if (first_bool_property == nullptr) {
+        SPDLOG_ERROR("[UBoolProperty::update_offsets] Failed to find first bool property");
+        return;
+    }
+
+    const auto next_field = first_bool_property->get_next();
+
+    if (!is_bool(next_field)) {
+        SPDLOG_ERROR("[UBoolProperty::update_offsets] Failed to find second bool property");
+        return;
+    }
+
+    const auto second_bool_property = (UBoolProperty*)next_field;
+
+    // Starts after Offset_Internal and RepNotifyFunc like FBoolProperty does
+    const auto initial_start = UProperty::s_offset_offset + 4 + sizeof(void*) + sizeof(void*);
+    const auto start = (initial_start + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+    for (auto i = start; i < start + 0x100; ++i) try {
+        const auto a = (const uint8_t*)((uintptr_t)first_bool_property + i);
+        const auto b = (const uint8_t*)((uintptr_t)second_bool_property + i);
+
+        // FieldSize 1, ByteOffset 0, then ByteMask and FieldMask are 1 for the first and 2 for the second
+        if (a[0] == 1 && b[0] == 1 &&
+            a[1] == 0 && b[1] == 0 &&
+            a[2] == 1 && b[2] == 2 &&
+            a[3] == 1 && b[3] == 2)
+        {
+            SPDLOG_INFO("[UBoolProperty::update_offsets] Field size offset: 0x{:X}", i);
+            s_field_size_offset = i;
+            s_byte_offset_offset = i + 1;
+            s_byte_mask_offset = i + 2;
+            s_field_mask_offset = i + 3;
+            break;
+        }
+    } catch(...) {
+        continue;
+    }
+
+    if (s_field_size_offset == 0) {
+        SPDLOG_ERROR("[UBoolProperty::update_offsets] Failed to find offsets");
+        return;
+    }
+
+    SPDLOG_INFO("[UBoolProperty::update_offsets] Found offsets");
+}
+}
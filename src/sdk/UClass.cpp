@@ -1,8 +1,15 @@
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <algorithm>
 #include <shared_mutex>
 #include <unordered_map>
 
 #include <windows.h>
 #include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
 
 #include <utility/String.hpp>
 #include <utility/Scan.hpp>
@@ -16,6 +23,10 @@
 #include "FProperty.hpp"
 #include "ScriptVector.hpp"
 #include "ScriptMatrix.hpp"
+#include "FNameLiteral.hpp"
+#include "UStructTree.hpp"
+#include "Memory.hpp"
+#include "common/ConcurrentPointerMap.hpp"
 
 #include "UClass.hpp"
 
@@ -64,20 +75,20 @@ void UStruct::resolve_field_offsets(uint32_t child_search_start) {
         // quantum physics... brutal.
         const auto potential_field = *(sdk::FField**)((uintptr_t)vector_scriptstruct + i);
 
-        if (potential_field == nullptr || IsBadReadPtr(potential_field, sizeof(void*)) || ((uintptr_t)potential_field & 1) != 0) {
+        if (potential_field == nullptr || !memory::is_readable(potential_field, sizeof(void*)) || ((uintptr_t)potential_field & 1) != 0) {
             continue;
         }
 
         // Uh... todo... check if this is even necessary for the FField variants?
         const auto vtable = *(void**)potential_field;
 
-        if (vtable == nullptr || IsBadReadPtr(vtable, sizeof(void*)) || ((uintptr_t)vtable & 1) != 0) {
+        if (vtable == nullptr || !memory::is_readable(vtable, sizeof(void*)) || ((uintptr_t)vtable & 1) != 0) {
             continue;
         }
 
         const auto vfunc = *(void**)vtable;
 
-        if (vfunc == nullptr || IsBadReadPtr(vfunc, sizeof(void*))) {
+        if (vfunc == nullptr || !memory::is_readable(vfunc, sizeof(void*))) {
             continue;
         }
 
@@ -132,7 +143,7 @@ void UStruct::resolve_field_offsets(uint32_t child_search_start) {
                     for (auto k = 0; k < 0x100; k += sizeof(void*)) try {
                         const auto potential_ffc = *(void**)((uintptr_t)potential_field + k);
 
-                        if (potential_ffc == nullptr || IsBadReadPtr(potential_ffc, sizeof(void*)) || ((uintptr_t)potential_ffc & 1) != 0) {
+                        if (potential_ffc == nullptr || !memory::is_readable(potential_ffc, sizeof(void*)) || ((uintptr_t)potential_ffc & 1) != 0) {
                             continue;
                         }
 
@@ -166,19 +177,19 @@ void UStruct::resolve_field_offsets(uint32_t child_search_start) {
                 for (auto k = 0; k < 0x100; k += sizeof(void*)) try {
                     const auto potential_next_field = *(sdk::FField**)((uintptr_t)potential_field + k);
 
-                    if (potential_next_field == nullptr || IsBadReadPtr(potential_next_field, sizeof(void*)) || ((uintptr_t)potential_next_field & 1) != 0) {
+                    if (potential_next_field == nullptr || !memory::is_readable(potential_next_field, sizeof(void*)) || ((uintptr_t)potential_next_field & 1) != 0) {
                         continue;
                     }
 
                     const auto potential_field_vtable = *(void**)potential_next_field;
 
-                    if (potential_field_vtable == nullptr || IsBadReadPtr(potential_field_vtable, sizeof(void*)) || ((uintptr_t)potential_field_vtable & 1) != 0) {
+                    if (potential_field_vtable == nullptr || !memory::is_readable(potential_field_vtable, sizeof(void*)) || ((uintptr_t)potential_field_vtable & 1) != 0) {
                         continue;
                     }
 
                     const auto potential_field_vfunc = *(void**)potential_field_vtable;
 
-                    if (potential_field_vfunc == nullptr || IsBadReadPtr(potential_field_vfunc, sizeof(void*))) {
+                    if (potential_field_vfunc == nullptr || !memory::is_readable(potential_field_vfunc, sizeof(void*))) {
                         continue;
                     }
 
@@ -290,19 +301,19 @@ void UStruct::resolve_function_offsets(uint32_t child_search_start) try {
         for (auto i = child_search_start; i < 0x100; i += sizeof(void*)) try {
             const auto potential_field = *(sdk::UField**)((uintptr_t)gameplay_statics + i);
 
-            if (potential_field == nullptr || IsBadReadPtr(potential_field, sizeof(void*)) || ((uintptr_t)potential_field & 1) != 0) {
+            if (potential_field == nullptr || !memory::is_readable(potential_field, sizeof(void*)) || ((uintptr_t)potential_field & 1) != 0) {
                 continue;
             }
 
             const auto potential_field_vtable = *(void**)potential_field;
 
-            if (potential_field_vtable == nullptr || IsBadReadPtr(potential_field_vtable, sizeof(void*)) || ((uintptr_t)potential_field_vtable & 1) != 0) {
+            if (potential_field_vtable == nullptr || !memory::is_readable(potential_field_vtable, sizeof(void*)) || ((uintptr_t)potential_field_vtable & 1) != 0) {
                 continue;
             }
 
             const auto potential_field_vtable_first = *(void**)potential_field_vtable;
 
-            if (potential_field_vtable_first == nullptr || IsBadReadPtr(potential_field_vtable_first, sizeof(void*))) {
+            if (potential_field_vtable_first == nullptr || !memory::is_readable(potential_field_vtable_first, sizeof(void*))) {
                 continue;
             }
 
@@ -318,7 +329,7 @@ void UStruct::resolve_function_offsets(uint32_t child_search_start) try {
         // Now we need to find the UField::Next offset
         const auto first_ufield = gameplay_statics->get_children();
 
-        if (first_ufield == nullptr || IsBadReadPtr(first_ufield, sizeof(void*)) || ((uintptr_t)first_ufield & 1) != 0) {
+        if (first_ufield == nullptr || !memory::is_readable(first_ufield, sizeof(void*)) || ((uintptr_t)first_ufield & 1) != 0) {
             SPDLOG_ERROR("[UStruct] Failed to find first UField!");
             return;
         }
@@ -326,19 +337,19 @@ void UStruct::resolve_function_offsets(uint32_t child_search_start) try {
         for (auto i = sdk::UObjectBase::get_class_size(); i < 0x100; i += sizeof(void*)) try {
             const auto potential_next_field = *(sdk::UField**)((uintptr_t)first_ufield + i);
 
-            if (potential_next_field == nullptr || IsBadReadPtr(potential_next_field, sizeof(void*)) || ((uintptr_t)potential_next_field & 1) != 0) {
+            if (potential_next_field == nullptr || !memory::is_readable(potential_next_field, sizeof(void*)) || ((uintptr_t)potential_next_field & 1) != 0) {
                 continue;
             }
 
             const auto potential_next_field_vtable = *(void**)potential_next_field;
 
-            if (potential_next_field_vtable == nullptr || IsBadReadPtr(potential_next_field_vtable, sizeof(void*)) || ((uintptr_t)potential_next_field_vtable & 1) != 0) {
+            if (potential_next_field_vtable == nullptr || !memory::is_readable(potential_next_field_vtable, sizeof(void*)) || ((uintptr_t)potential_next_field_vtable & 1) != 0) {
                 continue;
             }
 
             const auto potential_next_field_vtable_first = *(void**)potential_next_field_vtable;
 
-            if (potential_next_field_vtable_first == nullptr || IsBadReadPtr(potential_next_field_vtable_first, sizeof(void*))) {
+            if (potential_next_field_vtable_first == nullptr || !memory::is_readable(potential_next_field_vtable_first, sizeof(void*))) {
                 continue;
             }
 
@@ -374,7 +385,7 @@ void UStruct::resolve_function_offsets(uint32_t child_search_start) try {
         for (auto i = UStruct::s_child_properties_offset + sizeof(void*); i < 0x200; i += sizeof(void*)) try {
             const auto possible_native_fn = *(void**)((uintptr_t)next + i);
 
-            if (possible_native_fn == nullptr || IsBadReadPtr(possible_native_fn, sizeof(void*))) {
+            if (possible_native_fn == nullptr || !memory::is_readable(possible_native_fn, sizeof(void*))) {
                 continue;
             }
 
@@ -418,6 +429,18 @@ void UStruct::resolve_function_offsets(uint32_t child_search_start) try {
     SPDLOG_ERROR("[UStruct::resolve_function_offsets] Failed to resolve function offsets! (unknown exception)");
 }
 
+bool UStruct::is_a(UStruct* other) const {
+    if (this == other) {
+        return true;
+    }
+
+    if (const auto result = UStructTree::is_a(this, other); result.has_value()) {
+        return *result;
+    }
+
+    return is_a_uncached(other);
+}
+
 void UStruct::update_offsets() {
     if (s_attempted_update_offsets) {
         return;
@@ -494,7 +517,7 @@ void UClass::update_offsets() {
     for (auto i = UObjectBase::get_class_size(); i < 0x300; i += sizeof(void*)) try {
         const auto value = *(sdk::UObject**)((uintptr_t)object_class + i);
 
-        if (value == nullptr || IsBadReadPtr(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
+        if (value == nullptr || !memory::is_readable(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
             continue;
         }
 
@@ -573,25 +596,25 @@ void UScriptStruct::update_offsets() {
     for (auto i = UStruct::s_super_struct_offset + sizeof(void*); i < 0x300; i += sizeof(void*)) try {
         const auto value = *(sdk::UScriptStruct::StructOps**)((uintptr_t)matrix_scriptstruct + i);
 
-        if (value == nullptr || IsBadReadPtr(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
+        if (value == nullptr || !memory::is_readable(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
             continue;
         }
 
         const auto potential_vtable = *(void**)value;
 
-        if (potential_vtable == nullptr || IsBadReadPtr(potential_vtable, sizeof(void*)) || ((uintptr_t)potential_vtable & 1) != 0) {
+        if (potential_vtable == nullptr || !memory::is_readable(potential_vtable, sizeof(void*)) || ((uintptr_t)potential_vtable & 1) != 0) {
             continue;
         }
 
         const auto potential_vfunc = *(void**)potential_vtable;
 
-        if (potential_vfunc == nullptr || IsBadReadPtr(potential_vfunc, sizeof(void*))) {
+        if (potential_vfunc == nullptr || !memory::is_readable(potential_vfunc, sizeof(void*))) {
             continue;
         }
 
         const auto value2 = *(sdk::UScriptStruct::StructOps**)((uintptr_t)vector_scriptstruct + i);
 
-        if (value2 == nullptr || IsBadReadPtr(value2, sizeof(void*)) || ((uintptr_t)value2 & 1) != 0) {
+        if (value2 == nullptr || !memory::is_readable(value2, sizeof(void*)) || ((uintptr_t)value2 & 1) != 0) {
             continue;
         }
 
@@ -607,90 +630,350 @@ void UScriptStruct::update_offsets() {
     }
 }
 
-FProperty* UStruct::find_property(std::wstring_view name) const {
-    static std::shared_mutex prop_mtx{};
-    static std::unordered_map<const sdk::UStruct*, std::unordered_map<std::wstring, sdk::FProperty*>> prop_cache{};
+namespace detail {
+struct SnapshotStorage {
+    // Same split as UStructTree's readers: every SnapshotRef counts itself in on the side of the epoch it started in.
+    // Unlike UStructTree nobody waits for a side to drain, the epoch only moves on if it already has,
+    // because the thread rebuilding a snapshot could be holding a SnapshotRef itself
+    constexpr static inline size_t NUM_READER_SHARDS = 16;
+
+    struct alignas(64) ReaderShard {
+        std::atomic<int32_t> count{0};
+    };
+
+    common::ConcurrentPointerMap<const UStruct*, const UStruct::Snapshot*> lookup{};
+
+    std::atomic<uint64_t> epoch{0};
+    std::array<std::array<ReaderShard, NUM_READER_SHARDS>, 2> readers{};
+
+    std::mutex mtx{};
+    std::unordered_map<const UStruct*, std::unique_ptr<UStruct::Snapshot>> owned{};
+
+    // Replaced snapshots and the epoch they were replaced in, once the epoch is 2 past that
+    // every SnapshotRef that could have seen them is gone
+    std::vector<std::pair<uint64_t, std::unique_ptr<UStruct::Snapshot>>> retired{};
+
+    std::atomic<int32_t>& get_readers() {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % NUM_READER_SHARDS;
 
-    {
-        std::shared_lock _{ prop_mtx };
+        return readers[epoch.load() & 1][shard].count;
+    }
+
+    // mtx has to be held
+    void reclaim() {
+        // Twice, so with nobody reading everything retired so far goes right away
+        for (auto i = 0; i < 2; ++i) {
+            auto current = epoch.load();
+            const auto& previous = readers[(current + 1) & 1];
 
-        if (auto it1 = prop_cache.find(this); it1 != prop_cache.end()) {
-            if (auto it2 = it1->second.find(name.data()); it2 != it1->second.end()) {
-                return it2->second;
+            const auto drained = std::all_of(previous.begin(), previous.end(), [](const ReaderShard& shard) {
+                return shard.count.load() == 0;
+            });
+
+            if (!drained || !epoch.compare_exchange_strong(current, current + 1)) {
+                break;
             }
         }
+
+        const auto current = epoch.load();
+
+        std::erase_if(retired, [&](const auto& entry) {
+            return entry.first + 2 <= current;
+        });
     }
+};
 
-    for (auto super = this; super != nullptr; super = (UClass*)super->get_super_struct()) {
-        for (auto child = super->get_child_properties(); child != nullptr; child = child->get_next()) {
-            //SPDLOG_INFO("[UStruct] Checking child property {}", utility::narrow(child->get_field_name().to_string()));
+SnapshotStorage& get_snapshot_storage() {
+    static SnapshotStorage storage{};
+    return storage;
+}
 
-            if (child->get_field_name().to_string() == name) {
-                std::unique_lock _{ prop_mtx };
-                prop_cache[this][name.data()] = (sdk::FProperty*)child;
-                return (FProperty*)child;
-            }
+// Lookups by string are usually the same few literals over and over, so keep what FName::find gave us.
+// Only names that were in the pool, those stay put, names that weren't could show up later
+struct WideStringHash {
+    using is_transparent = void;
+
+    size_t operator()(std::wstring_view s) const {
+        return std::hash<std::wstring_view>{}(s);
+    }
+};
+
+std::optional<std::pair<int32_t, int32_t>> find_cached_fname(std::wstring_view name) {
+    constexpr size_t MAX_CACHED_NAMES = 1024;
+
+    thread_local std::unordered_map<std::wstring, std::pair<int32_t, int32_t>, WideStringHash, std::equal_to<>> cache{};
+
+    if (const auto it = cache.find(name); it != cache.end()) {
+        return it->second;
+    }
+
+    const auto fname = FName::find(name);
+
+    if (!fname) {
+        return std::nullopt;
+    }
+
+    const auto result = std::make_pair(fname->a1, fname->get_number());
+
+    if (result.first != 0) {
+        if (cache.size() >= MAX_CACHED_NAMES) {
+            cache.clear();
         }
+
+        cache.emplace(name, result);
     }
 
-    return nullptr;
+    return result;
+}
 }
 
-UProperty* UStruct::find_uproperty(std::wstring_view name) const {
-    static std::shared_mutex prop_mtx{};
-    static std::unordered_map<const sdk::UStruct*, std::unordered_map<std::wstring, sdk::UProperty*>> prop_cache{};
+UStruct::Snapshot::Layout UStruct::get_snapshot_layout() {
+    return Snapshot::Layout{
+        FName::s_is_case_preserving,
+        FField::s_uses_ufield_only,
+        UObjectBase::s_fname_offset,
+        FField::s_next_offset,
+        FField::s_name_offset,
+        FField::s_class_offset,
+        UField::s_next_offset,
+        s_super_struct_offset,
+        s_children_offset,
+        s_child_properties_offset,
+        FProperty::s_offset_offset,
+        FProperty::s_property_flags_offset,
+        UProperty::s_offset_offset,
+        UFunction::s_function_flags_offset
+    };
+}
+
+UStruct::SnapshotRef UStruct::get_snapshot() const {
+    auto& storage = detail::get_snapshot_storage();
+    const auto layout = get_snapshot_layout();
+
+    // Counted in before looking anything up, the snapshot we find can't be freed until this is gone
+    SnapshotRef ref{storage.get_readers()};
 
-    {
-        std::shared_lock _{ prop_mtx };
+    // A super getting new members (or a new super) changes ours too
+    const auto is_current = [&](const Snapshot* snapshot) {
+        if (snapshot == nullptr || snapshot->layout != layout) {
+            return false;
+        }
+
+        const UStruct* expected = this;
 
-        if (auto it1 = prop_cache.find(this); it1 != prop_cache.end()) {
-            if (auto it2 = it1->second.find(name.data()); it2 != it1->second.end()) {
-                return it2->second;
+        for (const auto& link : snapshot->chain) {
+            if (link.ustruct != expected ||
+                link.super_struct != link.ustruct->get_super_struct() ||
+                link.child_properties != link.ustruct->get_child_properties() ||
+                link.children != link.ustruct->get_children())
+            {
+                return false;
             }
+
+            expected = link.super_struct;
         }
+
+        return expected == nullptr;
+    };
+
+    if (const auto existing = storage.lookup.find(this); is_current(existing)) {
+        ref.m_snapshot = existing;
+        return ref;
     }
 
-    for (auto super = this; super != nullptr; super = (UClass*)super->get_super_struct()) {
-        for (auto child = super->get_children(); child != nullptr; child = child->get_next()) {
-            //SPDLOG_INFO("[UStruct] Checking child UProperty {}", utility::narrow(child->get_fname().to_string()));
+    ZoneScopedN("sdk::UStruct::get_snapshot build");
+
+    auto snapshot = std::make_unique<Snapshot>();
+    snapshot->layout = layout;
+
+    const auto ufunction_t = UFunction::static_class();
+    const auto uproperty_t = UProperty::static_class();
+
+    for (auto super = this; super != nullptr; super = super->get_super_struct()) {
+        snapshot->chain.push_back(Snapshot::Link{
+            super,
+            super->get_super_struct(),
+            super->get_child_properties(),
+            super->get_children()
+        });
+
+        for (auto child = super->get_child_properties(); child != nullptr; child = child->get_next()) try {
+            const auto& name = child->get_field_name();
+
+            snapshot->members.push_back(Member{
+                Member::Kind::FFIELD,
+                name.a1,
+                name.get_number(),
+                ((FProperty*)child)->get_offset(),
+                ((FProperty*)child)->get_property_flags(),
+                child->get_class(),
+                child
+            });
+        } catch(...) {
+            break;
+        }
 
-            if (child->get_fname().to_string() == name) {
-                std::unique_lock _{ prop_mtx };
-                prop_cache[this][name.data()] = (sdk::UProperty*)child;
-                return (UProperty*)child;
+        for (auto child = super->get_children(); child != nullptr; child = child->get_next()) try {
+            const auto& name = child->get_fname();
+            const auto child_c = child->get_class();
+
+            Member member{
+                Member::Kind::UFIELD,
+                name.a1,
+                name.get_number(),
+                -1,
+                0,
+                child_c,
+                child
+            };
+
+            if (child_c != nullptr) {
+                if (ufunction_t != nullptr && child_c->is_a(ufunction_t)) {
+                    member.flags = ((UFunction*)child)->get_function_flags();
+                } else if (uproperty_t != nullptr && child_c->is_a(uproperty_t)) {
+                    member.offset = ((UProperty*)child)->get_offset();
+                }
             }
+
+            snapshot->members.push_back(member);
+        } catch(...) {
+            break;
         }
     }
 
-    return nullptr;
+    // Stable so the most derived member stays in front when names collide
+    std::stable_sort(snapshot->members.begin(), snapshot->members.end(), [](const Member& a, const Member& b) {
+        return std::tie(a.kind, a.name_index, a.name_number) < std::tie(b.kind, b.name_index, b.name_number);
+    });
+
+    std::scoped_lock _{storage.mtx};
+
+    // Someone else might have built it while we were
+    if (const auto existing = storage.lookup.find(this); is_current(existing)) {
+        ref.m_snapshot = existing;
+        return ref;
+    }
+
+    ref.m_snapshot = snapshot.get();
+    storage.lookup.assign(this, snapshot.get());
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Tagged after the swap, anyone who could still see the old one counted themselves in before it
+    if (auto& owned = storage.owned[this]; owned != nullptr) {
+        storage.retired.emplace_back(storage.epoch.load(), std::exchange(owned, std::move(snapshot)));
+    } else {
+        owned = std::move(snapshot);
+    }
+
+    storage.reclaim();
+
+    return ref;
 }
 
-UFunction* UStruct::find_function(std::wstring_view name) const {
-    static std::shared_mutex func_mtx{};
-    static std::unordered_map<const sdk::UStruct*, std::unordered_map<std::wstring, sdk::UFunction*>> func_cache{};
+const UStruct::Member* UStruct::Snapshot::find(Member::Kind kind, int32_t name_index, int32_t name_number) const {
+    const auto it = std::lower_bound(members.begin(), members.end(), std::tie(kind, name_index, name_number), [](const Member& m, const auto& key) {
+        return std::tie(m.kind, m.name_index, m.name_number) < key;
+    });
 
-    {
-        std::shared_lock _{ func_mtx };
+    if (it == members.end() || it->kind != kind || it->name_index != name_index || it->name_number != name_number) {
+        return nullptr;
+    }
 
-        if (auto it1 = func_cache.find(this); it1 != func_cache.end()) {
-            if (auto it2 = it1->second.find(name.data()); it2 != it1->second.end()) {
-                return it2->second;
-            }
+    return &*it;
+}
+
+const UStruct::Member* UStruct::Snapshot::find(Member::Kind kind, std::wstring_view name) const {
+    // Slow path for when we can't turn the string into an FName, still no allocations with the name pool
+    for (const auto& member : members) {
+        if (member.kind != kind) {
+            continue;
         }
-    }
 
-    for (auto super = this; super != nullptr; super = (UClass*)super->get_super_struct()) {
-        for (auto child = super->get_children(); child != nullptr; child = child->get_next()) {
-            //SPDLOG_INFO("[UStruct] Checking child UProperty {}", utility::narrow(child->get_fname().to_string()));
+        const auto& fname = kind == Member::Kind::FFIELD ? member.as_ffield()->get_field_name() : member.as_ufield()->get_fname();
 
-            if (child->get_fname().to_string() == name) {
-                std::unique_lock _{ func_mtx };
-                func_cache[this][name.data()] = (sdk::UFunction*)child;
-                return (UFunction*)child;
-            }
+        if (fname.equals(name)) {
+            return &member;
         }
     }
 
     return nullptr;
 }
+
+std::optional<UStruct::Member> UStruct::find_member(Member::Kind kind, std::wstring_view name) const {
+    const auto snapshot = get_snapshot();
+    const auto fname = detail::find_cached_fname(name);
+    const Member* member{nullptr};
+
+    if (!fname) {
+        member = snapshot->find(kind, name);
+    } else if (fname->first != 0 || name == L"None") {
+        member = snapshot->find(kind, fname->first, fname->second);
+    } // else not in the name pool, nothing can be called this
+
+    return member != nullptr ? std::optional<Member>{*member} : std::nullopt;
+}
+
+std::optional<UStruct::Member> UStruct::find_member(Member::Kind kind, const FName& name) const {
+    const auto snapshot = get_snapshot();
+    const auto member = snapshot->find(kind, name.a1, name.get_number());
+
+    return member != nullptr ? std::optional<Member>{*member} : std::nullopt;
+}
+
+std::optional<UStruct::Member> UStruct::find_member(Member::Kind kind, const FNameLiteral& name) const {
+    if (!name.ensure_resolved()) {
+        return find_member(kind, name.get_name());
+    }
+
+    const auto snapshot = get_snapshot();
+    const auto member = snapshot->find(kind, name.get_index(), name.get_number());
+
+    return member != nullptr ? std::optional<Member>{*member} : std::nullopt;
+}
+
+FProperty* UStruct::find_property(std::wstring_view name) const {
+    const auto member = find_member(Member::Kind::FFIELD, name);
+    return member ? (FProperty*)member->ptr : nullptr;
+}
+
+UProperty* UStruct::find_uproperty(std::wstring_view name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UProperty*)member->ptr : nullptr;
+}
+
+UFunction* UStruct::find_function(std::wstring_view name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UFunction*)member->ptr : nullptr;
+}
+
+FProperty* UStruct::find_property(const FName& name) const {
+    const auto member = find_member(Member::Kind::FFIELD, name);
+    return member ? (FProperty*)member->ptr : nullptr;
+}
+
+UProperty* UStruct::find_uproperty(const FName& name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UProperty*)member->ptr : nullptr;
+}
+
+UFunction* UStruct::find_function(const FName& name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UFunction*)member->ptr : nullptr;
+}
+
+FProperty* UStruct::find_property(const FNameLiteral& name) const {
+    const auto member = find_member(Member::Kind::FFIELD, name);
+    return member ? (FProperty*)member->ptr : nullptr;
+}
+
+UProperty* UStruct::find_uproperty(const FNameLiteral& name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UProperty*)member->ptr : nullptr;
+}
+
+UFunction* UStruct::find_function(const FNameLiteral& name) const {
+    const auto member = find_member(Member::Kind::UFIELD, name);
+    return member ? (UFunction*)member->ptr : nullptr;
+}
 }
\ No newline at end of file
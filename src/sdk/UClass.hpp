@@ -1,5 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <optional>
+
 #include "UObject.hpp"
 
 namespace sdk {
@@ -8,6 +13,7 @@ class UStruct;
 class FField;
 class FProperty;
 class UProperty;
+class FNameLiteral;
 
 class UField : public UObject {
 public:
@@ -30,6 +36,10 @@ public:
     static UClass* static_class();
     static void update_offsets();
 
+    static uint32_t get_super_struct_offset() {
+        return s_super_struct_offset;
+    }
+
     UStruct* get_super_struct() const {
         return *(UStruct**)((uintptr_t)this + s_super_struct_offset);
     }
@@ -50,7 +60,10 @@ public:
         return *(int32_t*)((uintptr_t)this + s_min_alignment_offset);
     }
 
-    bool is_a(UStruct* other) const {
+    // Answered from UStructTree when it can, otherwise walks the super chain
+    bool is_a(UStruct* other) const;
+
+    bool is_a_uncached(UStruct* other) const {
         for (auto super = this; super != nullptr; super = super->get_super_struct()) {
             if (super == other) {
                 return true;
@@ -64,6 +77,138 @@ public:
     UProperty* find_uproperty(std::wstring_view name) const;
     UFunction* find_function(std::wstring_view name) const;
 
+    FProperty* find_property(const FName& name) const;
+    UProperty* find_uproperty(const FName& name) const;
+    UFunction* find_function(const FName& name) const;
+
+    FProperty* find_property(const FNameLiteral& name) const;
+    UProperty* find_uproperty(const FNameLiteral& name) const;
+    UFunction* find_function(const FNameLiteral& name) const;
+
+public:
+    // Flattened copy of every member on this struct including inherited ones
+    // sorted by FName, so lookups are a binary search with no locks and no allocations
+    struct Member {
+        enum class Kind : uint8_t {
+            FFIELD, // ChildProperties
+            UFIELD  // Children (UFunctions, and UProperties on old versions)
+        };
+
+        Kind kind{Kind::FFIELD};
+        int32_t name_index{0};
+        int32_t name_number{0};
+        int32_t offset{-1}; // -1 if it's not a property
+        uint64_t flags{0}; // property flags or function flags
+        void* type{nullptr}; // FFieldClass* or UClass*
+        void* ptr{nullptr};
+
+        FField* as_ffield() const {
+            return (FField*)ptr;
+        }
+
+        UField* as_ufield() const {
+            return (UField*)ptr;
+        }
+    };
+
+    struct Snapshot {
+        // Offsets the snapshot was built with, if any of these get bruteforced again it's stale
+        struct Layout {
+            bool case_preserving{false};
+            bool ufield_only{false};
+            uint32_t fname_offset{0};
+            uint32_t ffield_next_offset{0};
+            uint32_t ffield_name_offset{0};
+            uint32_t ffield_class_offset{0};
+            uint32_t ufield_next_offset{0};
+            uint32_t super_struct_offset{0};
+            uint32_t children_offset{0};
+            uint32_t child_properties_offset{0};
+            uint32_t fproperty_offset_offset{0};
+            uint32_t fproperty_flags_offset{0};
+            uint32_t uproperty_offset_offset{0};
+            uint32_t function_flags_offset{0};
+
+            bool operator==(const Layout& other) const = default;
+        };
+
+        // What every struct from this one up to the root looked like, if any of it changed the members did too
+        struct Link {
+            const UStruct* ustruct{nullptr};
+            UStruct* super_struct{nullptr};
+            FField* child_properties{nullptr};
+            UField* children{nullptr};
+        };
+
+        // Most derived first when names collide
+        std::vector<Member> members{};
+
+        Layout layout{};
+        std::vector<Link> chain{}; // this struct first
+
+        const Member* find(Member::Kind kind, int32_t name_index, int32_t name_number) const;
+        const Member* find(Member::Kind kind, std::wstring_view name) const;
+    };
+
+    // Keeps the snapshot alive while it's around. Rebuilt snapshots only get freed once
+    // every SnapshotRef that could still be pointing at them is gone, so don't hang on to one
+    class SnapshotRef {
+    public:
+        SnapshotRef(std::atomic<int32_t>& readers)
+            : m_readers{&readers}
+        {
+            // Pairs with the fence after a rebuild swaps the snapshot in, either that sees us counted in
+            // or we see the new snapshot. The lookup map only does acquire loads so the add alone isn't enough
+            m_readers->fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        SnapshotRef(SnapshotRef&& other) noexcept
+            : m_readers{std::exchange(other.m_readers, nullptr)},
+            m_snapshot{std::exchange(other.m_snapshot, nullptr)}
+        {
+        }
+
+        SnapshotRef(const SnapshotRef&) = delete;
+        SnapshotRef& operator=(const SnapshotRef&) = delete;
+        SnapshotRef& operator=(SnapshotRef&&) = delete;
+
+        ~SnapshotRef() {
+            if (m_readers != nullptr) {
+                m_readers->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        const Snapshot* get() const {
+            return m_snapshot;
+        }
+
+        const Snapshot* operator->() const {
+            return m_snapshot;
+        }
+
+        const Snapshot& operator*() const {
+            return *m_snapshot;
+        }
+
+    private:
+        friend class UStruct;
+
+        std::atomic<int32_t>* m_readers{nullptr};
+        const Snapshot* m_snapshot{nullptr};
+    };
+
+    // Built on first use, rebuilt if the member chains of this struct or any of its supers or the offsets change
+    SnapshotRef get_snapshot() const;
+
+protected:
+    static Snapshot::Layout get_snapshot_layout();
+
+    // Copies, the snapshot the member came from can be freed as soon as these return
+    std::optional<Member> find_member(Member::Kind kind, std::wstring_view name) const;
+    std::optional<Member> find_member(Member::Kind kind, const FName& name) const;
+    std::optional<Member> find_member(Member::Kind kind, const FNameLiteral& name) const;
+
 protected:
     static void resolve_field_offsets(uint32_t child_search_start);
     static void resolve_function_offsets(uint32_t child_search_start);
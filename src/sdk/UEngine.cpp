@@ -11,7 +11,11 @@
 #include "CVar.hpp"
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
+#include "SignatureDatabase.hpp"
 #include "UGameViewportClient.hpp"
+#include "Memory.hpp"
 #include "UEngine.hpp"
 #include "UGameEngine.hpp"
 
@@ -21,41 +25,15 @@ UEngine** UEngine::get_lvalue() {
         ZoneScopedN("UEngine::get_lvalue static init");
         SPDLOG_INFO("Attempting to locate GEngine...");
 
-        const auto module = sdk::get_ue_module(L"Engine");
-        const auto calibrate_tilt_fn = utility::find_function_from_string_ref(module, L"CALIBRATEMOTION");
+        const auto result = SignatureDatabase::get().resolve("UEngine::GEngine");
 
-        if (!calibrate_tilt_fn) {
-            SPDLOG_ERROR("Failed to find CalibrateTilt function!");
-            return (UEngine**)nullptr;
+        if (!result) {
+            SPDLOG_ERROR("Failed to find GEngine!");
+            return nullptr;
         }
 
-        SPDLOG_INFO("CalibrateTilt function: {:x}", (uintptr_t)*calibrate_tilt_fn);
-
-        // Use bddisasm to find the first ptr mov into a register
-        uint8_t* ip = (uint8_t*)*calibrate_tilt_fn;
-
-        for (auto i = 0; i < 50; ++i) {
-            INSTRUX ix{};
-            const auto status = NdDecodeEx(&ix, (ND_UINT8*)ip, 1000, ND_CODE_64, ND_DATA_64);
-
-            if (!ND_SUCCESS(status)) {
-                SPDLOG_INFO("Decoding failed with error {:x}!", (uint32_t)status);
-                break;
-            }
-
-            if (ix.Instruction == ND_INS_MOV && ix.Operands[0].Type == ND_OP_REG && ix.Operands[1].Type == ND_OP_MEM && ix.Operands[1].Info.Memory.IsRipRel) {
-                const auto offset = ix.Operands[1].Info.Memory.Disp;
-                const auto result = (UEngine**)((uint8_t*)ip + ix.Length + offset);
-
-                SPDLOG_INFO("Found GEngine at {:x}", (uintptr_t)result);
-                return result;
-            }
-
-            ip += ix.Length;
-        }
-
-        SPDLOG_ERROR("Failed to find GEngine!");
-        return nullptr;
+        SPDLOG_INFO("Found GEngine at {:x}", *result);
+        return (UEngine**)*result;
     }();
 
     return engine;
@@ -133,14 +111,14 @@ void UEngine::exec(UWorld* world, std::wstring_view command, void* output_device
         for (; exec_interface_offset <= 0x100; exec_interface_offset += sizeof(void*)) {
             const auto engine_vtable = *(uintptr_t**)((uintptr_t)engine + exec_interface_offset);
 
-            if (engine_vtable == nullptr || IsBadReadPtr(engine_vtable, 50 * sizeof(void*))) {
+            if (engine_vtable == nullptr || !memory::is_readable(engine_vtable, 50 * sizeof(void*))) {
                 continue;
             }
 
             for (auto i = 0; i < 50; ++i) {
                 const auto fn = engine_vtable[i];
 
-                if ((void*)fn == nullptr || IsBadReadPtr((void*)fn, sizeof(void*))) {
+                if ((void*)fn == nullptr || !memory::is_readable((void*)fn, sizeof(void*))) {
                     continue;
                 }
 
@@ -171,21 +149,19 @@ std::optional<uintptr_t> UEngine::get_emulatestereo_string_ref_address() {
         SPDLOG_INFO("Searching for correct string reference to \"emulatestereo\"...");
 
         const auto mod = sdk::get_ue_module(L"Engine");
-        const auto size = utility::get_module_size(mod);
-        const auto end = (uintptr_t)mod + *size;
 
         // String pooling is disabled so we need to do this.
         bool found = false;
-        for (auto str = utility::scan_string(mod, L"emulatestereo"); str; str = utility::scan_string(*str + 1, (end - (*str + 1)) - 0x1000, L"emulatestereo")) {
-            SPDLOG_INFO("On string at {:x}", (uintptr_t)*str);
+        for (const auto str : sdk::ModuleStrings::get(mod).find_all(L"emulatestereo")) {
+            SPDLOG_INFO("On string at {:x}", str);
 
-            for (auto ref = utility::scan_displacement_reference(mod, *str); ref; ref = utility::scan_displacement_reference(*ref + 4, (end - (*ref + 4)) - 0x1000, *str)) {
-                SPDLOG_INFO("On reference at {:x}", (uintptr_t)*ref);
+            for (const auto ref : sdk::XrefIndex::get(mod).find_all(str)) {
+                SPDLOG_INFO("On reference at {:x}", ref);
 
                 // InitializeHMDDevice has always been guaranteed to be a virtual function
                 // so we can just use find_virtual_function_start.
                 // The other function that "emulatestereo" is in is not a virtual function.
-                const auto func = utility::find_virtual_function_start(*ref);
+                const auto func = utility::find_virtual_function_start(ref);
 
                 if (func) {
                     return ref;
@@ -238,7 +214,7 @@ std::optional<uintptr_t> UEngine::get_stereo_rendering_device_offset() {
             if (const auto disp = utility::resolve_displacement(ex_ip); disp) {
                 // the second expression catches UE dynamic/debug builds
                 if (*disp == (uintptr_t)engine || 
-                    (!IsBadReadPtr((void*)*disp, sizeof(void*)) && *(uintptr_t*)*disp == (uintptr_t)*engine)) 
+                    (memory::is_readable((void*)*disp, sizeof(void*)) && *(uintptr_t*)*disp == (uintptr_t)*engine)) 
                 {
                     SPDLOG_INFO("Found GEngine in RCX at {:x}", ex_ip);
                     is_next_call_isstereoscopic3d = true;
@@ -376,7 +352,7 @@ std::optional<uintptr_t> UEngine::get_initialize_hmd_device_address() {
         std::optional<uintptr_t> enable_stereo_emulation_cvar_ref{};
 
         for (auto i = 0; i < 3; ++i) {
-            enable_stereo_emulation_cvar_ref = utility::scan_displacement_reference(*module_within, enable_stereo_emulation_cvar->address() - (i * sizeof(void*)));
+            enable_stereo_emulation_cvar_ref = sdk::XrefIndex::get(*module_within).find(enable_stereo_emulation_cvar->address() - (i * sizeof(void*)));
 
             if (enable_stereo_emulation_cvar_ref) {
                 break;
@@ -396,7 +372,7 @@ std::optional<uintptr_t> UEngine::get_initialize_hmd_device_address() {
             const auto engine = UGameEngine::get();
 
             // Verify that the result lands within the vtable.
-            if (engine != nullptr && !IsBadReadPtr(*(void**)engine, 200 * sizeof(void*))) {
+            if (engine != nullptr && memory::is_readable(*(void**)engine, 200 * sizeof(void*))) {
                 const auto vtable = *(uintptr_t*)engine;
                 auto vtable_within = utility::scan_ptr(vtable, 200 * sizeof(void*), *result);
 
@@ -412,7 +388,7 @@ std::optional<uintptr_t> UEngine::get_initialize_hmd_device_address() {
 
             const auto engine = UGameEngine::get();
 
-            if (engine != nullptr && !IsBadReadPtr(*(void**)engine, sizeof(void*))) {
+            if (engine != nullptr && memory::is_readable(*(void**)engine, sizeof(void*))) {
                 const auto vtable = *(uintptr_t*)engine;
 
                 // Traverse the vtable and look for a function whose execution path falls within the reference to r.EnableStereoEmulation.
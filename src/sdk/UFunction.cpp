@@ -2,6 +2,7 @@
 #include <utility/String.hpp>
 
 #include "UObjectArray.hpp"
+#include "UObjectScan.hpp"
 
 #include "UFunction.hpp"
 
@@ -60,32 +61,8 @@ void UFunction::update_offsets() {
 #ifdef UFUNCTION_TESTING
     else {
         // Walk the list of UFunctions and print out the exec ones for testing
-        const auto uobjectarray = sdk::FUObjectArray::get();
-        const auto ufunction_t = UFunction::static_class();
-
-        for (auto i = 0; i < uobjectarray->get_object_count(); ++i) {
-            const auto object_entry = uobjectarray->get_object(i);
-
-            if (object_entry == nullptr) {
-                continue;
-            }
-
-            const auto object = (sdk::UObject*)object_entry->object;
-
-            if (object == nullptr) {
-                continue;
-            }
-
-            if (!object->is_a(ufunction_t)) {
-                continue;
-            }
-
-            const auto fn = (UFunction*)object;
-
-
-            if ((fn->get_function_flags() & func_exec) == func_exec) {
-                SPDLOG_INFO("[UFunction] Found exec function: {}", utility::narrow(fn->get_full_name()));
-            }
+        for (const auto fn : sdk::UObjectScan::find_functions_with_flags(func_exec)) {
+            SPDLOG_INFO("[UFunction] Found exec function: {}", utility::narrow(fn->get_full_name()));
         }
     }
 #endif
@@ -3,7 +3,10 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
 
+#include "Memory.hpp"
 #include "UGameEngine.hpp"
 
 namespace sdk {
@@ -31,7 +34,7 @@ std::optional<uintptr_t> UGameEngine::get_tick_address() {
                     // where compiler settings are strange
                     SPDLOG_ERROR("Failed to find UEngine::Tick pure virtual, trying fallback");
 
-                    const auto uengine_tick_string = utility::scan_string(module, L"UEngine::Tick");
+                    const auto uengine_tick_string = sdk::ModuleStrings::get(module).find(L"UEngine::Tick");
 
                     if (!uengine_tick_string) {
                         SPDLOG_ERROR("Failed to find UEngine::Tick string for fallback");
@@ -59,7 +62,7 @@ std::optional<uintptr_t> UGameEngine::get_tick_address() {
                 // through additional legwork.
                 if (!uengine_tick_vtable_middle) {
                     uint32_t insn_size = 0;
-                    auto func_call = utility::scan_displacement_reference(module, *uengine_tick_pure_virtual);
+                    auto func_call = sdk::XrefIndex::get(module).find(*uengine_tick_pure_virtual);
 
                     if (!func_call) {
                         func_call = utility::scan_relative_reference_strict(module, *uengine_tick_pure_virtual, "E9"); // jmp
@@ -114,14 +117,14 @@ std::optional<uintptr_t> UGameEngine::get_tick_address() {
                 for (auto i = 1; i < 200; ++i) {
                     const auto& fn = *(uintptr_t*)(*uengine_tick_vtable_middle - (i * sizeof(void*)));
 
-                    if (fn == 0 || IsBadReadPtr((void*)fn, sizeof(void*))) {
+                    if (fn == 0 || !memory::is_readable((void*)fn, sizeof(void*))) {
                         SPDLOG_ERROR("Reached end of vtable during backwards search");
                         break;
                     }
 
                     // If a reference is found to this address, AND it's a valid instruction
                     // then we have found the start of vtable.
-                    if (utility::scan_displacement_reference(module, (uintptr_t)&fn)) {
+                    if (sdk::XrefIndex::get(module).find((uintptr_t)&fn)) {
                         SPDLOG_INFO("UGameEngine::Tick: found at vtable index {}", i);
                         const auto real_engine_vtable = *(uintptr_t**)engine;
                         const auto actual_fn = real_engine_vtable[i];
@@ -138,13 +141,13 @@ std::optional<uintptr_t> UGameEngine::get_tick_address() {
         auto fallback_search_fast = [&]() -> std::optional<uintptr_t> {
             SPDLOG_INFO("Attempting fast fallback scan for UGameEngine::Tick");
 
-            const auto string = utility::scan_string(module, L"causeevent=");
+            const auto string = sdk::ModuleStrings::get(module).find(L"causeevent=");
 
             if (!string) {
                 return std::nullopt;
             }
 
-            const auto string_ref = utility::scan_displacement_reference(module, *string);
+            const auto string_ref = sdk::XrefIndex::get(module).find(*string);
 
             if (!string_ref) {
                 return std::nullopt;
@@ -189,11 +192,11 @@ std::optional<uintptr_t> UGameEngine::get_tick_address() {
             const auto vtable = *(uintptr_t**)engine;
             bool exists = false;
 
-            if (vtable != nullptr && !IsBadReadPtr(vtable, sizeof(void*))) {
+            if (vtable != nullptr && memory::is_readable(vtable, sizeof(void*))) {
                 SPDLOG_INFO("Double checking UGameEngine::Tick via vtable...");
 
                 for (auto i = 0; i < 200; ++i) {
-                    if (IsBadReadPtr(&vtable[i], sizeof(void*))) {
+                    if (!memory::is_readable(&vtable[i], sizeof(void*))) {
                         break;
                     }
 
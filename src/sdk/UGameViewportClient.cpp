@@ -9,6 +9,8 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
 
 #include "UGameViewportClient.hpp"
 
@@ -17,7 +19,7 @@ std::optional<uintptr_t> UGameViewportClient::get_draw_function() {
     static auto result = []() -> std::optional<uintptr_t> {
         ZoneScopedN("sdk::UGameViewportClient::get_draw_function static init");
         const auto engine_module = sdk::get_ue_module(L"Engine");
-        const auto canvas_object_strings = utility::scan_strings(engine_module, L"CanvasObject", true);
+        const auto canvas_object_strings = sdk::ModuleStrings::get(engine_module).find_all(L"CanvasObject", true);
 
         if (canvas_object_strings.empty()) {
             SPDLOG_ERROR("Failed to find CanvasObject string!");
@@ -38,7 +40,7 @@ std::optional<uintptr_t> UGameViewportClient::get_draw_function() {
         for (const auto canvas_object_string : canvas_object_strings) {
             SPDLOG_INFO("Analyzing CanvasObject string at {:x}", (uintptr_t)canvas_object_string);
 
-            const auto string_refs = utility::scan_displacement_references(engine_module, canvas_object_string);
+            const auto string_refs = sdk::XrefIndex::get(engine_module).find_all(canvas_object_string);
 
             if (string_refs.empty()) {
                 SPDLOG_INFO(" No string references, continuing on to next string...");
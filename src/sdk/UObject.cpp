@@ -9,9 +9,43 @@
 #include "FBoolProperty.hpp"
 #include "UProperty.hpp"
 #include "FBoolProperty.hpp"
+#include "FNameLiteral.hpp"
 #include "UObject.hpp"
 
 namespace sdk {
+namespace detail {
+enum class SupportedProperty {
+    NONE,
+    BOOL,
+    INT,
+    FLOAT,
+    DOUBLE
+};
+
+// Currently supported properties.
+SupportedProperty get_supported_property(const FFieldClass* c) {
+    const auto& name = c->get_name();
+
+    if (name == "BoolProperty"_fname) {
+        return SupportedProperty::BOOL;
+    }
+
+    if (name == "IntProperty"_fname) {
+        return SupportedProperty::INT;
+    }
+
+    if (name == "FloatProperty"_fname) {
+        return SupportedProperty::FLOAT;
+    }
+
+    if (name == "DoubleProperty"_fname) {
+        return SupportedProperty::DOUBLE;
+    }
+
+    return SupportedProperty::NONE;
+}
+}
+
 UClass* UObject::static_class() {
     static auto result = (UClass*)sdk::find_uobject(L"Class /Script/CoreUObject.Object");
     return result;
@@ -109,19 +143,9 @@ nlohmann::json UObject::to_json(const std::vector<std::wstring>& properties) con
                 continue;
             }
 
-            const auto prop_c_name = prop_c->get_name().to_string();
-
-            // Currently supported properties.
-            switch (utility::hash(utility::narrow(prop_c_name))) {
-            case "BoolProperty"_fnv:
-            case "IntProperty"_fnv:
-            case "FloatProperty"_fnv:
-            case "DoubleProperty"_fnv:
+            if (detail::get_supported_property(prop_c) != detail::SupportedProperty::NONE) {
                 wanted_properties.push_back((sdk::FProperty*)prop);
-                break;
-            default:
-                break;
-            };
+            }
         }
     } else {
         for (const auto& property : properties) {
@@ -145,24 +169,28 @@ nlohmann::json UObject::to_json(const std::vector<std::wstring>& properties) con
             continue;
         }
 
-        const auto prop_c_name = prop_c->get_name().to_string();
+        const auto prop_type = detail::get_supported_property(prop_c);
+
+        if (prop_type == detail::SupportedProperty::NONE) {
+            continue;
+        }
+
         const auto prop_field_name = utility::narrow(prop->get_field_name().to_string());
 
-        // Currently supported properties.
-        switch (utility::hash(utility::narrow(prop_c_name))) {
-        case "BoolProperty"_fnv:
+        switch (prop_type) {
+        case detail::SupportedProperty::BOOL:
         {
             const auto bp = (sdk::FBoolProperty*)prop;
             j_properties[prop_field_name] = bp->get_value_from_object((void*)this);
             break;
         }
-        case "IntProperty"_fnv:
+        case detail::SupportedProperty::INT:
             j_properties[prop_field_name] = *prop->get_data<int32_t>(this);
             break;
-        case "FloatProperty"_fnv:
+        case detail::SupportedProperty::FLOAT:
             j_properties[prop_field_name] = *prop->get_data<float>(this);
             break;
-        case "DoubleProperty"_fnv:
+        case detail::SupportedProperty::DOUBLE:
             j_properties[prop_field_name] = *prop->get_data<double>(this);
             break;
         default:
@@ -199,11 +227,8 @@ void UObject::from_json(const nlohmann::json& j) {
             continue;
         }
 
-        const auto prop_c_name = utility::narrow(prop_c->get_name().to_string());
-
-        // Currently supported properties.
-        switch (utility::hash(prop_c_name)) {
-        case "BoolProperty"_fnv:
+        switch (detail::get_supported_property(prop_c)) {
+        case detail::SupportedProperty::BOOL:
         {
             if (!value.is_boolean()) {
                 continue;
@@ -213,7 +238,7 @@ void UObject::from_json(const nlohmann::json& j) {
             bp->set_value_in_object((void*)this, value.get<bool>());
             break;
         }
-        case "IntProperty"_fnv:
+        case detail::SupportedProperty::INT:
         {
             if (!value.is_number_integer()) {
                 continue;
@@ -222,7 +247,7 @@ void UObject::from_json(const nlohmann::json& j) {
             *prop->get_data<int32_t>(this) = value.get<int32_t>();
             break;
         }
-        case "FloatProperty"_fnv:
+        case detail::SupportedProperty::FLOAT:
         {
             if (!value.is_number_float()) {
                 continue;
@@ -231,7 +256,7 @@ void UObject::from_json(const nlohmann::json& j) {
             *prop->get_data<float>(this) = value.get<float>();
             break;
         }
-        case "DoubleProperty"_fnv:
+        case detail::SupportedProperty::DOUBLE:
         {
             if (!value.is_number_float()) {
                 continue;
@@ -241,7 +266,7 @@ void UObject::from_json(const nlohmann::json& j) {
             break;
         }
         default:
-            SPDLOG_ERROR("[UObject::from_json] Unsupported property type: {}", prop_c_name);
+            SPDLOG_ERROR("[UObject::from_json] Unsupported property type: {}", utility::narrow(prop_c->get_name().to_string()));
             break;
         };
     }
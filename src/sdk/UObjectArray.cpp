@@ -1,6 +1,8 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <shared_mutex>
+#include <atomic>
+#include <thread>
 
 #include <spdlog/spdlog.h>
 #include <utility/Scan.hpp>
@@ -9,6 +11,10 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "Memory.hpp"
+#include "ModuleRegistry.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
 #include "UEngine.hpp"
 #include "UGameplayStatics.hpp"
 #include "APlayerController.hpp"
@@ -18,6 +24,7 @@
 #include "UProperty.hpp"
 #include "UFunction.hpp"
 #include "FName.hpp"
+#include "FNameLiteral.hpp"
 #include "FField.hpp"
 #include "FStructProperty.hpp"
 #include "FBoolProperty.hpp"
@@ -26,6 +33,9 @@
 #include "FEnumProperty.hpp"
 #include "UObjectHashTables.hpp"
 #include "UObjectArray.hpp"
+#include "UObjectArrayReader.hpp"
+#include "UObjectNameIndex.hpp"
+#include "UObjectScan.hpp"
 
 namespace sdk {
 UObjectBase* find_uobject(const std::wstring& full_name, bool cached) {
@@ -46,27 +56,41 @@ UObjectBase* find_uobject(const std::wstring& full_name, bool cached) {
         return nullptr;
     }
 
-    for (auto i = 0; i < objs->get_object_count(); ++i) {
-        const auto item = objs->get_object(i);
-        if (item == nullptr) {
-            continue;
-        }
-
-        const auto object = item->object;
+    // Hash lookup over the FName chains, only falls through if the index can't answer
+    if (const auto index = UObjectNameIndex::get(); index != nullptr) {
+        if (const auto result = index->find(full_name); result.has_value()) {
+            if (*result != nullptr) {
+                std::unique_lock _{cache_mutex};
+                cache[full_name] = *result;
+            }
 
-        if (object == nullptr) {
-            continue;
+            return *result;
         }
+    }
 
-        if (object->get_full_name() == full_name) {
-            std::unique_lock _{cache_mutex};
-            cache[full_name] = object;
+    const auto object = UObjectScan::find_first([&](UObjectBase* candidate) {
+        return candidate->full_name_equals(full_name);
+    }, objs);
 
-            return object;
-        }
+    if (object != nullptr) {
+        std::unique_lock _{cache_mutex};
+        cache[full_name] = object;
     }
 
-    return nullptr;
+    return object;
+}
+
+// Lives here rather than with the reader so the reader doesn't need anything from this process
+FUObjectArrayReader::Layout FUObjectArrayReader::Layout::from_current() {
+    return FUObjectArrayReader::Layout {
+        .chunked = FUObjectArray::is_chunked(),
+        .inlined = FUObjectArray::is_inlined(),
+        .item_distance = (int32_t)FUObjectArray::get_item_distance(),
+        .objects_offset = FUObjectArray::get_objects_offset(),
+        .objects_per_chunk = FUObjectArray::OBJECTS_PER_CHUNK,
+        .objects_per_chunk_inlined = FUObjectArray::OBJECTS_PER_CHUNK_INLINED,
+        .max_inlined_chunks = FUObjectArray::MAX_INLINED_CHUNKS
+    };
 }
 
 FUObjectArray* FUObjectArray::get() try {
@@ -80,6 +104,52 @@ FUObjectArray* FUObjectArray::get() try {
             return nullptr;
         }
 
+        // do an initial first pass as a test
+        const auto initial_pass = [](FUObjectArray* result) {
+            SPDLOG_INFO("[FUObjectArray::get] {} objects", result->get_object_count());
+
+            try {
+                if (auto item = result->get_object(0); item != nullptr) {
+                    if (item->object != nullptr) {
+                        const auto next_object_entry = result->get_object(1);
+                        const auto next_object = next_object_entry != nullptr ? next_object_entry->object : nullptr;
+                        item->object->update_offsets(next_object);
+                    }
+                }
+            } catch(...) {
+                SPDLOG_ERROR("[FUObjectArray::get] Failed to update offsets");
+            }
+        };
+
+        auto& cache = DiscoveryCache::get();
+
+        if (const auto cached = cache.get_address("FUObjectArray::GUObjectArray"); cached.has_value()) {
+            const auto flags = cache.get_value("FUObjectArray::Flags", core_uobject);
+            const auto item_distance = cache.get_value("FUObjectArray::ItemDistance", core_uobject);
+
+            if (flags.has_value() && item_distance.has_value()) try {
+                set_layout((*flags & 1) != 0, (*flags & 2) != 0, (int32_t)*item_distance);
+
+                // Same checks the scan ends with, just on the one candidate
+                const auto cached_result = (FUObjectArray*)*cached;
+                const auto first_item = cached_result->get_object_count() > 10 ? cached_result->get_object(0) : nullptr;
+                const auto first_object = first_item != nullptr ? (void*)first_item->object : nullptr;
+
+                if (first_object != nullptr && memory::is_readable(first_object, sizeof(void*)) && memory::is_readable(*(void**)first_object, sizeof(void*))) {
+                    SPDLOG_INFO("[FUObjectArray::get] Using cached GUObjectArray at 0x{:x}", *cached);
+                    initial_pass(cached_result);
+                    return cached_result;
+                }
+            } catch(...) {
+            }
+
+            SPDLOG_INFO("[FUObjectArray::get] Cached GUObjectArray failed validation, searching again");
+
+            set_layout(false, false, sizeof(FUObjectItem));
+
+            cache.invalidate("FUObjectArray::GUObjectArray");
+        }
+
         auto object_base_init_fn = utility::find_function_with_string_refs(core_uobject, L"gc.MaxObjectsNotConsideredByGC", 
                                                                                          L"/Script/Engine.GarbageCollectionSettings");
 
@@ -98,20 +168,20 @@ FUObjectArray* FUObjectArray::get() try {
         FUObjectArray* export_result = nullptr;
 
         // See if it's an export and just return it (we might be in the editor)
-        if (!object_base_init_fn.has_value()) {
-            if (GetProcAddress(core_uobject, "?GUObjectArray@@3VFUObjectArray@@A") != nullptr) {
-                export_result = (FUObjectArray*)GetProcAddress(core_uobject, "?GUObjectArray@@3VFUObjectArray@@A");
-                SPDLOG_INFO("[FUObjectArray::get] Found GUObjectArray export at 0x{:x}", (uintptr_t)export_result);
-            } else if (GetProcAddress(core_uobject, "GUObjectArray") != nullptr) {
-                export_result = (FUObjectArray*)GetProcAddress(core_uobject, "GUObjectArray");
-                SPDLOG_INFO("[FUObjectArray::get] Found GUObjectArray export at 0x{:x}", (uintptr_t)export_result);
+        if (const auto info = ModuleRegistry::get(core_uobject); info != nullptr && !object_base_init_fn.has_value()) {
+            for (const auto name : { "?GUObjectArray@@3VFUObjectArray@@A", "GUObjectArray" }) {
+                if (const auto found = info->find_export(name); found.has_value()) {
+                    export_result = (FUObjectArray*)*found;
+                    SPDLOG_INFO("[FUObjectArray::get] Found GUObjectArray export at 0x{:x}", (uintptr_t)export_result);
+                    break;
+                }
             }
         }
 
         // At this point we are just choosing a random function that at least references the GUObjectArray
         // because if we had to find an export, we're probably in the editor
         if (export_result != nullptr) {
-            const auto ref = utility::scan_displacement_reference(core_uobject, (uintptr_t)export_result);
+            const auto ref = sdk::XrefIndex::get(core_uobject).find((uintptr_t)export_result);
 
             if (ref) {
                 object_base_init_fn = utility::find_function_start(*ref);
@@ -147,7 +217,7 @@ FUObjectArray* FUObjectArray::get() try {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
-            if (IsBadReadPtr((void*)*displacement, 0x30)) {
+            if (!memory::is_readable((void*)*displacement, 0x30)) {
                 return utility::ExhaustionResult::CONTINUE;
             }
 
@@ -181,24 +251,24 @@ FUObjectArray* FUObjectArray::get() try {
             int32_t& potential_num_chunks = *(int32_t*)(*displacement + 0x2C);
 
             // Verify that the first object in the list is valid
-            if (potential_obj_obj_objects != nullptr && !IsBadReadPtr(potential_obj_obj_objects, sizeof(void*))) {
+            if (potential_obj_obj_objects != nullptr && memory::is_readable(potential_obj_obj_objects, sizeof(void*))) {
                 const auto first_obj = *(void**)potential_obj_obj_objects;
 
-                if (first_obj == nullptr || IsBadReadPtr(first_obj, sizeof(void*))) {
+                if (first_obj == nullptr || !memory::is_readable(first_obj, sizeof(void*))) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to invalid pointer @ first object", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
                 const auto first_vtable = *(void**)first_obj;
 
-                if (first_vtable == nullptr || IsBadReadPtr(first_vtable, sizeof(void*))) {
+                if (first_vtable == nullptr || !memory::is_readable(first_vtable, sizeof(void*))) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to invalid pointer @ first vtable", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
                 const auto first_vfunc = *(void**)first_vtable;
 
-                if (first_vfunc == nullptr || IsBadReadPtr(first_vfunc, sizeof(void*))) {
+                if (first_vfunc == nullptr || !memory::is_readable(first_vfunc, sizeof(void*))) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to invalid pointer @ first vfunc", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
@@ -209,7 +279,7 @@ FUObjectArray* FUObjectArray::get() try {
             auto check_inlined_array = [&]() -> bool {
                 constexpr auto inlined_count_offs = OBJECTS_OFFSET + (MAX_INLINED_CHUNKS * sizeof(void*));
 
-                if (IsBadReadPtr((void*)*displacement, inlined_count_offs + 8)) {
+                if (!memory::is_readable((void*)*displacement, inlined_count_offs + 8)) {
                     return false;
                 }
 
@@ -223,13 +293,13 @@ FUObjectArray* FUObjectArray::get() try {
                     for (int32_t i = 0; i < chunk_count; ++i) {
                         const auto potential_chunk = *(void**)(*displacement + OBJECTS_OFFSET + (i * sizeof(void*)));
 
-                        if (potential_chunk == nullptr || IsBadReadPtr(potential_chunk, sizeof(void*))) {
+                        if (potential_chunk == nullptr || !memory::is_readable(potential_chunk, sizeof(void*))) {
                             return false;
                         }
 
                         const auto potential_obj = *(void**)potential_chunk;
 
-                        if (potential_obj == nullptr || IsBadReadPtr(potential_obj, sizeof(void*))) {
+                        if (potential_obj == nullptr || !memory::is_readable(potential_obj, sizeof(void*))) {
                             return false;
                         }
                     }
@@ -263,12 +333,12 @@ FUObjectArray* FUObjectArray::get() try {
                 }
 
                 // Seems like this can fail on some, we'll just skip it and come up with a better heuristic
-                /*if (!IsBadReadPtr(*(void**)&potential_obj_first_gc_index, sizeof(void*)) && (*(int64_t*)&potential_obj_first_gc_index & 1) == 0) {
+                /*if (memory::is_readable(*(void**)&potential_obj_first_gc_index, sizeof(void*)) && (*(int64_t*)&potential_obj_first_gc_index & 1) == 0) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to valid pointer", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
-                if (!IsBadReadPtr(*(void**)&potential_obj_max_objects_not_consid_by_gc, sizeof(void*)) && (*(int64_t*)&potential_obj_max_objects_not_consid_by_gc & 1) == 0) {
+                if (memory::is_readable(*(void**)&potential_obj_max_objects_not_consid_by_gc, sizeof(void*)) && (*(int64_t*)&potential_obj_max_objects_not_consid_by_gc & 1) == 0) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to valid pointer", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }*/
@@ -278,7 +348,7 @@ FUObjectArray* FUObjectArray::get() try {
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
-                if (potential_obj_obj_objects == nullptr || IsBadReadPtr(potential_obj_obj_objects, sizeof(void*))) {
+                if (potential_obj_obj_objects == nullptr || !memory::is_readable(potential_obj_obj_objects, sizeof(void*))) {
                     SPDLOG_INFO("Skipping potential GUObjectArray at 0x{:x} due to invalid pointer", *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
@@ -294,7 +364,7 @@ FUObjectArray* FUObjectArray::get() try {
                     for (auto i = 0; i < potential_num_chunks; ++i) {
                         auto potential_chunked_obj = *(void**)((uintptr_t)potential_obj_obj_objects + (i * sizeof(void*)));
 
-                        if (potential_chunked_obj == nullptr || IsBadReadPtr(potential_chunked_obj, sizeof(void*))) {
+                        if (potential_chunked_obj == nullptr || !memory::is_readable(potential_chunked_obj, sizeof(void*))) {
                             SPDLOG_INFO("GUObjectArray failed to pass the chunked test");
                             any_failed = true;
                             break;
@@ -332,17 +402,17 @@ FUObjectArray* FUObjectArray::get() try {
                 const auto potential_obj = *(void**)potential_next_item;
 
                 // Make sure the "object" is valid
-                if (potential_obj == nullptr || IsBadReadPtr(potential_obj, sizeof(void*)) || ((uintptr_t)potential_obj & 1) != 0) {
+                if (potential_obj == nullptr || !memory::is_readable(potential_obj, sizeof(void*)) || ((uintptr_t)potential_obj & 1) != 0) {
                     continue;
                 }
 
                 // Now make sure the vtable is valid too
-                if (*(void**)potential_obj == nullptr || IsBadReadPtr(*(void**)potential_obj, sizeof(void*)) || ((uintptr_t)*(void**)potential_obj & 1) != 0) {
+                if (*(void**)potential_obj == nullptr || !memory::is_readable(*(void**)potential_obj, sizeof(void*)) || ((uintptr_t)*(void**)potential_obj & 1) != 0) {
                     continue;
                 }
 
                 // Make sure the first virtual function exists
-                if (**(void***)potential_obj == nullptr || IsBadReadPtr(**(void***)potential_obj, sizeof(void*))) {
+                if (**(void***)potential_obj == nullptr || !memory::is_readable(**(void***)potential_obj, sizeof(void*))) {
                     continue;
                 }
 
@@ -363,7 +433,7 @@ FUObjectArray* FUObjectArray::get() try {
             for (auto i = 0; i < potential_result->get_object_count(); ++i) try {
                 const auto potential_obj = potential_result->get_object(i);
 
-                if (potential_obj == nullptr || IsBadReadPtr(potential_obj, sizeof(void*))) {
+                if (potential_obj == nullptr || !memory::is_readable(potential_obj, sizeof(void*))) {
                     SPDLOG_ERROR("[FUObjectArray::get] Failed to read potential object at index {} for {:x}, skipping", i, *displacement);
                     return utility::ExhaustionResult::CONTINUE;
                 }
@@ -382,158 +452,153 @@ FUObjectArray* FUObjectArray::get() try {
             return nullptr;
         }
 
-        // do an initial first pass as a test
-        SPDLOG_INFO("[FUObjectArray::get] {} objects", result->get_object_count());
+        cache.set_address("FUObjectArray::GUObjectArray", (uintptr_t)result);
+        cache.set_value("FUObjectArray::Flags", (s_is_chunked ? 1 : 0) | (s_is_inlined_array ? 2 : 0), core_uobject);
+        cache.set_value("FUObjectArray::ItemDistance", (uint64_t)s_item_distance, core_uobject);
 
-        try {
-            if (auto item = result->get_object(0); item != nullptr) {
-                if (item->object != nullptr) {
-                    const auto next_object_entry = result->get_object(1);
-                    const auto next_object = next_object_entry != nullptr ? next_object_entry->object : nullptr;
-                    item->object->update_offsets(next_object);
-                }
-            }
-        } catch(...) {
-            SPDLOG_ERROR("[FUObjectArray::get] Failed to update offsets");
-        }
+        initial_pass(result);
 
         return result;
     }();
 
     // after init func so we dont deadlock
-    static bool once = true;
+    // the thread settling the offsets ends up back in here and has to get through,
+    // anyone else (startup discovery runs on several threads) waits until they're settled
+    static std::atomic<uint32_t> phase2_state{0}; // 0 = not started, 1 = running, 2 = done
+    static std::atomic<std::thread::id> phase2_thread{};
 
-    if (once) {
-        once = false;
+    if (result != nullptr && phase2_state.load(std::memory_order_acquire) != 2) {
+        uint32_t expected = 0;
 
-        if (result == nullptr) {
-            return nullptr;
+        if (!phase2_state.compare_exchange_strong(expected, 1)) {
+            if (phase2_thread.load() != std::this_thread::get_id()) {
+                phase2_state.wait(1);
+            }
+
+            return result;
         }
 
-        ZoneScopedN("FUObjectArray::get static init phase 2");
-
-        // Attempt to find the SuperStruct offset
-        sdk::UClass::update_offsets();
-        sdk::UStruct::update_offsets();
-        sdk::UScriptStruct::update_offsets();
-        sdk::UProperty::update_offsets();
-        sdk::FStructProperty::update_offsets();
-        sdk::FBoolProperty::update_offsets();
-        sdk::FObjectProperty::update_offsets();
-        sdk::FArrayProperty::update_offsets();
-        sdk::FEnumProperty::update_offsets();
-        sdk::FProperty::update_offsets();
-        sdk::UFunction::update_offsets();
-        //sdk::UObjectHashTables::get();
+        phase2_thread = std::this_thread::get_id();
 
-#ifdef TESTING_GUOBJECTARRAY
         try {
-            const auto world = sdk::UEngine::get()->get_world();
-
-            SPDLOG_INFO("[FUObjectArray::get] World: 0x{:x}", (uintptr_t)world);
+            ZoneScopedN("FUObjectArray::get static init phase 2");
+
+            // Attempt to find the SuperStruct offset
+            sdk::UClass::update_offsets();
+            sdk::UStruct::update_offsets();
+            sdk::UScriptStruct::update_offsets();
+            sdk::UProperty::update_offsets();
+            sdk::FStructProperty::update_offsets();
+            sdk::FBoolProperty::update_offsets();
+            sdk::FObjectProperty::update_offsets();
+            sdk::FArrayProperty::update_offsets();
+            sdk::FEnumProperty::update_offsets();
+            sdk::FProperty::update_offsets();
+            sdk::UFunction::update_offsets();
+            //sdk::UObjectHashTables::get();
+
+            // Everything the SDK looks up by name should be in the pool by now
+            sdk::FNameLiteral::resolve_all();
 
-            // Testing caching
-            const auto world2 = sdk::UEngine::get()->get_world();
-
-            SPDLOG_INFO("[FUObjectArray::get] World2: 0x{:x}", (uintptr_t)world2);
+#ifdef TESTING_GUOBJECTARRAY
+            try {
+                const auto world = sdk::UEngine::get()->get_world();
 
-            const auto world_name = world->get_full_name();
-            SPDLOG_INFO("[FUObjectArray::get] World name: {}", utility::narrow(world_name));
+                SPDLOG_INFO("[FUObjectArray::get] World: 0x{:x}", (uintptr_t)world);
 
-            const auto player_controller = sdk::UGameplayStatics::get()->get_player_controller(world, 0);
-            SPDLOG_INFO("[FUObjectArray::get] PlayerController: 0x{:x}", (uintptr_t)player_controller);
+                // Testing caching
+                const auto world2 = sdk::UEngine::get()->get_world();
 
-            const auto pawn = sdk::UEngine::get()->get_localpawn(0);
-            SPDLOG_INFO("[FUObjectArray::get] Pawn: 0x{:x}", (uintptr_t)pawn);
+                SPDLOG_INFO("[FUObjectArray::get] World2: 0x{:x}", (uintptr_t)world2);
 
-            if (player_controller != nullptr) {
-                SPDLOG_INFO("[FUObjectArray::get] Pawn2: 0x{:x}", (uintptr_t)player_controller->get_acknowledged_pawn());
-            }   
-        } catch(...) {
-            SPDLOG_ERROR("[FUObjectArray::get] Unknown exception occurred while performing tests on GUObjectArray");
-        }
+                const auto world_name = world->get_full_name();
+                SPDLOG_INFO("[FUObjectArray::get] World name: {}", utility::narrow(world_name));
 
-        std::unordered_set<std::wstring> possible_field_types{};
+                const auto player_controller = sdk::UGameplayStatics::get()->get_player_controller(world, 0);
+                SPDLOG_INFO("[FUObjectArray::get] PlayerController: 0x{:x}", (uintptr_t)player_controller);
 
-        const auto class_t = sdk::UClass::static_class();
+                const auto pawn = sdk::UEngine::get()->get_localpawn(0);
+                SPDLOG_INFO("[FUObjectArray::get] Pawn: 0x{:x}", (uintptr_t)pawn);
 
-        for (auto i = 0; i < result->get_object_count(); ++i) try {
-            const auto item = result->get_object(i);
-            if (item == nullptr) {
-                continue;
+                if (player_controller != nullptr) {
+                    SPDLOG_INFO("[FUObjectArray::get] Pawn2: 0x{:x}", (uintptr_t)player_controller->get_acknowledged_pawn());
+                }   
+            } catch(...) {
+                SPDLOG_ERROR("[FUObjectArray::get] Unknown exception occurred while performing tests on GUObjectArray");
             }
-            
-            const auto obj = (sdk::UObject*)item->object;
 
-            if (obj == nullptr) {
-                continue;
-            }
+            std::unordered_set<std::wstring> possible_field_types{};
 
-            if (!obj->is_a(class_t)) {
-                continue;
-            }
+            const auto class_t = sdk::UClass::static_class();
 
-            const auto c = (sdk::UClass*)obj;
+            for (const auto obj : sdk::UObjectScan::find_instances_of(class_t)) try {
+                const auto c = (sdk::UClass*)obj;
 
-            for (auto f = c->get_child_properties(); f != nullptr; f = f->get_next()) {
-                // TODO: the other one
-                if (FField::is_ufield_only()) {
-                    const auto ufield = (sdk::UField*)f;
-                    const auto f_class = ufield->get_class();
+                for (auto f = c->get_child_properties(); f != nullptr; f = f->get_next()) {
+                    // TODO: the other one
+                    if (FField::is_ufield_only()) {
+                        const auto ufield = (sdk::UField*)f;
+                        const auto f_class = ufield->get_class();
 
-                    if (f_class == nullptr) {
-                        continue;
-                    }
+                        if (f_class == nullptr) {
+                            continue;
+                        }
 
-                    const auto f_class_name = f_class->get_full_name();
+                        const auto f_class_name = f_class->get_full_name();
 
-                    if (!possible_field_types.contains(f_class_name)) {
-                        SPDLOG_INFO("[FUObjectArray::get] Possible field type: {}", utility::narrow(f_class_name));
-                        possible_field_types.insert(f_class_name);
-                    }
-                } else {
-                    const auto f_class = f->get_class();
+                        if (!possible_field_types.contains(f_class_name)) {
+                            SPDLOG_INFO("[FUObjectArray::get] Possible field type: {}", utility::narrow(f_class_name));
+                            possible_field_types.insert(f_class_name);
+                        }
+                    } else {
+                        const auto f_class = f->get_class();
 
-                    if (f_class == nullptr) {
-                        continue;
-                    }
+                        if (f_class == nullptr) {
+                            continue;
+                        }
 
-                    const auto f_class_name = f_class->get_name().to_string();
+                        const auto f_class_name = f_class->get_name().to_string();
 
-                    if (!possible_field_types.contains(f_class_name)) {
-                        SPDLOG_INFO("[FUObjectArray::get] Possible field type: {}", utility::narrow(f_class_name));
-                        possible_field_types.insert(f_class_name);
+                        if (!possible_field_types.contains(f_class_name)) {
+                            SPDLOG_INFO("[FUObjectArray::get] Possible field type: {}", utility::narrow(f_class_name));
+                            possible_field_types.insert(f_class_name);
+                        }
                     }
                 }
-            }
-        } catch(...) {
-            continue;
-        }
-
-        /*for (auto i = 0; i < result->get_object_count(); ++i) try {
-            auto item = result->get_object(i);
-            if (item == nullptr) {
+            } catch(...) {
                 continue;
             }
+
+            /*for (auto i = 0; i < result->get_object_count(); ++i) try {
+                auto item = result->get_object(i);
+                if (item == nullptr) {
+                    continue;
+                }
             
-            auto obj = *(sdk::UObjectBase**)item;
+                auto obj = *(sdk::UObjectBase**)item;
 
-            if (obj == nullptr || IsBadReadPtr(obj, sizeof(void*))) {
-                continue;
-            }
+                if (obj == nullptr || !memory::is_readable(obj, sizeof(void*))) {
+                    continue;
+                }
 
-            try {
-                const auto name = obj->get_full_name();
+                try {
+                    const auto name = obj->get_full_name();
 
-                SPDLOG_INFO("{} {}", i, utility::narrow(name));
+                    SPDLOG_INFO("{} {}", i, utility::narrow(name));
+                } catch(...) {
+                    SPDLOG_ERROR("Failed to get name {}", i);
+                }
             } catch(...) {
-                SPDLOG_ERROR("Failed to get name {}", i);
-            }
-        } catch(...) {
-            SPDLOG_ERROR("[FUObjectArray::get] Exception: failed to get object {}", i);
-        }*/
+                SPDLOG_ERROR("[FUObjectArray::get] Exception: failed to get object {}", i);
+            }*/
 #endif
-    };
+        } catch(...) {
+            SPDLOG_ERROR("[FUObjectArray::get] Exception occurred during phase 2");
+        }
+
+        phase2_state.store(2, std::memory_order_release);
+        phase2_state.notify_all();
+    }
 
     return result;
 } catch(...) {
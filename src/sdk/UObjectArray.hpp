@@ -38,6 +38,13 @@ struct FUObjectArray {
         return s_item_distance;
     }
 
+    // For when the layout is already known instead of found by get(), e.g. from the discovery cache
+    static void set_layout(bool chunked, bool inlined, int32_t item_distance) {
+        s_is_chunked = chunked;
+        s_is_inlined_array = inlined;
+        s_item_distance = item_distance;
+    }
+
     int32_t get_object_count() {
         if (s_is_inlined_array) {
             constexpr auto offs = OBJECTS_OFFSET + (MAX_INLINED_CHUNKS * sizeof(void*));
@@ -0,0 +1,148 @@
+#include <cstring>
+#include <algorithm>
+
+#include "UObjectArrayReader.hpp"
+
+namespace sdk {
+std::optional<int32_t> FUObjectArrayReader::get_object_count() {
+    // Same offsets as FUObjectArray::get_object_count
+    const auto objects = m_array + m_layout.objects_offset;
+
+    if (m_layout.inlined) {
+        return m_backend.read<int32_t>(objects + (m_layout.max_inlined_chunks * sizeof(void*)));
+    }
+
+    if (m_layout.chunked) {
+        return m_backend.read<int32_t>(objects + sizeof(void*) + sizeof(void*) + 0x4);
+    }
+
+    return m_backend.read<int32_t>(objects + 0x8);
+}
+
+std::vector<uintptr_t> FUObjectArrayReader::get_objects() try {
+    m_failed_chunks = 0;
+
+    const auto count = get_object_count();
+
+    if (!count.has_value() || *count <= 0 || m_layout.item_distance < (int32_t)sizeof(void*)) {
+        return {};
+    }
+
+    const auto objects = m_array + m_layout.objects_offset;
+    std::vector<uintptr_t> result{};
+    result.reserve(*count);
+
+    if (!m_layout.chunked && !m_layout.inlined) {
+        const auto items = m_backend.read<uintptr_t>(objects);
+
+        if (!items.has_value() || *items == 0) {
+            return {};
+        }
+
+        if (!read_items(*items, *count, result)) {
+            m_failed_chunks = 1;
+        }
+
+        return result;
+    }
+
+    const size_t per_chunk = m_layout.inlined ? m_layout.objects_per_chunk_inlined : m_layout.objects_per_chunk;
+
+    if (per_chunk == 0) {
+        return {};
+    }
+
+    const size_t num_chunks = (*count + per_chunk - 1) / per_chunk;
+
+    if (m_layout.inlined && num_chunks > m_layout.max_inlined_chunks) {
+        return {};
+    }
+
+    uintptr_t chunk_table = objects;
+
+    if (!m_layout.inlined) {
+        const auto table = m_backend.read<uintptr_t>(objects);
+
+        if (!table.has_value() || *table == 0) {
+            return {};
+        }
+
+        chunk_table = *table;
+    }
+
+    std::vector<uintptr_t> chunks(num_chunks);
+
+    if (!m_backend.read(chunk_table, chunks.data(), chunks.size() * sizeof(uintptr_t))) {
+        return {};
+    }
+
+    // Tell the backend about every chunk up front so it can batch them
+    std::vector<common::MemoryRange> ranges{};
+
+    for (size_t i = 0; i < num_chunks; ++i) {
+        if (chunks[i] != 0) {
+            const auto items_in_chunk = std::min(per_chunk, *count - i * per_chunk);
+            ranges.push_back({chunks[i], items_in_chunk * m_layout.item_distance});
+        }
+    }
+
+    m_backend.prefetch(ranges);
+
+    for (size_t i = 0; i < num_chunks; ++i) {
+        if (chunks[i] == 0) {
+            continue;
+        }
+
+        const auto items_in_chunk = std::min(per_chunk, *count - i * per_chunk);
+
+        if (!read_items(chunks[i], items_in_chunk, result)) {
+            ++m_failed_chunks;
+        }
+    }
+
+    return result;
+} catch(...) {
+    // A garbage count can make the reserve throw
+    return {};
+}
+
+std::vector<std::optional<uintptr_t>> FUObjectArrayReader::read_pointers(std::span<const uintptr_t> bases, size_t offset) {
+    std::vector<common::MemoryRange> ranges{};
+    ranges.reserve(bases.size());
+
+    for (const auto base : bases) {
+        ranges.push_back({base + offset, sizeof(uintptr_t)});
+    }
+
+    m_backend.prefetch(ranges);
+
+    std::vector<std::optional<uintptr_t>> result{};
+    result.reserve(bases.size());
+
+    for (const auto base : bases) {
+        result.push_back(m_backend.read<uintptr_t>(base + offset));
+    }
+
+    return result;
+}
+
+bool FUObjectArrayReader::read_items(uintptr_t items, size_t count, std::vector<uintptr_t>& out) {
+    // One read for the whole run of items, the object pointer is the first field of each
+    std::vector<uint8_t> buffer(count * m_layout.item_distance);
+
+    if (!m_backend.read(items, buffer.data(), buffer.size())) {
+        return false;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        uintptr_t object{};
+        memcpy(&object, buffer.data() + i * m_layout.item_distance, sizeof(object));
+
+        if (object != 0) {
+            out.push_back(object);
+        }
+    }
+
+    return true;
+}
+}
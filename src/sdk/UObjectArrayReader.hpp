@@ -0,0 +1,61 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+#include "common/MemoryBackend.hpp"
+
+namespace sdk {
+// Walks GUObjectArray through a MemoryBackend instead of dereferencing it,
+// so object dumps work against a crash dump or another process.
+// Every chunk gets prefetched and read in one go, so a slow backend pays per chunk, not per object.
+// Only knows what the Layout tells it, nothing from this process, so it works anywhere the backend does.
+class FUObjectArrayReader {
+public:
+    // Dumps don't get to run the offset brute forcing, so the layout has to come from somewhere.
+    // The defaults are what FUObjectArray starts out assuming
+    struct Layout {
+        bool chunked{true};
+        bool inlined{false}; // <= 4.10
+        int32_t item_distance{0x18};
+        size_t objects_offset{0x10};
+        size_t objects_per_chunk{64 * 1024};
+        size_t objects_per_chunk_inlined{16384};
+        size_t max_inlined_chunks{((8 * 1024 * 1024) + 16384 - 1) / 16384};
+
+        // Whatever FUObjectArray::get() figured out in this process. Defined in UObjectArray.cpp
+        static Layout from_current();
+    };
+
+    FUObjectArrayReader(common::MemoryBackend& backend, uintptr_t array_address, Layout layout)
+        : m_backend{backend},
+        m_array{array_address},
+        m_layout{layout}
+    {
+    }
+
+    std::optional<int32_t> get_object_count();
+
+    // Every non-null UObject pointer in index order, empty if the array couldn't be read.
+    // Chunks that couldn't be read are skipped, get_failed_chunks() says how many
+    std::vector<uintptr_t> get_objects();
+
+    // *(uintptr_t*)(base + offset) for every base, read as one batch. e.g. ClassPrivate of every object
+    std::vector<std::optional<uintptr_t>> read_pointers(std::span<const uintptr_t> bases, size_t offset);
+
+    // From the last get_objects()
+    size_t get_failed_chunks() const {
+        return m_failed_chunks;
+    }
+
+private:
+    bool read_items(uintptr_t items, size_t count, std::vector<uintptr_t>& out);
+
+    common::MemoryBackend& m_backend;
+    uintptr_t m_array{};
+    Layout m_layout{};
+    size_t m_failed_chunks{0};
+};
+}
@@ -1,3 +1,4 @@
+#include <array>
 #include <unordered_set>
 
 #include <Windows.h>
@@ -13,6 +14,9 @@
 #include "UObjectBase.hpp"
 #include "UObject.hpp"
 #include "EngineModule.hpp"
+#include "XrefIndex.hpp"
+#include "DiscoveryCache.hpp"
+#include "Memory.hpp"
 
 namespace sdk {
 void UObjectBase::update_offsets(sdk::UObjectBase* next_object) {
@@ -22,26 +26,51 @@ void UObjectBase::update_offsets(sdk::UObjectBase* next_object) {
 
     s_attempted_update_offsets = true;
 
+    auto& cache = DiscoveryCache::get();
+    const auto core_uobject = sdk::get_ue_module(L"CoreUObject");
+
+    const auto cached_class_private = cache.get_value("UObjectBase::ClassPrivateOffset", core_uobject);
+    const auto cached_fname = cache.get_value("UObjectBase::NamePrivateOffset", core_uobject);
+    const auto cached_outer_private = cache.get_value("UObjectBase::OuterPrivateOffset", core_uobject);
+
+    if (cached_class_private && cached_fname && cached_outer_private) try {
+        // this is always /Script/CoreUObject, so the name has to read back as that
+        const auto class_private = *(void**)((uintptr_t)this + *cached_class_private);
+        const auto& name = *(sdk::FName*)((uintptr_t)this + *cached_fname);
+
+        if (class_private != nullptr && memory::is_readable(class_private, sizeof(void*)) && name.to_string_no_numbers() == L"/Script/CoreUObject") {
+            s_class_private_offset = (uint32_t)*cached_class_private;
+            s_fname_offset = (uint32_t)*cached_fname;
+            s_outer_private_offset = (uint32_t)*cached_outer_private;
+
+            SPDLOG_INFO("[UObjectBase] Using cached offsets (ClassPrivate 0x{:X}, FName 0x{:X}, OuterPrivate 0x{:X})", s_class_private_offset, s_fname_offset, s_outer_private_offset);
+            return;
+        }
+    } catch(...) {
+    }
+
     SPDLOG_INFO("[UObjectBase] Bruteforcing offsets...");
 
+    bool found_name = false;
+
     // Look for the first valid pointer in the object array.
     // The first valid pointer is ClassPrivate.
     for (auto i = sizeof(void*); i < 0x50; i += sizeof(void*)) {
         const auto value = *(void**)((uintptr_t)this + i);
 
-        if (value == nullptr || IsBadReadPtr(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
+        if (value == nullptr || !memory::is_readable(value, sizeof(void*)) || ((uintptr_t)value & 1) != 0) {
             continue;
         }
 
         const auto possible_vtable = *(void**)value;
 
-        if (possible_vtable == nullptr || IsBadReadPtr(possible_vtable, sizeof(void*)) || ((uintptr_t)possible_vtable & 1) != 0) {
+        if (possible_vtable == nullptr || !memory::is_readable(possible_vtable, sizeof(void*)) || ((uintptr_t)possible_vtable & 1) != 0) {
             continue;
         }
 
         const auto possible_vfunc = *(void**)possible_vtable;
 
-        if (possible_vfunc == nullptr || IsBadReadPtr(possible_vfunc, sizeof(void*))) {
+        if (possible_vfunc == nullptr || !memory::is_readable(possible_vfunc, sizeof(void*))) {
             continue;
         }
 
@@ -60,6 +89,7 @@ void UObjectBase::update_offsets(sdk::UObjectBase* next_object) {
             if (str == L"/Script/CoreUObject") {
                 SPDLOG_INFO("[UObjectBase] Found FName at offset 0x{:X} ({})", j, utility::narrow(str));
                 s_fname_offset = j;
+                found_name = true;
 
                 // If this outer offset is not 0x20, then it means that FName is probably case preserving.
                 s_outer_private_offset = s_fname_offset + sizeof(void*);
@@ -91,6 +121,13 @@ void UObjectBase::update_offsets(sdk::UObjectBase* next_object) {
         
         break;
     }
+
+    // Only worth keeping if the scan actually confirmed them
+    if (found_name) {
+        cache.set_value("UObjectBase::ClassPrivateOffset", s_class_private_offset, core_uobject);
+        cache.set_value("UObjectBase::NamePrivateOffset", s_fname_offset, core_uobject);
+        cache.set_value("UObjectBase::OuterPrivateOffset", s_outer_private_offset, core_uobject);
+    }
 }
 
 void UObjectBase::update_process_event_index() try {
@@ -111,18 +148,31 @@ void UObjectBase::update_process_event_index() try {
 
     const auto vtable = *(void***)default_object_class;
 
-    if (vtable == nullptr || IsBadReadPtr(vtable, sizeof(void*))) {
+    if (vtable == nullptr || !memory::is_readable(vtable, sizeof(void*))) {
         SPDLOG_ERROR("[UObjectBase] Failed to find UObject vtable, cannot update ProcessEvent index");
         return;
     }
 
+    auto& cache = DiscoveryCache::get();
+    const auto core_uobject = sdk::get_ue_module(L"CoreUObject");
+
+    if (const auto cached = cache.get_value("UObjectBase::ProcessEventIndex", core_uobject); cached.has_value()) {
+        if (*cached < 100 && vtable[*cached] != nullptr && memory::is_readable(vtable[*cached], sizeof(void*))) {
+            UObjectBase::s_process_event_index = (uint32_t)*cached;
+            SPDLOG_INFO("[UObjectBase] Using cached ProcessEvent index {}", UObjectBase::s_process_event_index);
+            return;
+        }
+
+        cache.invalidate("UObjectBase::ProcessEventIndex");
+    }
+
     // Walk the vtable, looking for the ProcessEvent function
     std::unordered_set<uintptr_t> seen_ips{};
 
     for (auto i = 0; i < 100; ++i) {
         const auto vfunc = vtable[i];
 
-        if (vfunc == nullptr || IsBadReadPtr(vfunc, sizeof(void*))) {
+        if (vfunc == nullptr || !memory::is_readable(vfunc, sizeof(void*))) {
             break; // reached the end of the vtable
         }
 
@@ -159,7 +209,7 @@ void UObjectBase::update_process_event_index() try {
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
-                if (*displacement == 0x0 || IsBadReadPtr((void*)*displacement, sizeof(void*) * 10)) {
+                if (*displacement == 0x0 || !memory::is_readable((void*)*displacement, sizeof(void*) * 10)) {
                     return utility::ExhaustionResult::CONTINUE;
                 }
 
@@ -168,7 +218,7 @@ void UObjectBase::update_process_event_index() try {
                 for (auto j = 0; j < 10; ++j) {
                     const auto inner_vfunc = inner_vtable[j];
 
-                    if (inner_vfunc == nullptr || IsBadReadPtr(inner_vfunc, sizeof(void*))) {
+                    if (inner_vfunc == nullptr || !memory::is_readable(inner_vfunc, sizeof(void*))) {
                         break;
                     }
 
@@ -192,7 +242,7 @@ void UObjectBase::update_process_event_index() try {
 
                             const auto potential_string = (wchar_t*)*displacement2;
 
-                            if (IsBadReadPtr(potential_string, target_length)) {
+                            if (!memory::is_readable(potential_string, target_length)) {
                                 return utility::ExhaustionResult::CONTINUE;
                             }
 
@@ -201,6 +251,7 @@ void UObjectBase::update_process_event_index() try {
                                 found = true;
 
                                 SPDLOG_INFO("[UObjectBase] Found ProcessEvent index at {}", UObjectBase::s_process_event_index);
+                                cache.set_value("UObjectBase::ProcessEventIndex", (uint64_t)i, core_uobject);
                                 return utility::ExhaustionResult::BREAK;
                             }
                         } catch(...) {
@@ -249,14 +300,14 @@ void UObjectBase::update_offsets_post_uobjectarray() {
 
     const auto uobject_vtable = *(void***)default_object;
 
-    if (uobject_vtable == nullptr || IsBadReadPtr(uobject_vtable, sizeof(void*))) {
+    if (uobject_vtable == nullptr || !memory::is_readable(uobject_vtable, sizeof(void*))) {
         SPDLOG_ERROR("[UObjectBase] Failed to find UObject vtable, cannot find destructor");
         return;
     }
 
     const auto uobject_destructor = uobject_vtable[0];
 
-    if (uobject_destructor == nullptr || IsBadReadPtr(uobject_destructor, sizeof(void*))) {
+    if (uobject_destructor == nullptr || !memory::is_readable(uobject_destructor, sizeof(void*))) {
         SPDLOG_ERROR("[UObjectBase] Failed to find UObject destructor, cannot find destructor");
         return;
     }
@@ -386,7 +437,7 @@ void UObjectBase::update_offsets_post_uobjectarray() {
     }
 
     const auto core_uobject = sdk::get_ue_module(L"CoreUObject");
-    auto vtable_references = utility::scan_displacement_references(core_uobject, *s_vtable);
+    auto vtable_references = sdk::XrefIndex::get(core_uobject).find_all(*s_vtable);
 
     if (vtable_references.empty()) {
         SPDLOG_ERROR("[UObjectBase] Failed to find AddObject because vtable has no references 1");
@@ -567,10 +618,10 @@ void UObjectBase::update_offsets_post_uobjectarray() {
             uint8_t* ip = (uint8_t*)ctx.addr;
 
             if (ctx.instrux.IsRipRelative && ip[0] == 0xFF && ip[1] == 0x15) {
-                if (*fn != 0 && fn != ctx.addr && !IsBadReadPtr((void*)*fn, sizeof(void*))) {
+                if (*fn != 0 && fn != ctx.addr && memory::is_readable((void*)*fn, sizeof(void*))) {
                     const auto real_dest = *(uintptr_t*)*fn;
 
-                    if (real_dest != 0 && real_dest != (uintptr_t)ip && !IsBadReadPtr((void*)real_dest, sizeof(void*))) {
+                    if (real_dest != 0 && real_dest != (uintptr_t)ip && memory::is_readable((void*)real_dest, sizeof(void*))) {
                         fn = real_dest;
                     } else {
                         return utility::ExhaustionResult::STEP_OVER;
@@ -695,13 +746,83 @@ std::wstring UObjectBase::get_full_name() const {
         return L"null";
     }
 
-    auto obj_name = get_fname().to_string();
+    // Gather the chain first so the string can be built front to back in one buffer
+    std::array<const UObjectBase*, 64> chain{};
+    size_t depth = 0;
+
+    chain[depth++] = this;
 
     for (auto outer = this->get_outer(); outer != nullptr && outer != this; outer = outer->get_outer()) {
-        obj_name = outer->get_fname().to_string() + L'.' + obj_name;
+        if (depth >= chain.size()) {
+            // Absurdly deep, just do it the slow way
+            auto obj_name = get_fname().to_string();
+
+            for (auto o = this->get_outer(); o != nullptr && o != this; o = o->get_outer()) {
+                obj_name = o->get_fname().to_string() + L'.' + obj_name;
+            }
+
+            return c->get_fname().to_string() + L' ' + obj_name;
+        }
+
+        chain[depth++] = outer;
     }
 
-    return c->get_fname().to_string() + L' ' + obj_name;
+    std::wstring result{};
+    result.reserve(128);
+
+    c->get_fname().append_to(result);
+    result += L' ';
+
+    for (auto i = depth; i > 0; --i) {
+        chain[i - 1]->get_fname().append_to(result);
+
+        if (i > 1) {
+            result += L'.';
+        }
+    }
+
+    return result;
+}
+
+bool UObjectBase::full_name_equals(std::wstring_view full_name) const {
+    const auto c = get_class();
+
+    if (c == nullptr) {
+        return full_name == L"null";
+    }
+
+    auto remaining = full_name;
+
+    for (const UObjectBase* current = this;;) {
+        const auto matched = current->get_fname().match_end(remaining);
+
+        if (!matched) {
+            return false;
+        }
+
+        remaining.remove_suffix(*matched);
+
+        const auto outer = current->get_outer();
+
+        if (outer == nullptr || outer == this) {
+            break;
+        }
+
+        if (!remaining.ends_with(L'.')) {
+            return false;
+        }
+
+        remaining.remove_suffix(1);
+        current = outer;
+    }
+
+    if (!remaining.ends_with(L' ')) {
+        return false;
+    }
+
+    remaining.remove_suffix(1);
+
+    return c->get_fname().equals(remaining);
 }
 
 void UObjectBase::process_event(sdk::UFunction* func, void* params) {
@@ -12,6 +12,10 @@ class UObjectBase {
 public:
     void update_offsets(sdk::UObjectBase* next_object);
     std::wstring get_full_name() const;
+
+    // Same result as get_full_name() == full_name, but walks the FName chain from the innermost name outward
+    // and bails on the first mismatch instead of building the string
+    bool full_name_equals(std::wstring_view full_name) const;
     void process_event(UFunction* function, void* params);
     void call_function(const wchar_t* name, void* params);
 
@@ -0,0 +1,323 @@
+#include <chrono>
+#include <memory>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "UObject.hpp"
+#include "UClass.hpp"
+#include "UObjectScan.hpp"
+#include "UObjectClassIndex.hpp"
+
+namespace sdk {
+UObjectClassIndex* UObjectClassIndex::get() {
+    static auto result = []() -> std::unique_ptr<UObjectClassIndex> {
+        ZoneScopedN("sdk::UObjectClassIndex::get static init");
+
+        const auto objects = FUObjectArray::get();
+
+        if (objects == nullptr) {
+            return nullptr;
+        }
+
+        SPDLOG_INFO("[UObjectClassIndex::get] Creating class index");
+        return std::make_unique<UObjectClassIndex>(objects);
+    }();
+
+    return result.get();
+}
+
+UObjectClassIndex::UObjectClassIndex(FUObjectArray* objects)
+    : m_objects{objects}
+{
+}
+
+std::vector<UObject*> UObjectClassIndex::find_instances(UClass* klass, bool exact, bool refresh) try {
+    ZoneScopedN("sdk::UObjectClassIndex::find_instances");
+
+    if (m_objects == nullptr || klass == nullptr) {
+        return {};
+    }
+
+    {
+        std::shared_lock _{m_mutex};
+
+        // Never built or the offsets moved, has to be refreshed regardless
+        if (m_slots.empty() || m_layout != current_layout()) {
+            refresh = true;
+        }
+    }
+
+    if (refresh) {
+        this->refresh();
+    } else {
+        request_refresh();
+    }
+
+    std::shared_lock _{m_mutex};
+
+    std::vector<int32_t> indices{};
+
+    for (const auto c : get_closure_locked(klass, exact)) {
+        if (const auto it = m_by_class.find(c); it != m_by_class.end()) {
+            indices.insert(indices.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<UObject*> result{};
+    result.reserve(indices.size());
+
+    for (const auto i : indices) try {
+        const auto item = m_objects->get_object(i);
+
+        // Slot changed since the last refresh
+        if (item == nullptr || item->object == nullptr || !is_indexed(m_slots[i], item->object, item->serial_number)) {
+            continue;
+        }
+
+        result.push_back((UObject*)item->object);
+    } catch(...) {
+        continue;
+    }
+
+    return result;
+} catch(...) {
+    SPDLOG_ERROR("[UObjectClassIndex::find_instances] Exception occurred during lookup");
+    return {};
+}
+
+void UObjectClassIndex::refresh() {
+    ZoneScopedN("sdk::UObjectClassIndex::refresh");
+
+    std::scoped_lock refresh_lock{m_refresh_mutex};
+
+    m_last_refresh.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+
+    const auto layout = current_layout();
+
+    {
+        std::unique_lock _{m_mutex};
+
+        // Class offset or item stride changed underneath us, nothing we have is trustworthy
+        if (layout != m_layout) {
+            m_slots.clear();
+            m_by_class.clear();
+            m_layout = layout;
+
+            std::scoped_lock _{m_closure_mutex};
+            m_closures.clear();
+            ++m_class_generation;
+        }
+    }
+
+    const auto count = m_objects->get_object_count();
+
+    if (count <= 0) {
+        return;
+    }
+
+    const auto now = std::chrono::high_resolution_clock::now();
+
+    // Finding what changed is read only so it can be spread out and lookups can keep going, applying it can't.
+    // Only refreshes change the slots and they're serialized, so nothing found here goes stale before it's applied
+    std::vector<std::vector<int32_t>> changed(UObjectScan::get_num_ranges(count));
+    bool is_initial_build = false;
+
+    {
+        std::shared_lock _{m_mutex};
+
+        is_initial_build = m_slots.empty();
+
+        const Slot empty{};
+        const auto num_slots = (int32_t)m_slots.size();
+
+        UObjectScan::run(count, [&](size_t range_index, int32_t begin, int32_t end) {
+            auto& out = changed[range_index];
+            const auto first = (uintptr_t)m_objects->get_object(begin);
+            const auto stride = (uintptr_t)FUObjectArray::get_item_distance();
+
+            for (auto i = begin; i < end; ++i) try {
+                const auto item = first != 0 ? (FUObjectItem*)(first + (i - begin) * stride) : nullptr;
+                const auto object = item != nullptr ? item->object : nullptr;
+                const auto serial_number = item != nullptr ? item->serial_number : 0;
+                const auto& slot = i < num_slots ? m_slots[i] : empty;
+
+                // Also picks up objects that got a serial number since, so they're cheap to check from then on
+                if (is_indexed(slot, object, serial_number) && (slot.serial_number != 0 || serial_number == 0)) {
+                    continue;
+                }
+
+                out.push_back(i);
+            } catch(...) {
+                out.push_back(i);
+            }
+        });
+    }
+
+    std::unique_lock _{m_mutex};
+
+    for (auto i = (int32_t)m_slots.size() - 1; i >= count; --i) {
+        remove_locked(i);
+    }
+
+    m_slots.resize(count);
+
+    size_t num_changed = 0;
+
+    for (const auto& range : changed) {
+        for (const auto i : range) try {
+            ++num_changed;
+            remove_locked(i);
+
+            const auto item = m_objects->get_object(i);
+            const auto object = item != nullptr ? item->object : nullptr;
+
+            if (object == nullptr) {
+                continue;
+            }
+
+            const auto klass = object->get_class();
+
+            // Remember the object anyways so it doesn't show up as changed every refresh
+            if (klass == nullptr) {
+                m_slots[i].object = object;
+                continue;
+            }
+
+            add_locked(i, object, item->serial_number, klass);
+        } catch(...) {
+            continue;
+        }
+    }
+
+    if (is_initial_build) {
+        const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - now).count();
+        SPDLOG_INFO("[UObjectClassIndex] Indexed {} objects across {} classes in {} ms", num_changed, m_by_class.size(), time_elapsed);
+    }
+}
+
+void UObjectClassIndex::request_refresh() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(REFRESH_INTERVAL).count();
+
+    if (now - m_last_refresh.load(std::memory_order_relaxed) < interval) {
+        return;
+    }
+
+    if (m_refresh_running.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    m_last_refresh.store(now, std::memory_order_relaxed);
+
+    // Never on the caller's thread, that's usually the game thread and a refresh walks all of GUObjectArray
+    UObjectScan::submit([this] {
+        try {
+            refresh();
+        } catch(...) {
+            SPDLOG_ERROR("[UObjectClassIndex] Background refresh failed");
+        }
+
+        m_refresh_running.store(false, std::memory_order_release);
+    });
+}
+
+bool UObjectClassIndex::is_indexed(const Slot& slot, UObjectBase* object, int32_t serial_number) {
+    if (object != slot.object) {
+        return false;
+    }
+
+    if (object == nullptr) {
+        return true;
+    }
+
+    // Serial numbers are never reused and a slot's gets cleared when its object is freed,
+    // so a slot indexed with one doesn't need the object itself to be looked at
+    if (slot.serial_number != 0) {
+        return serial_number == slot.serial_number;
+    }
+
+    // They only get handed out once something asks (weak pointers), without one the class is all we can go by
+    return object->get_class() == slot.klass;
+}
+
+void UObjectClassIndex::add_locked(int32_t index, UObjectBase* object, int32_t serial_number, UClass* klass) {
+    auto [it, inserted] = m_by_class.try_emplace(klass);
+
+    if (inserted) {
+        ++m_class_generation;
+    }
+
+    auto& slot = m_slots[index];
+    slot.object = object;
+    slot.klass = klass;
+    slot.serial_number = serial_number;
+    slot.position = (uint32_t)it->second.size();
+
+    it->second.push_back(index);
+}
+
+void UObjectClassIndex::remove_locked(int32_t index) {
+    auto& slot = m_slots[index];
+
+    if (slot.klass != nullptr) {
+        if (auto it = m_by_class.find(slot.klass); it != m_by_class.end()) {
+            auto& indices = it->second;
+
+            // Swap the last one into our place
+            const auto last = indices.back();
+            indices[slot.position] = last;
+            m_slots[last].position = slot.position;
+            indices.pop_back();
+
+            // The class itself might be gone soon (unloaded Blueprints), closures can't keep calling is_a on it
+            if (indices.empty()) {
+                m_by_class.erase(it);
+                ++m_class_generation;
+            }
+        }
+    }
+
+    slot = Slot{};
+}
+
+std::vector<UClass*> UObjectClassIndex::get_closure_locked(UClass* klass, bool exact) {
+    if (exact) {
+        return { klass };
+    }
+
+    std::scoped_lock _{m_closure_mutex};
+
+    // Some class gained its first instance or lost its last one, every closure could be off
+    if (m_closures_generation != m_class_generation) {
+        m_closures.clear();
+        m_closures_generation = m_class_generation;
+    }
+
+    auto [it, inserted] = m_closures.try_emplace(klass);
+
+    if (inserted) {
+        for (const auto& entry : m_by_class) try {
+            if (entry.first->is_a((UStruct*)klass)) {
+                it->second.push_back(entry.first);
+            }
+        } catch(...) {
+            continue;
+        }
+    }
+
+    return it->second;
+}
+
+UObjectClassIndex::Layout UObjectClassIndex::current_layout() {
+    return Layout{
+        UObjectBase::get_class_private_offset(),
+        UStruct::get_super_struct_offset(),
+        (int32_t)FUObjectArray::get_item_distance()
+    };
+}
+}
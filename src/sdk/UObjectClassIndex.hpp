@@ -0,0 +1,102 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "UObjectArray.hpp"
+
+namespace sdk {
+class UClass;
+class UObject;
+
+// Index over GUObjectArray keyed by class so "every live instance of C" costs O(instances)
+// instead of a walk over the whole array with an is_a per object.
+// Slots are snapshotted like UObjectNameIndex, a refresh diffs them against the array in parallel
+// and only the slots that changed get moved between class lists.
+// Lookups kick off a refresh on the scan pool when the last one is older than REFRESH_INTERVAL,
+// so the index keeps up on its own as long as something keeps asking it things.
+class UObjectClassIndex {
+public:
+    constexpr static inline auto REFRESH_INTERVAL = std::chrono::milliseconds{100};
+
+    static UObjectClassIndex* get();
+
+    UObjectClassIndex(FUObjectArray* objects);
+
+    // Instances of klass (and its subclasses unless exact is set) in array order, O(instances).
+    // Whatever is indexed gets validated against the array, objects created since the last refresh show up
+    // once the background one that this starts (at most every REFRESH_INTERVAL) is done.
+    // Passing refresh refreshes on the calling thread first, which makes it O(all objects)
+    // (so does the first call, or the first one after the offsets moved)
+    std::vector<UObject*> find_instances(UClass* klass, bool exact = false, bool refresh = false);
+
+    template<typename T>
+    std::vector<T*> find_instances(bool exact = false, bool refresh = false) {
+        const auto objects = find_instances(T::static_class(), exact, refresh);
+        return std::vector<T*>{(T**)objects.data(), (T**)objects.data() + objects.size()};
+    }
+
+    // Picks up any slots that changed since the last refresh. Walks all of GUObjectArray but only touches
+    // the objects themselves for slots that changed or never had a serial number, lookups only wait for the part
+    // that applies the changes. Calling it every frame (e.g. from the game thread) keeps the background ones from happening
+    void refresh();
+
+    size_t get_num_classes() const {
+        std::shared_lock _{m_mutex};
+        return m_by_class.size();
+    }
+
+private:
+    struct Slot {
+        UObjectBase* object{nullptr};
+        UClass* klass{nullptr};
+        int32_t serial_number{0}; // 0 if the object didn't have one yet
+        uint32_t position{0}; // where this slot's index is in m_by_class[klass]
+    };
+
+    struct Layout {
+        uint32_t class_offset{0};
+        uint32_t super_struct_offset{0};
+        int32_t item_distance{0};
+
+        bool operator==(const Layout& other) const = default;
+    };
+
+    static Layout current_layout();
+
+    // Whether the slot still holds the object it was indexed with
+    static bool is_indexed(const Slot& slot, UObjectBase* object, int32_t serial_number);
+
+    // Doesn't wait, refreshes on the scan pool unless one is running or the last one was too recent
+    void request_refresh();
+    void add_locked(int32_t index, UObjectBase* object, int32_t serial_number, UClass* klass);
+    void remove_locked(int32_t index);
+    std::vector<UClass*> get_closure_locked(UClass* klass, bool exact);
+
+    FUObjectArray* m_objects{nullptr};
+
+    // Refreshes diff under a shared lock, this keeps two of them from diffing at the same time
+    std::mutex m_refresh_mutex{};
+    std::atomic<bool> m_refresh_running{false};
+    std::atomic<int64_t> m_last_refresh{0}; // steady_clock ticks
+
+    mutable std::shared_mutex m_mutex{};
+    std::vector<Slot> m_slots{};
+    std::unordered_map<UClass*, std::vector<int32_t>> m_by_class{};
+    Layout m_layout{};
+
+    // Bumped whenever a class gains its first instance or loses its last one, subclass closures built before that are stale
+    uint64_t m_class_generation{0};
+
+    // Closures get built under a shared lock too, so they have their own.
+    // Only the ones asked for since the set of classes last changed are kept, so classes that got unloaded don't stick around
+    std::mutex m_closure_mutex{};
+    uint64_t m_closures_generation{0};
+    std::unordered_map<UClass*, std::vector<UClass*>> m_closures{};
+};
+}
@@ -10,7 +10,10 @@
 #include <tracy/Tracy.hpp>
 
 #include "EngineModule.hpp"
+#include "ModuleStrings.hpp"
+#include "XrefIndex.hpp"
 
+#include "Memory.hpp"
 #include "UObjectHashTables.hpp"
 
 namespace sdk {
@@ -25,14 +28,14 @@ FUObjectHashTables* FUObjectHashTables::get() {
             return nullptr;
         }
 
-        const auto str = utility::scan_string(core_uobject, L"/Temp/%s", true);
+        const auto str = sdk::ModuleStrings::get(core_uobject).find(L"/Temp/%s", true);
 
         if (!str) {
             SPDLOG_ERROR("[FUObjectHashTables::get] Failed to find /Temp/%s");
             return nullptr;
         }
 
-        const auto str_ref = utility::scan_displacement_reference(core_uobject, *str);
+        const auto str_ref = sdk::XrefIndex::get(core_uobject).find(*str);
 
         if (!str_ref) {
             SPDLOG_ERROR("[FUObjectHashTables::get] Failed to find /Temp/%s reference");
@@ -63,10 +66,10 @@ FUObjectHashTables* FUObjectHashTables::get() {
             uint8_t* ip = (uint8_t*)addr;
 
             if (ix.IsRipRelative && ip[0] == 0xFF && ip[1] == 0x15) {
-                if (*fn != 0 && fn != addr && !IsBadReadPtr((void*)*fn, sizeof(void*))) {
+                if (*fn != 0 && fn != addr && memory::is_readable((void*)*fn, sizeof(void*))) {
                     const auto real_dest = *(uintptr_t*)*fn;
 
-                    if (real_dest != 0 && real_dest != (uintptr_t)ip && !IsBadReadPtr((void*)real_dest, sizeof(void*))) {
+                    if (real_dest != 0 && real_dest != (uintptr_t)ip && memory::is_readable((void*)real_dest, sizeof(void*))) {
                         fn = real_dest;
                     }
                 }
@@ -123,7 +126,7 @@ FUObjectHashTables* FUObjectHashTables::get() {
                     if (register_states.contains(NDR_RCX)) {
                         const auto rcx = register_states[NDR_RCX];
 
-                        if (!IsBadReadPtr((void*)rcx, sizeof(void*)) && utility::get_module_within(rcx) == core_uobject) {
+                        if (memory::is_readable((void*)rcx, sizeof(void*)) && utility::get_module_within(rcx) == core_uobject) {
                             // not the right one
                             if (utility::find_pointer_in_path(containing_fn, &GlobalMemoryStatusEx)) {
                                 return utility::ExhaustionResult::BREAK;
@@ -0,0 +1,435 @@
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "UObject.hpp"
+#include "UClass.hpp"
+#include "UObjectNameIndex.hpp"
+
+namespace sdk {
+UObjectNameIndex* UObjectNameIndex::get() {
+    static auto result = []() -> std::unique_ptr<UObjectNameIndex> {
+        ZoneScopedN("sdk::UObjectNameIndex::get static init");
+
+        const auto objects = FUObjectArray::get();
+
+        if (objects == nullptr) {
+            return nullptr;
+        }
+
+        SPDLOG_INFO("[UObjectNameIndex::get] Creating full name index");
+        return std::make_unique<UObjectNameIndex>(objects);
+    }();
+
+    return result.get();
+}
+
+UObjectNameIndex::UObjectNameIndex(FUObjectArray* objects, NameResolver resolver)
+    : m_objects{objects},
+    m_resolver{resolver ? std::move(resolver) : NameResolver{&UObjectNameIndex::resolve_with_constructor}}
+{
+}
+
+std::optional<UObjectBase*> UObjectNameIndex::find(std::wstring_view full_name) try {
+    if (m_objects == nullptr) {
+        return std::nullopt;
+    }
+
+    const auto parsed = parse(full_name);
+
+    if (!parsed) {
+        return std::nullopt;
+    }
+
+    // Not in the name pool, so no object can be named this
+    if (parsed->missing) {
+        return nullptr;
+    }
+
+    uint64_t hash = 0;
+
+    for (size_t i = 0; i < parsed->count; ++i) {
+        hash = mix(hash, parsed->keys[i]);
+    }
+
+    // Nothing appended and we just looked, a refresh would almost certainly find nothing new
+    const auto is_fresh_locked = [&]() {
+        return is_built_locked()
+            && m_refreshed_count == m_objects->get_object_count()
+            && std::chrono::steady_clock::now() - m_refreshed_at < MISS_REFRESH_INTERVAL;
+    };
+
+    bool is_built = false;
+
+    {
+        std::shared_lock _{m_mutex};
+
+        is_built = is_built_locked();
+
+        if (is_built) {
+            if (const auto result = find_locked(hash, *parsed, full_name); result != nullptr || is_fresh_locked()) {
+                return result;
+            }
+        }
+    }
+
+    std::unique_lock refresh_lock{m_refresh_mutex, std::defer_lock};
+
+    // Someone else is building it, walking the array ourselves beats waiting for all of it
+    if (is_built) {
+        refresh_lock.lock();
+    } else if (!refresh_lock.try_lock()) {
+        return std::nullopt;
+    }
+
+    // Missed, pick up whatever changed in the array and try again.
+    // Whoever held the lock before us might have just done it. Only refreshes change the slots, so with
+    // m_refresh_mutex held they can be looked at without m_mutex
+    if (!is_fresh_locked()) {
+        update();
+    }
+
+    std::shared_lock _{m_mutex};
+
+    if (!is_built_locked()) {
+        return std::nullopt;
+    }
+
+    return find_locked(hash, *parsed, full_name);
+} catch(...) {
+    SPDLOG_ERROR("[UObjectNameIndex::find] Exception occurred during lookup");
+    return std::nullopt;
+}
+
+void UObjectNameIndex::refresh() {
+    std::scoped_lock _{m_refresh_mutex};
+    update();
+}
+
+bool UObjectNameIndex::is_built_locked() const {
+    return !m_slots.empty() && m_layout == current_layout();
+}
+
+void UObjectNameIndex::update() {
+    // Never built, or the offsets or FName layout changed underneath us and everything we hashed is garbage now
+    if (!is_built_locked()) {
+        build();
+        return;
+    }
+
+    std::unique_lock _{m_mutex};
+    refresh_locked();
+}
+
+void UObjectNameIndex::build() {
+    ZoneScopedN("sdk::UObjectNameIndex::build");
+
+    const auto layout = current_layout();
+    const auto count = m_objects->get_object_count();
+    const auto now = std::chrono::high_resolution_clock::now();
+
+    // Built on the side, lookups keep using whatever was there (or fall back) until it's swapped in
+    std::vector<Slot> slots(std::max(count, 0));
+    std::unordered_multimap<uint64_t, int32_t> lookup{};
+    lookup.reserve(slots.size());
+
+    for (auto i = 0; i < count; ++i) try {
+        const auto item = m_objects->get_object(i);
+        const auto object = item != nullptr ? item->object : nullptr;
+
+        if (object != nullptr && index_slot(slots[i], object)) {
+            lookup.emplace(slots[i].hash, i);
+        }
+    } catch(...) {
+        continue;
+    }
+
+    const auto num_indexed = lookup.size();
+
+    {
+        std::unique_lock _{m_mutex};
+
+        // The old ones get freed after the lock is gone
+        m_slots.swap(slots);
+        m_lookup.swap(lookup);
+        m_layout = layout;
+        m_refreshed_count = count;
+        m_refreshed_at = std::chrono::steady_clock::now();
+    }
+
+    const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - now).count();
+    SPDLOG_INFO("[UObjectNameIndex] Indexed {} objects in {} ms", num_indexed, time_elapsed);
+}
+
+void UObjectNameIndex::refresh_locked() {
+    ZoneScopedN("sdk::UObjectNameIndex::refresh");
+
+    const auto count = m_objects->get_object_count();
+
+    if (count <= 0) {
+        return;
+    }
+
+    m_refreshed_count = count;
+    m_refreshed_at = std::chrono::steady_clock::now();
+
+    for (auto i = (int32_t)m_slots.size() - 1; i >= count; --i) {
+        remove_locked(i);
+    }
+
+    m_slots.resize(count);
+
+    size_t num_changed = 0;
+
+    for (auto i = 0; i < count; ++i) try {
+        auto& slot = m_slots[i];
+
+        const auto item = m_objects->get_object(i);
+        const auto object = item != nullptr ? item->object : nullptr;
+
+        if (object == slot.object) {
+            if (object == nullptr) {
+                continue;
+            }
+
+            // Same pointer, but it could have been freed and reallocated as something else
+            if (object->get_class() == slot.klass && object->get_outer() == slot.outer && make_key(object->get_fname()) == slot.name) {
+                continue;
+            }
+        }
+
+        ++num_changed;
+        remove_locked(i);
+
+        if (object != nullptr && index_slot(slot, object)) {
+            m_lookup.emplace(slot.hash, i);
+        }
+    } catch(...) {
+        continue;
+    }
+
+    if (num_changed > 0) {
+        SPDLOG_INFO("[UObjectNameIndex] Refreshed {} changed slots", num_changed);
+    }
+}
+
+bool UObjectNameIndex::index_slot(Slot& slot, UObjectBase* object) {
+    slot.object = object;
+    slot.klass = object->get_class();
+    slot.outer = object->get_outer();
+    slot.name = make_key(object->get_fname());
+
+    // get_full_name gives these "null", not worth indexing
+    if (slot.klass == nullptr) {
+        return false;
+    }
+
+    slot.hash = hash_object(object);
+    slot.indexed = true;
+
+    return true;
+}
+
+void UObjectNameIndex::remove_locked(int32_t index) {
+    auto& slot = m_slots[index];
+
+    if (slot.indexed) {
+        auto [begin, end] = m_lookup.equal_range(slot.hash);
+
+        for (auto it = begin; it != end; ++it) {
+            if (it->second == index) {
+                m_lookup.erase(it);
+                break;
+            }
+        }
+    }
+
+    slot = Slot{};
+}
+
+UObjectBase* UObjectNameIndex::find_locked(uint64_t hash, const ParsedName& parsed, std::wstring_view full_name) const {
+    // More than one object can have the same name, the one a walk in array order would find first wins
+    int32_t best_index = INT32_MAX;
+    UObjectBase* result = nullptr;
+
+    auto [begin, end] = m_lookup.equal_range(hash);
+
+    for (auto it = begin; it != end; ++it) try {
+        if (it->second >= best_index) {
+            continue;
+        }
+
+        const auto item = m_objects->get_object(it->second);
+
+        if (item == nullptr) {
+            continue;
+        }
+
+        const auto object = item->object;
+
+        // Slot changed since we last looked at it
+        if (object == nullptr || object != m_slots[it->second].object) {
+            continue;
+        }
+
+        // Hash collisions and renames both get filtered out by the FName compare,
+        // names that only match if case is ignored by the string one
+        if (matches(object, parsed) && object->full_name_equals(full_name)) {
+            best_index = it->second;
+            result = object;
+        }
+    } catch(...) {
+        continue;
+    }
+
+    return result;
+}
+
+std::optional<UObjectNameIndex::ParsedName> UObjectNameIndex::parse(std::wstring_view full_name) const {
+    // "Class /Script/Engine.Actor"
+    const auto space = full_name.find(L' ');
+
+    if (space == std::wstring_view::npos || space == 0 || space + 1 >= full_name.size()) {
+        return std::nullopt;
+    }
+
+    const auto class_name = full_name.substr(0, space);
+    const auto path = full_name.substr(space + 1);
+
+    std::array<std::wstring_view, MAX_DEPTH> segments{};
+    size_t num_segments = 0;
+
+    for (size_t start = 0;;) {
+        const auto dot = path.find(L'.', start);
+        const auto segment = dot == std::wstring_view::npos ? path.substr(start) : path.substr(start, dot - start);
+
+        if (segment.empty() || num_segments >= segments.size()) {
+            return std::nullopt;
+        }
+
+        segments[num_segments++] = segment;
+
+        if (dot == std::wstring_view::npos) {
+            break;
+        }
+
+        start = dot + 1;
+    }
+
+    ParsedName result{};
+
+    // The FName constructor wants a null terminated string
+    wchar_t buffer[MAX_NAME_LENGTH]{};
+
+    const auto add = [&](std::wstring_view segment) -> bool {
+        if (segment.size() >= MAX_NAME_LENGTH) {
+            return false;
+        }
+
+        std::copy(segment.begin(), segment.end(), buffer);
+        buffer[segment.size()] = L'\0';
+
+        const auto key = m_resolver(std::wstring_view{buffer, segment.size()});
+
+        if (!key) {
+            return false;
+        }
+
+        if (key->index == 0 && segment != L"None") {
+            result.missing = true;
+        }
+
+        result.keys[result.count++] = *key;
+        return true;
+    };
+
+    if (!add(class_name)) {
+        return std::nullopt;
+    }
+
+    for (auto i = (int32_t)num_segments - 1; i >= 0; --i) {
+        if (!add(segments[i])) {
+            return std::nullopt;
+        }
+    }
+
+    return result;
+}
+
+bool UObjectNameIndex::matches(UObjectBase* object, const ParsedName& parsed) const {
+    const auto c = object->get_class();
+
+    if (c == nullptr || make_key(c->get_fname()) != parsed.keys[0]) {
+        return false;
+    }
+
+    const UObjectBase* current = object;
+
+    for (size_t i = 1; i < parsed.count; ++i) {
+        if (current == nullptr || make_key(current->get_fname()) != parsed.keys[i]) {
+            return false;
+        }
+
+        current = current->get_outer();
+
+        // same termination as get_full_name
+        if (current == object) {
+            current = nullptr;
+        }
+    }
+
+    return current == nullptr;
+}
+
+UObjectNameIndex::Layout UObjectNameIndex::current_layout() {
+    return Layout{
+        FName::s_is_case_preserving,
+        UObjectBase::get_class_private_offset(),
+        UObjectBase::get_fname_offset(),
+        UObjectBase::get_outer_private_offset()
+    };
+}
+
+uint64_t UObjectNameIndex::mix(uint64_t hash, NameKey key) {
+    // FNV-1a over the packed key with an extra fold so close indices spread out
+    hash ^= ((uint64_t)(uint32_t)key.index << 32) | (uint32_t)key.number;
+    hash *= 0x100000001B3;
+    hash ^= hash >> 29;
+
+    return hash;
+}
+
+uint64_t UObjectNameIndex::hash_object(UObjectBase* object) {
+    auto hash = mix(0, make_key(object->get_class()->get_fname()));
+
+    const UObjectBase* current = object;
+
+    for (auto depth = 0; current != nullptr && depth < MAX_DEPTH; ++depth) {
+        hash = mix(hash, make_key(current->get_fname()));
+
+        current = current->get_outer();
+
+        if (current == object) {
+            break;
+        }
+    }
+
+    return hash;
+}
+
+std::optional<UObjectNameIndex::NameKey> UObjectNameIndex::resolve_with_constructor(std::wstring_view name) {
+    const auto fname = FName::find(name);
+
+    if (!fname) {
+        return std::nullopt;
+    }
+
+    return make_key(*fname);
+}
+}
\ No newline at end of file
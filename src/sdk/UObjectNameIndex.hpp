@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <chrono>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "UObjectArray.hpp"
+
+namespace sdk {
+class UClass;
+class UObject;
+
+// Index over GUObjectArray keyed by a hash of (class FName, object FName, outer FNames)
+// so full name lookups don't have to walk the entire array building strings for every object.
+// Slots are snapshotted and only the ones that changed get rehashed when we miss.
+// The hash goes by FName comparison indices, which don't care about case, so every hit gets checked against
+// the full name as well. Answers are the same as comparing get_full_name() in array order: case sensitive, lowest index first.
+class UObjectNameIndex {
+public:
+    struct NameKey {
+        int32_t index{0};
+        int32_t number{0};
+
+        bool operator==(const NameKey& other) const {
+            return index == other.index && number == other.number;
+        }
+    };
+
+    // Takes a null terminated name, returns the FName parts for it
+    // std::nullopt means the name couldn't be resolved at all (e.g. no FName constructor)
+    using NameResolver = std::function<std::optional<NameKey>(std::wstring_view)>;
+
+    static UObjectNameIndex* get();
+
+    UObjectNameIndex(FUObjectArray* objects, NameResolver resolver = {});
+
+    // std::nullopt means the index can't answer this query and the caller should fall back to a linear walk,
+    // that includes while another thread is still building it. nullptr means the object doesn't exist as of the last refresh. A miss refreshes first, unless the array hasn't grown
+    // and the last refresh was less than MISS_REFRESH_INTERVAL ago, so looking up things that don't exist over and over stays cheap.
+    // A new object in a reused slot can take up to that long to show up, call refresh() to pick it up right away
+    std::optional<UObjectBase*> find(std::wstring_view full_name);
+
+    // Picks up any slots that changed since the last refresh
+    void refresh();
+
+    size_t size() const {
+        std::shared_lock _{m_mutex};
+        return m_lookup.size();
+    }
+
+    static NameKey make_key(const FName& name) {
+        return NameKey{ name.a1, name.get_number() };
+    }
+
+public:
+    // Names can't really nest deeper than this, anything deeper just falls back
+    constexpr static inline auto MAX_DEPTH = 32;
+    constexpr static inline auto MAX_NAME_LENGTH = 1024;
+    constexpr static inline auto MISS_REFRESH_INTERVAL = std::chrono::milliseconds{100};
+
+private:
+    struct Slot {
+        UObjectBase* object{nullptr};
+        UClass* klass{nullptr};
+        UObject* outer{nullptr};
+        NameKey name{};
+        uint64_t hash{0};
+        bool indexed{false};
+    };
+
+    struct Layout {
+        bool case_preserving{false};
+        uint32_t class_offset{0};
+        uint32_t fname_offset{0};
+        uint32_t outer_offset{0};
+
+        bool operator==(const Layout& other) const = default;
+    };
+
+    // Class first, then the object name, then the outers going outward
+    struct ParsedName {
+        std::array<NameKey, MAX_DEPTH + 1> keys{};
+        size_t count{0};
+        bool missing{false}; // one of the names isn't in the name pool, so nothing can match
+    };
+
+    static Layout current_layout();
+    static uint64_t mix(uint64_t hash, NameKey key);
+    static uint64_t hash_object(UObjectBase* object);
+    static std::optional<NameKey> resolve_with_constructor(std::wstring_view name);
+
+    // Fills in a slot for object, false if it's not worth indexing
+    static bool index_slot(Slot& slot, UObjectBase* object);
+
+    std::optional<ParsedName> parse(std::wstring_view full_name) const;
+    bool matches(UObjectBase* object, const ParsedName& parsed) const;
+    UObjectBase* find_locked(uint64_t hash, const ParsedName& parsed, std::wstring_view full_name) const;
+    bool is_built_locked() const;
+
+    // These need m_refresh_mutex. build doesn't hold m_mutex while walking the array, only to swap the result in
+    void update();
+    void build();
+    void refresh_locked();
+    void remove_locked(int32_t index);
+
+    FUObjectArray* m_objects{nullptr};
+    NameResolver m_resolver{};
+
+    // Taken before m_mutex, keeps a build and a refresh (or two of either) from running at once
+    std::mutex m_refresh_mutex{};
+    mutable std::shared_mutex m_mutex{};
+    std::vector<Slot> m_slots{};
+    std::unordered_multimap<uint64_t, int32_t> m_lookup{};
+    Layout m_layout{};
+
+    // What the array looked like at the last refresh, for telling whether a miss is worth refreshing for
+    int32_t m_refreshed_count{0};
+    std::chrono::steady_clock::time_point m_refreshed_at{};
+};
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include <mutex>
+#include <deque>
+#include <thread>
+#include <memory>
+#include <algorithm>
+#include <condition_variable>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "UObject.hpp"
+#include "UClass.hpp"
+#include "UFunction.hpp"
+#include "UObjectScan.hpp"
+
+namespace sdk {
+namespace detail {
+// Persistent pool so scans don't pay for thread creation, workers sleep between scans.
+// One scan runs at a time, the calling thread pulls tasks alongside the workers.
+// Submitted work only gets picked up by workers that have nothing better to do, scans always go first.
+class ScanPool {
+public:
+    struct Job {
+        const UObjectScan::TaskFn* fn{nullptr};
+        size_t num_tasks{0};
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> remaining{0};
+
+        void work() {
+            for (auto t = next.fetch_add(1); t < num_tasks; t = next.fetch_add(1)) {
+                try {
+                    (*fn)(t);
+                } catch(...) {
+                    SPDLOG_ERROR("[UObjectScan] Exception in task {}", t);
+                }
+
+                if (remaining.fetch_sub(1) == 1) {
+                    remaining.notify_all();
+                }
+            }
+        }
+    };
+
+    ScanPool() {
+        // At least one, submitted work would never run otherwise
+        const auto hw = std::thread::hardware_concurrency();
+        const auto num_workers = hw > 2 ? hw - 1 : 1;
+
+        for (size_t i = 0; i < num_workers; ++i) {
+            m_workers.emplace_back([this](std::stop_token stop) { worker(stop); });
+        }
+
+        SPDLOG_INFO("[UObjectScan] Started {} scan workers", num_workers);
+    }
+
+    size_t get_num_workers() const {
+        return m_workers.size();
+    }
+
+    void run(size_t num_tasks, const UObjectScan::TaskFn& fn) {
+        if (num_tasks == 0) {
+            return;
+        }
+
+        // Not worth waking anyone up, or we're already inside a scan and the workers are busy with it
+        if (num_tasks == 1 || s_in_scan) {
+            run_serial(num_tasks, fn);
+            return;
+        }
+
+        std::scoped_lock run_lock{m_run_mutex};
+
+        auto job = std::make_shared<Job>();
+        job->fn = &fn;
+        job->num_tasks = num_tasks;
+        job->remaining = num_tasks;
+
+        {
+            std::scoped_lock _{m_mutex};
+            m_job = job;
+            ++m_generation;
+        }
+
+        m_cv.notify_all();
+
+        s_in_scan = true;
+        job->work();
+        s_in_scan = false;
+
+        for (auto remaining = job->remaining.load(); remaining != 0; remaining = job->remaining.load()) {
+            job->remaining.wait(remaining);
+        }
+
+        // Workers that wake up late see a finished job and go back to sleep
+        std::scoped_lock _{m_mutex};
+        m_job.reset();
+    }
+
+    void submit(std::function<void()> fn) {
+        {
+            std::scoped_lock _{m_mutex};
+            m_submitted.push_back(std::move(fn));
+        }
+
+        m_cv.notify_one();
+    }
+
+private:
+    static void run_serial(size_t num_tasks, const UObjectScan::TaskFn& fn) {
+        const auto was_in_scan = s_in_scan;
+        s_in_scan = true;
+
+        for (size_t t = 0; t < num_tasks; ++t) {
+            try {
+                fn(t);
+            } catch(...) {
+                SPDLOG_ERROR("[UObjectScan] Exception in task {}", t);
+            }
+        }
+
+        s_in_scan = was_in_scan;
+    }
+
+    void worker(std::stop_token stop) {
+        uint64_t seen_generation = 0;
+
+        while (!stop.stop_requested()) {
+            std::shared_ptr<Job> job{};
+            std::function<void()> submitted{};
+
+            {
+                std::unique_lock lock{m_mutex};
+                m_cv.wait(lock, stop, [&] { return m_generation != seen_generation || !m_submitted.empty(); });
+
+                if (stop.stop_requested()) {
+                    return;
+                }
+
+                if (m_generation != seen_generation) {
+                    seen_generation = m_generation;
+                    job = m_job;
+                } else {
+                    submitted = std::move(m_submitted.front());
+                    m_submitted.pop_front();
+                }
+            }
+
+            if (job != nullptr) {
+                s_in_scan = true;
+                job->work();
+                s_in_scan = false;
+            } else if (submitted) {
+                // Not inside a scan, so it can start its own and have the other workers help with it
+                try {
+                    submitted();
+                } catch(...) {
+                    SPDLOG_ERROR("[UObjectScan] Exception in submitted work");
+                }
+            }
+        }
+    }
+
+    static inline thread_local bool s_in_scan{false};
+
+    std::mutex m_run_mutex{};
+    std::mutex m_mutex{};
+    std::condition_variable_any m_cv{};
+    std::shared_ptr<Job> m_job{};
+    uint64_t m_generation{0};
+    std::deque<std::function<void()>> m_submitted{};
+    std::vector<std::jthread> m_workers{};
+};
+
+ScanPool& get_scan_pool() {
+    // Never destroyed, joining threads while the DLL is unloading deadlocks on the loader lock
+    static auto pool = new ScanPool{};
+    return *pool;
+}
+}
+
+void UObjectScan::run(int32_t count, const RangeFn& fn) {
+    const TaskFn task = [&](size_t range_index) {
+        const auto begin = (int32_t)(range_index * RANGE_SIZE);
+        const auto end = std::min<int32_t>(begin + RANGE_SIZE, count);
+
+        fn(range_index, begin, end);
+    };
+
+    detail::get_scan_pool().run(get_num_ranges(count), task);
+}
+
+void UObjectScan::run_tasks(size_t num_tasks, const TaskFn& fn) {
+    detail::get_scan_pool().run(num_tasks, fn);
+}
+
+void UObjectScan::submit(std::function<void()> fn) {
+    detail::get_scan_pool().submit(std::move(fn));
+}
+
+size_t UObjectScan::get_num_workers() {
+    return detail::get_scan_pool().get_num_workers();
+}
+
+std::vector<UObject*> UObjectScan::find_instances_of(UClass* klass) {
+    ZoneScopedN("sdk::UObjectScan::find_instances_of");
+
+    if (klass == nullptr) {
+        return {};
+    }
+
+    const auto objects = find_all([klass](UObjectBase* object) {
+        return ((UObject*)object)->is_a(klass);
+    });
+
+    return std::vector<UObject*>{(UObject**)objects.data(), (UObject**)objects.data() + objects.size()};
+}
+
+std::vector<UFunction*> UObjectScan::find_functions_with_flags(uint32_t flags) {
+    ZoneScopedN("sdk::UObjectScan::find_functions_with_flags");
+
+    const auto ufunction_t = UFunction::static_class();
+
+    if (ufunction_t == nullptr) {
+        return {};
+    }
+
+    const auto objects = find_all([ufunction_t, flags](UObjectBase* object) {
+        return ((UObject*)object)->is_a(ufunction_t) && (((UFunction*)object)->get_function_flags() & flags) == flags;
+    });
+
+    return std::vector<UFunction*>{(UFunction**)objects.data(), (UFunction**)objects.data() + objects.size()};
+}
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include "UObjectArray.hpp"
+
+namespace sdk {
+class UClass;
+class UObject;
+class UFunction;
+
+// Splits GUObjectArray into chunk aligned ranges and runs them across a shared worker pool.
+// The pool is also open to other parallel work through run_tasks and submit.
+// Callbacks run concurrently on worker threads (and the calling thread), null items/objects are skipped
+// and an exception thrown while visiting an object just skips that object.
+// Results from the find_* helpers are always in array order regardless of how the ranges got scheduled.
+class UObjectScan {
+public:
+    // Lines up with both OBJECTS_PER_CHUNK and OBJECTS_PER_CHUNK_INLINED, so a range never crosses a chunk
+    constexpr static inline int32_t RANGE_SIZE = FUObjectArray::OBJECTS_PER_CHUNK_INLINED;
+    static_assert(FUObjectArray::OBJECTS_PER_CHUNK % RANGE_SIZE == 0);
+
+    using RangeFn = std::function<void(size_t range_index, int32_t begin, int32_t end)>;
+
+    // Calls fn once per range covering [0, count), blocks until every range is done.
+    // Falls back to running serially when called from inside another scan
+    static void run(int32_t count, const RangeFn& fn);
+
+    static size_t get_num_ranges(int32_t count) {
+        return count > 0 ? (size_t)((count + RANGE_SIZE - 1) / RANGE_SIZE) : 0;
+    }
+
+    // Worker threads, not counting whoever calls run()
+    static size_t get_num_workers();
+
+    // The same pool for work that has nothing to do with GUObjectArray (decoding modules, resolving signatures),
+    // so there's one set of worker threads instead of one per subsystem.
+    // Calls fn(i) for every i in [0, num_tasks), same blocking and nesting rules as run
+    using TaskFn = std::function<void(size_t index)>;
+    static void run_tasks(size_t num_tasks, const TaskFn& fn);
+
+    // Fire and forget, runs on a worker once it has no scan to help with.
+    // Meant for the few long running things that shouldn't block whoever starts them
+    static void submit(std::function<void()> fn);
+
+    // Visits [begin, end) on the calling thread, walking the chunk with the item stride instead of get_object per index.
+    // visitor(int32_t index, UObjectBase* object), return false to stop early
+    template<typename F>
+    static bool visit_range(FUObjectArray* objects, int32_t begin, int32_t end, F&& visitor) {
+        const auto first = objects->get_object(begin);
+
+        // Chunk hasn't been allocated
+        if (first == nullptr) {
+            return true;
+        }
+
+        const auto stride = (uintptr_t)FUObjectArray::get_item_distance();
+        auto item = (uintptr_t)first;
+
+        for (auto i = begin; i < end; ++i, item += stride) try {
+            const auto object = ((FUObjectItem*)item)->object;
+
+            if (object == nullptr) {
+                continue;
+            }
+
+            if (!visitor(i, object)) {
+                return false;
+            }
+        } catch(...) {
+            continue;
+        }
+
+        return true;
+    }
+
+    // visitor(int32_t index, UObjectBase* object)
+    template<typename F>
+    static void for_each(F&& visitor, FUObjectArray* objects = FUObjectArray::get()) {
+        if (objects == nullptr) {
+            return;
+        }
+
+        run(objects->get_object_count(), [&](size_t, int32_t begin, int32_t end) {
+            visit_range(objects, begin, end, [&](int32_t i, UObjectBase* object) {
+                visitor(i, object);
+                return true;
+            });
+        });
+    }
+
+    // Every object pred(object) returns true for
+    template<typename P>
+    static std::vector<UObjectBase*> find_all(P&& pred, FUObjectArray* objects = FUObjectArray::get()) {
+        if (objects == nullptr) {
+            return {};
+        }
+
+        const auto count = objects->get_object_count();
+        std::vector<std::vector<UObjectBase*>> per_range(get_num_ranges(count));
+
+        run(count, [&](size_t range_index, int32_t begin, int32_t end) {
+            auto& out = per_range[range_index];
+
+            visit_range(objects, begin, end, [&](int32_t, UObjectBase* object) {
+                if (pred(object)) {
+                    out.push_back(object);
+                }
+
+                return true;
+            });
+        });
+
+        size_t total = 0;
+
+        for (const auto& range : per_range) {
+            total += range.size();
+        }
+
+        std::vector<UObjectBase*> result{};
+        result.reserve(total);
+
+        for (const auto& range : per_range) {
+            result.insert(result.end(), range.begin(), range.end());
+        }
+
+        return result;
+    }
+
+    // Lowest index object pred(object) returns true for, same answer a serial walk would give
+    template<typename P>
+    static UObjectBase* find_first(P&& pred, FUObjectArray* objects = FUObjectArray::get()) {
+        if (objects == nullptr) {
+            return nullptr;
+        }
+
+        std::atomic<int32_t> best_index{INT32_MAX};
+        const auto count = objects->get_object_count();
+        std::vector<UObjectBase*> per_range(get_num_ranges(count));
+
+        run(count, [&](size_t range_index, int32_t begin, int32_t end) {
+            // Something earlier already matched
+            if (begin > best_index.load(std::memory_order_relaxed)) {
+                return;
+            }
+
+            visit_range(objects, begin, end, [&](int32_t i, UObjectBase* object) {
+                if (i > best_index.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+
+                if (!pred(object)) {
+                    return true;
+                }
+
+                per_range[range_index] = object;
+
+                auto current = best_index.load(std::memory_order_relaxed);
+                while (i < current && !best_index.compare_exchange_weak(current, i, std::memory_order_relaxed)) {}
+
+                return false;
+            });
+        });
+
+        for (const auto object : per_range) {
+            if (object != nullptr) {
+                return object;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Instances of klass or any subclass of it
+    static std::vector<UObject*> find_instances_of(UClass* klass);
+
+    // UFunctions with all of flags set
+    static std::vector<UFunction*> find_functions_with_flags(uint32_t flags);
+};
+}
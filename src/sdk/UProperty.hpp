@@ -20,5 +20,6 @@ private:
 
     friend class UStruct;
     friend class FProperty;
+    friend class UBoolProperty;
 };
 }
\ No newline at end of file
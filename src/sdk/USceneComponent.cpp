@@ -7,6 +7,7 @@
 #include "FProperty.hpp"
 #include "ScriptTransform.hpp"
 #include "UFunction.hpp"
+#include "ParamFrame.hpp"
 
 #include "USceneComponent.hpp"
 
@@ -18,275 +19,207 @@ UClass* USceneComponent::static_class() {
 
 void USceneComponent::set_world_rotation(const glm::vec3& rotation, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_SetWorldRotation");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
-    const auto frotator = sdk::ScriptVector::static_struct();
-    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
+    static const auto rotation_offset = ParamFrame::find_offset(fn, L"NewRotation");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
 
-    // Need to dynamically allocate the params because of unknown FRotator size
-    std::vector<uint8_t> params{};
+    const auto frotator = sdk::ScriptRotator::static_struct();
+    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&rotation, (uint8_t*)&rotation + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> rot = rotation;
-        params.insert(params.end(), (uint8_t*)&rot, (uint8_t*)&rot + sizeof(glm::vec<3, double>));
-    }
+    ParamFrame params{fn};
 
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&sweep + sizeof(bool));
-    
-    // align up to 8 based on size
-    if (params.size() % sizeof(void*) != 0) {
-        params.insert(params.end(), sizeof(void*) - (params.size() % sizeof(void*)), 0);
+    if (!params) {
+        return;
     }
 
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    params.set_vector(rotation_offset, rotation, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 void USceneComponent::add_world_rotation(const glm::vec3& rotation, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_AddWorldRotation");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
-    const auto frotator = sdk::ScriptVector::static_struct();
-    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
-
-    // Need to dynamically allocate the params because of unknown FRotator size
-    std::vector<uint8_t> params{};
+    static const auto rotation_offset = ParamFrame::find_offset(fn, L"DeltaRotation");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&rotation, (uint8_t*)&rotation + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> rot = rotation;
-        params.insert(params.end(), (uint8_t*)&rot, (uint8_t*)&rot + sizeof(glm::vec<3, double>));
-    }
+    const auto frotator = sdk::ScriptRotator::static_struct();
+    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&sweep + sizeof(bool));
+    ParamFrame params{fn};
 
-    // align up to 8 based on size
-    if (params.size() % sizeof(void*) != 0) {
-        params.insert(params.end(), sizeof(void*) - (params.size() % sizeof(void*)), 0);
+    if (!params) {
+        return;
     }
 
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    params.set_vector(rotation_offset, rotation, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 void USceneComponent::set_world_location(const glm::vec3& location, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_SetWorldLocation");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
+    static const auto location_offset = ParamFrame::find_offset(fn, L"NewLocation");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
+
     const auto fvector = sdk::ScriptVector::static_struct();
     const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // Need to dynamically allocate the params because of unknown FVector size
-    std::vector<uint8_t> params{};
+    ParamFrame params{fn};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&location, (uint8_t*)&location + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> loc = location;
-        params.insert(params.end(), (uint8_t*)&loc, (uint8_t*)&loc + sizeof(glm::vec<3, double>));
+    if (!params) {
+        return;
     }
 
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&sweep + sizeof(bool));
-    // align
-    //params.insert(params.end(), 3, 0);
-    // align up to 8 based on size
-    if (params.size() % sizeof(void*) != 0) {
-        params.insert(params.end(), sizeof(void*) - (params.size() % sizeof(void*)), 0);
-    }
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    params.set_vector(location_offset, location, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 void USceneComponent::add_world_offset(const glm::vec3& location, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_AddWorldOffset");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
+    static const auto location_offset = ParamFrame::find_offset(fn, L"DeltaLocation");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
+
     const auto fvector = sdk::ScriptVector::static_struct();
     const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // Need to dynamically allocate the params because of unknown FVector size
-    std::vector<uint8_t> params{};
-
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&location, (uint8_t*)&location + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> loc = location;
-        params.insert(params.end(), (uint8_t*)&loc, (uint8_t*)&loc + sizeof(glm::vec<3, double>));
-    }
-
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&sweep + sizeof(bool));
+    ParamFrame params{fn};
 
-    // align up to 8 based on size
-    if (params.size() % sizeof(void*) != 0) {
-        params.insert(params.end(), sizeof(void*) - (params.size() % sizeof(void*)), 0);
+    if (!params) {
+        return;
     }
 
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    params.set_vector(location_offset, location, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 void USceneComponent::add_local_rotation(const glm::vec3& rotation, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_AddLocalRotation");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
-    const auto frotator = sdk::ScriptVector::static_struct();
-    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
-
-    // Need to dynamically allocate the params because of unknown FRotator size
-    std::vector<uint8_t> params{};
+    static const auto rotation_offset = ParamFrame::find_offset(fn, L"DeltaRotation");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), (uint8_t*)&rotation, (uint8_t*)&rotation + sizeof(glm::vec3));
-    } else {
-        glm::vec<3, double> rot = rotation;
-        params.insert(params.end(), (uint8_t*)&rot, (uint8_t*)&rot + sizeof(glm::vec<3, double>));
-    }
+    const auto frotator = sdk::ScriptRotator::static_struct();
+    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&sweep + sizeof(bool));
+    ParamFrame params{fn};
 
-    // align up to 8 based on size
-    if (params.size() % sizeof(void*) != 0) {
-        params.insert(params.end(), sizeof(void*) - (params.size() % sizeof(void*)), 0);
+    if (!params) {
+        return;
     }
 
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    params.set_vector(rotation_offset, rotation, is_ue5);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 void USceneComponent::set_local_transform(const glm::vec3& location, const glm::vec4& rotation, const glm::vec3& scale, bool sweep, bool teleport) {
     static auto fn = static_class()->find_function(L"K2_SetRelativeTransform");
-    static const auto fhitresult = sdk::find_uobject<UScriptStruct>(L"ScriptStruct /Script/Engine.HitResult");
 
     if (fn == nullptr) {
         return;
     }
 
-    static const auto fvector = sdk::ScriptVector::static_struct();
-    static const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
-
-    // Need to dynamically allocate the params because of unknown FVector size
-    std::vector<uint8_t> params{};
-
-    const auto transform_struct = sdk::ScriptTransform::create_dynamic_struct(location, rotation, scale);
-    params.insert(params.end(), transform_struct.begin(), transform_struct.end());
+    static const auto transform_offset = ParamFrame::find_offset(fn, L"NewTransform");
+    static const auto sweep_offset = ParamFrame::find_offset(fn, L"bSweep");
+    static const auto teleport_offset = ParamFrame::find_offset(fn, L"bTeleport");
 
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&sweep, (uint8_t*)&sweep + sizeof(bool));
+    ParamFrame params{fn};
 
-    // Pad until the offset of SweepHitResult
-    static const auto sweep_hit_result_offset = fn->find_property(L"SweepHitResult")->get_offset();
-    if (params.size() != sweep_hit_result_offset) {
-        params.insert(params.end(), sweep_hit_result_offset - params.size(), 0);
+    if (!params || transform_offset < 0) {
+        return;
     }
 
-    // add a FHitResult
-    params.insert(params.end(), fhitresult->get_struct_size(), 0);
-
-    // add a bool
-    params.insert(params.end(), (uint8_t*)&teleport, (uint8_t*)&teleport + sizeof(bool));
+    sdk::ScriptTransform::write_to(params.data() + transform_offset, location, rotation, scale);
+    params.set(sweep_offset, sweep);
+    params.set(teleport_offset, teleport);
 
     this->process_event(fn, params.data());
 }
 
 glm::vec3 USceneComponent::get_world_location() {
     static const auto func = static_class()->find_function(L"K2_GetComponentLocation");
-    const auto fvector = sdk::ScriptVector::static_struct();
 
+    if (func == nullptr) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
+    }
+
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
+
+    const auto fvector = sdk::ScriptVector::static_struct();
     const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    std::vector<uint8_t> params{};
+    ParamFrame params{func};
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), sizeof(glm::vec3), 0);
-    } else {
-        params.insert(params.end(), sizeof(glm::vec<3, double>), 0);
+    if (!params) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
     this->process_event(func, params.data());
 
-    if (!is_ue5) {
-        return *(glm::vec3*)params.data();
-    }
-        
-    return *(glm::vec<3, double>*)params.data();
+    return params.get_vector(ret_offset, is_ue5);
 }
 
 glm::vec3 USceneComponent::get_world_rotation() {
     static const auto func = static_class()->find_function(L"K2_GetComponentRotation");
-    const auto fvector = sdk::ScriptVector::static_struct();
 
-    const auto is_ue5 = fvector->get_struct_size() == sizeof(glm::vec<3, double>);
+    if (func == nullptr) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
+    }
 
-    std::vector<uint8_t> params{};
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
-    // add a vec3
-    if (!is_ue5) {
-        params.insert(params.end(), sizeof(glm::vec3), 0);
-    } else {
-        params.insert(params.end(), sizeof(glm::vec<3, double>), 0);
-    }
+    const auto frotator = sdk::ScriptRotator::static_struct();
+    const auto is_ue5 = frotator->get_struct_size() == sizeof(glm::vec<3, double>);
 
-    this->process_event(func, params.data());
+    ParamFrame params{func};
 
-    if (!is_ue5) {
-        return *(glm::vec3*)params.data();
+    if (!params) {
+        return glm::vec3{0.0f, 0.0f, 0.0f};
     }
 
-    return *(glm::vec<3, double>*)params.data();
+    this->process_event(func, params.data());
+
+    return params.get_vector(ret_offset, is_ue5);
 }
 
 bool USceneComponent::attach_to(USceneComponent* parent, const std::wstring& socket_name, uint8_t attach_type, bool weld) {
@@ -309,29 +242,26 @@ bool USceneComponent::attach_to(USceneComponent* parent, const std::wstring& soc
     params.attach_type = attach_type;
     params.weld = weld;*/
 
-    // Dynamically create params
-    std::vector<uint8_t> params{};
-    static const auto struct_size = func->find_property(L"bWeldSimulatedBodies")->get_offset() + (sizeof(bool) * 2);
-    params.insert(params.end(), struct_size, 0);
-
-    static const auto parent_offset = func->find_property(L"InParent")->get_offset();
-    *(USceneComponent**)(params.data() + parent_offset) = parent;
+    static const auto parent_offset = ParamFrame::find_offset(func, L"InParent");
+    static const auto socket_name_offset = ParamFrame::find_offset(func, L"InSocketName");
+    static const auto attach_type_offset = ParamFrame::find_offset(func, L"AttachType");
+    static const auto weld_offset = ParamFrame::find_offset(func, L"bWeldSimulatedBodies");
+    static const auto ret_offset = ParamFrame::find_offset(func, L"ReturnValue");
 
-    static const auto socket_name_offset = func->find_property(L"InSocketName")->get_offset();
-    *(FName*)(params.data() + socket_name_offset) = FName{socket_name};
+    ParamFrame params{func};
 
-    static const auto attach_type_offset = func->find_property(L"AttachType")->get_offset();
-    *(uint8_t*)(params.data() + attach_type_offset) = attach_type;
-
-    static const auto weld_offset = func->find_property(L"bWeldSimulatedBodies")->get_offset();
-    *(bool*)(params.data() + weld_offset) = weld;
+    if (!params) {
+        return false;
+    }
 
-    // add a bool
-    params.insert(params.end(), sizeof(bool), 0);
+    params.set(parent_offset, parent);
+    params.set(socket_name_offset, FName{socket_name});
+    params.set(attach_type_offset, attach_type);
+    params.set(weld_offset, weld);
 
     this->process_event(func, params.data());
 
-    return (bool)params.back();
+    return params.get<bool>(ret_offset);
 }
 
 void USceneComponent::set_hidden_in_game(bool hidden, bool propagate) {
@@ -0,0 +1,323 @@
+#include <chrono>
+#include <bit>
+#include <thread>
+#include <unordered_map>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+#include "UObjectArray.hpp"
+#include "UObjectScan.hpp"
+#include "UClass.hpp"
+#include "UStructTree.hpp"
+
+namespace sdk {
+namespace detail {
+size_t hash_struct(const UStruct* s) {
+    auto x = (uint64_t)(uintptr_t)s;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCD;
+    x ^= x >> 33;
+
+    return (size_t)x;
+}
+}
+
+const UStructTree::Node* UStructTree::Snapshot::find(const UStruct* s) const {
+    const auto mask = table.size() - 1;
+
+    for (auto i = detail::hash_struct(s) & mask;; i = (i + 1) & mask) {
+        const auto& node = table[i];
+
+        if (node.key == s) {
+            return &node;
+        }
+
+        if (node.key == nullptr) {
+            return nullptr;
+        }
+    }
+}
+
+UStructTree::ReadGuard::ReadGuard()
+    : m_count{[]() -> std::atomic<int32_t>& {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % NUM_READER_SHARDS;
+
+        return s_readers[s_epoch.load() & 1][shard].count;
+    }()}
+{
+    // seq_cst on purpose, publish() relies on this being ordered before the load of s_current
+    m_count.fetch_add(1);
+}
+
+UStructTree::ReadGuard::~ReadGuard() {
+    m_count.fetch_sub(1, std::memory_order_release);
+}
+
+std::optional<bool> UStructTree::is_a(const UStruct* s, const UStruct* other) try {
+    ReadGuard _{};
+
+    const auto snapshot = s_current.load();
+
+    if (snapshot == nullptr || snapshot->layout != current_layout()) {
+        request_rebuild();
+        return std::nullopt;
+    }
+
+    // Not in the snapshot (or something else lives at that address now) and it's in GUObjectArray, so the snapshot is behind.
+    // Structs that were never in GUObjectArray just get walked, rebuilding wouldn't find them either
+    const auto lookup = [&](const UStruct* s) -> const Node* {
+        const auto node = snapshot->find(s);
+
+        if (node != nullptr && node->super == s->get_super_struct()) {
+            return node;
+        }
+
+        if (node != nullptr || is_registered(s)) {
+            request_rebuild();
+        }
+
+        return nullptr;
+    };
+
+    const auto a = lookup(s);
+
+    if (a == nullptr || a->pre == UINT32_MAX) {
+        return std::nullopt;
+    }
+
+    if (other == nullptr) {
+        return false;
+    }
+
+    const auto b = lookup(other);
+
+    if (b == nullptr || b->pre == UINT32_MAX) {
+        return std::nullopt;
+    }
+
+    return b->pre <= a->pre && a->pre <= b->last;
+} catch(...) {
+    return std::nullopt;
+}
+
+void UStructTree::rebuild() {
+    std::scoped_lock _{s_build_mutex};
+    publish(build());
+}
+
+size_t UStructTree::size() {
+    ReadGuard _{};
+
+    const auto snapshot = s_current.load();
+    return snapshot != nullptr ? snapshot->size : 0;
+}
+
+bool UStructTree::is_registered(const UStruct* s) try {
+    const auto objects = FUObjectArray::get();
+
+    if (objects == nullptr) {
+        return false;
+    }
+
+    const auto item = objects->get_object((int32_t)s->get_internal_index());
+    return item != nullptr && item->object == (const UObjectBase*)s;
+} catch(...) {
+    return false;
+}
+
+void UStructTree::request_rebuild() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(MIN_REBUILD_INTERVAL).count();
+
+    // Level streaming misses a lot in a short time, one rebuild covers all of it
+    if (now - s_last_rebuild.load(std::memory_order_relaxed) < interval) {
+        return;
+    }
+
+    if (s_rebuild_running.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    s_last_rebuild.store(now, std::memory_order_relaxed);
+
+    // Never on the caller's thread, that's usually the game thread or a scan worker and a build walks all of GUObjectArray
+    std::thread{[] {
+        try {
+            rebuild();
+        } catch(...) {
+            SPDLOG_ERROR("[UStructTree] Background rebuild failed");
+        }
+
+        s_rebuild_running.store(false, std::memory_order_release);
+    }}.detach();
+}
+
+// Only ever called with s_build_mutex held
+void UStructTree::publish(std::unique_ptr<Snapshot> snapshot) {
+    if (snapshot == nullptr) {
+        return;
+    }
+
+    std::unique_ptr<const Snapshot> old{s_current.exchange(snapshot.release())};
+
+    // Anything that counts itself in from here on sees the new one. What's still looking at the old one
+    // is counted under whichever epoch it read, which could be either if it got held up, so wait out both.
+    // Flipping before each wait keeps new readers off the side being waited on
+    for (auto i = 0; i < 2; ++i) {
+        const auto drained = s_epoch.fetch_add(1) & 1;
+
+        for (auto& shard : s_readers[drained]) {
+            while (shard.count.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // old gets freed here, nobody can be looking at it anymore
+}
+
+std::unique_ptr<UStructTree::Snapshot> UStructTree::build() try {
+    ZoneScopedN("sdk::UStructTree::build");
+
+    const auto objects = FUObjectArray::get();
+
+    if (objects == nullptr) {
+        return nullptr;
+    }
+
+    const auto now = std::chrono::high_resolution_clock::now();
+
+    auto snapshot = std::make_unique<Snapshot>();
+    snapshot->layout = current_layout();
+    snapshot->table.resize(16);
+
+    const auto ustruct_t = UStruct::static_class();
+
+    // Still published, the rebuild interval keeps this from being retried constantly
+    if (ustruct_t == nullptr) {
+        SPDLOG_ERROR("[UStructTree] Failed to find UStruct class");
+        return snapshot;
+    }
+
+    // Can't use is_a here, it would come right back to us
+    const auto structs = UObjectScan::find_all([ustruct_t](UObjectBase* object) {
+        const auto c = object->get_class();
+        return c != nullptr && c->is_a_uncached(ustruct_t);
+    }, objects);
+
+    const auto count = structs.size();
+
+    std::unordered_map<const UStruct*, uint32_t> indices{};
+    indices.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        indices[(const UStruct*)structs[i]] = i;
+    }
+
+    // Children lists as one flat array grouped by parent
+    std::vector<uint32_t> parents(count, UINT32_MAX);
+    std::vector<const UStruct*> supers(count, nullptr);
+    std::vector<uint32_t> child_counts(count + 1, 0);
+
+    for (uint32_t i = 0; i < count; ++i) try {
+        supers[i] = ((const UStruct*)structs[i])->get_super_struct();
+
+        if (const auto it = indices.find(supers[i]); it != indices.end() && it->second != i) {
+            parents[i] = it->second;
+            ++child_counts[it->second + 1];
+        }
+    } catch(...) {
+        continue;
+    }
+
+    for (size_t i = 1; i <= count; ++i) {
+        child_counts[i] += child_counts[i - 1];
+    }
+
+    std::vector<uint32_t> children(child_counts[count]);
+    auto fill = child_counts;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (parents[i] != UINT32_MAX) {
+            children[fill[parents[i]]++] = i;
+        }
+    }
+
+    // Iterative DFS from every root in array order
+    std::vector<uint32_t> pre(count, UINT32_MAX);
+    std::vector<uint32_t> last(count, 0);
+    std::vector<std::pair<uint32_t, uint32_t>> stack{}; // node, next child
+    uint32_t counter = 0;
+
+    const auto visit = [&](uint32_t root) {
+        pre[root] = counter++;
+        stack.emplace_back(root, child_counts[root]);
+
+        while (!stack.empty()) {
+            auto& [node, next] = stack.back();
+
+            if (next < child_counts[node + 1]) {
+                const auto child = children[next++];
+
+                // Cycles would mean we read garbage for a super pointer somewhere
+                if (pre[child] != UINT32_MAX) {
+                    continue;
+                }
+
+                pre[child] = counter++;
+                stack.emplace_back(child, child_counts[child]);
+                continue;
+            }
+
+            last[node] = counter - 1;
+            stack.pop_back();
+        }
+    };
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (parents[i] == UINT32_MAX) {
+            visit(i);
+        }
+    }
+
+    // Anything left over is stuck in a cycle, it still goes in (unnumbered) so is_a knows to walk for those instead of asking for a rebuild
+    const auto capacity = std::bit_ceil(std::max<size_t>(count * 2, 16));
+    snapshot->table.resize(capacity);
+
+    const auto mask = capacity - 1;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto key = (const UStruct*)structs[i];
+
+        for (auto slot = detail::hash_struct(key) & mask;; slot = (slot + 1) & mask) {
+            if (snapshot->table[slot].key == nullptr) {
+                snapshot->table[slot] = Node{ key, supers[i], pre[i], last[i] };
+                break;
+            }
+        }
+
+        if (pre[i] != UINT32_MAX) {
+            ++snapshot->size;
+        }
+    }
+
+    const auto time_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - now).count();
+    SPDLOG_INFO("[UStructTree] Numbered {} structs in {} ms", snapshot->size, time_elapsed);
+
+    return snapshot;
+} catch(...) {
+    SPDLOG_ERROR("[UStructTree] Failed to build snapshot");
+    return nullptr;
+}
+
+UStructTree::Layout UStructTree::current_layout() {
+    return Layout{
+        UObjectBase::get_class_private_offset(),
+        UStruct::get_super_struct_offset(),
+        (int32_t)FUObjectArray::get_item_distance()
+    };
+}
+}
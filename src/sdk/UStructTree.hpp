@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <optional>
+
+namespace sdk {
+class UStruct;
+
+// Snapshot of every UStruct in GUObjectArray numbered in DFS order over the SuperStruct tree,
+// so "is A a B" is B.pre <= A.pre <= B.last instead of walking A's super chain.
+// Readers never lock and never build, the snapshot is immutable once published and gets replaced wholesale
+// on a background thread when is_a runs into a struct that's in GUObjectArray but not in the snapshot
+// (or one whose address got reused), at most once every MIN_REBUILD_INTERVAL.
+// Replaced snapshots are freed as soon as every is_a that could still be looking at them has finished.
+class UStructTree {
+public:
+    constexpr static inline auto MIN_REBUILD_INTERVAL = std::chrono::seconds{1};
+
+    // std::nullopt means the snapshot can't answer (not built, struct not in it, or it looks stale)
+    // and the caller should walk the chain instead
+    static std::optional<bool> is_a(const UStruct* s, const UStruct* other);
+
+    // Builds a new snapshot right away on the calling thread, blocks if one is already being built
+    static void rebuild();
+
+    // Number of structs in the current snapshot
+    static size_t size();
+
+private:
+    struct Node {
+        const UStruct* key{nullptr};
+        const UStruct* super{nullptr}; // to catch structs that got freed and replaced at the same address
+        uint32_t pre{0}; // UINT32_MAX if it couldn't be numbered (bad super chain)
+        uint32_t last{0}; // highest pre number in this subtree
+    };
+
+    struct Layout {
+        uint32_t class_offset{0};
+        uint32_t super_struct_offset{0};
+        int32_t item_distance{0};
+
+        bool operator==(const Layout& other) const = default;
+    };
+
+    struct Snapshot {
+        Layout layout{};
+        size_t size{0};
+        std::vector<Node> table{}; // open addressing, power of two
+
+        const Node* find(const UStruct* s) const;
+    };
+
+    // Counts the is_a calls in flight, split by epoch so a publish can wait out just the ones that started before it.
+    // Sharded by thread so parallel scans don't all hammer the same cache line
+    constexpr static inline size_t NUM_READER_SHARDS = 16;
+
+    struct alignas(64) ReaderShard {
+        std::atomic<int32_t> count{0};
+    };
+
+    class ReadGuard {
+    public:
+        ReadGuard();
+        ~ReadGuard();
+
+    private:
+        std::atomic<int32_t>& m_count;
+    };
+
+    static Layout current_layout();
+    static std::unique_ptr<Snapshot> build();
+
+    // Whether s is really in GUObjectArray, so missing from the snapshot means the snapshot is behind
+    static bool is_registered(const UStruct* s);
+
+    // Doesn't wait, kicks off a background build unless one is running or the last one was too recent
+    static void request_rebuild();
+    static void publish(std::unique_ptr<Snapshot> snapshot);
+
+    static inline std::atomic<const Snapshot*> s_current{nullptr};
+
+    static inline std::atomic<uint32_t> s_epoch{0};
+    static inline std::array<std::array<ReaderShard, NUM_READER_SHARDS>, 2> s_readers{};
+
+    static inline std::mutex s_build_mutex{};
+    static inline std::atomic<bool> s_rebuild_running{false};
+    static inline std::atomic<int64_t> s_last_rebuild{0}; // steady_clock ticks, when the last background build started
+};
+}
@@ -8,6 +8,8 @@
 
 #include <bdshemu.h>
 
+#include "ModuleRegistry.hpp"
+#include "Memory.hpp"
 #include "Utility.hpp"
 
 namespace sdk {
@@ -42,7 +44,7 @@ bool is_vfunc_pattern(uintptr_t addr, std::string_view pattern) {
 
         SPDLOG_INFO("Emulating at {:x}", ctx.ctx->Registers.RegRip);
 
-        if (prev_was_branch && !IsBadReadPtr((void*)ctx.ctx->Registers.RegRip, 4)) {
+        if (prev_was_branch && memory::is_readable((void*)ctx.ctx->Registers.RegRip, 4)) {
             if (utility::scan(ctx.ctx->Registers.RegRip, 100, pattern.data()).value_or(0) == ctx.ctx->Registers.RegRip) {
                 SPDLOG_INFO("Encountered true vfunc at {:x}", ctx.ctx->Registers.RegRip);
                 return true;
@@ -142,19 +144,27 @@ std::optional<std::wstring> search_for_version(const std::wstring& input) {
 }
 
 std::optional<std::wstring> search_for_version(HMODULE h) {
-    const auto module_size = utility::get_module_size(h).value_or(0);
-    const auto module_start = (const wchar_t*)h;
+    const auto info = ModuleRegistry::get(h);
 
-    for (size_t i = 0; i < module_size / 2; ++i) try {
-        const wchar_t* ptr = module_start + i;
+    if (info == nullptr) {
+        return std::nullopt;
+    }
+
+    // It's a string literal, no point walking the code
+    for (const auto& section : info->get_initialized_data()) {
+        const auto section_start = (const wchar_t*)section.start;
+
+        for (size_t i = 0; i < section.size / 2; ++i) try {
+            const wchar_t* ptr = section_start + i;
 
-        if (ptr[0] == L'+' && ptr[1] == L'+') {
-            if (auto version = search_for_version(ptr)) {
-                return version;
+            if (ptr[0] == L'+' && ptr[1] == L'+') {
+                if (auto version = search_for_version(ptr)) {
+                    return version;
+                }
             }
-        }
-    } catch(...) {
+        } catch(...) {
 
+        }
     }
 
     return std::nullopt;
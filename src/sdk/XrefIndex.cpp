@@ -0,0 +1,258 @@
+#include <chrono>
+#include <memory>
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <bddisasm.h>
+
+#include <utility/Scan.hpp>
+
+#include <tracy/Tracy.hpp>
+
+#include "ModuleRegistry.hpp"
+#include "UObjectScan.hpp"
+#include "XrefIndex.hpp"
+
+namespace sdk {
+XrefIndex& XrefIndex::get(HMODULE module) {
+    // Leaked on purpose, lookups can still be going on other threads at exit
+    static auto mutex = new std::mutex{};
+    static auto instances = new std::unordered_map<HMODULE, std::unique_ptr<XrefIndex>>{};
+
+    std::scoped_lock _{*mutex};
+
+    auto& instance = (*instances)[module];
+
+    if (instance == nullptr) {
+        instance.reset(new XrefIndex{module});
+    }
+
+    return *instance;
+}
+
+std::vector<uintptr_t> XrefIndex::find_all(uintptr_t target) {
+    if (m_module == nullptr) {
+        return {};
+    }
+
+    build();
+
+    std::vector<uintptr_t> result{};
+
+    const auto base = (uintptr_t)m_module;
+
+    if (target >= base && target - base <= UINT32_MAX) {
+        const auto rva = (uint32_t)(target - base);
+
+        for (auto it = std::lower_bound(m_entries.begin(), m_entries.end(), Entry{rva, 0}); it != m_entries.end() && it->target == rva; ++it) {
+            result.push_back(base + it->ref);
+        }
+    }
+
+    // Leaf functions can reference the same thing as indexed ones, so this always gets merged in.
+    // Only covers what .pdata doesn't, which is a small slice of the code
+    const auto& uncovered = find_uncovered(target);
+
+    if (!uncovered.empty()) {
+        result.insert(result.end(), uncovered.begin(), uncovered.end());
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+    }
+
+    return result;
+}
+
+const std::vector<uintptr_t>& XrefIndex::find_uncovered(uintptr_t target) {
+    std::scoped_lock _{m_fallback_mutex};
+
+    if (const auto it = m_fallback.find(target); it != m_fallback.end()) {
+        return it->second;
+    }
+
+    auto& result = m_fallback[target];
+
+    try {
+        ZoneScopedN("sdk::XrefIndex::find_uncovered");
+
+        if (m_uncovered.has_value()) {
+            for (const auto& [start, end] : *m_uncovered) {
+                for (auto ref = utility::scan_displacement_reference(start, end - start, target);
+                    ref.has_value();
+                    ref = utility::scan_displacement_reference(*ref + 1, end - (*ref + 1), target))
+                {
+                    result.push_back(*ref);
+                }
+            }
+        } else {
+            // Don't know where the code is, the whole module it is
+            result = utility::scan_displacement_references(m_module, target);
+        }
+    } catch(...) {
+        SPDLOG_ERROR("[XrefIndex::find_uncovered] Exception occurred in fallback scan for {:x}", target);
+    }
+
+    return result;
+}
+
+std::optional<uintptr_t> XrefIndex::find(uintptr_t target) {
+    const auto result = find_all(target);
+
+    if (result.empty()) {
+        return std::nullopt;
+    }
+
+    return result.front();
+}
+
+void XrefIndex::build() {
+    std::call_once(m_build_once, [this] { build_internal(); });
+}
+
+void XrefIndex::build_internal() try {
+    ZoneScopedN("sdk::XrefIndex::build_internal");
+
+    if (m_module == nullptr) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+
+    const auto info = ModuleRegistry::get(m_module);
+
+    if (info != nullptr && !info->code.empty()) {
+        m_uncovered = find_uncovered_ranges(*info);
+    }
+
+    if (info == nullptr || info->functions.empty()) {
+        SPDLOG_ERROR("[XrefIndex::build_internal] {:x} has no .pdata, every lookup will be a full scan", (uintptr_t)m_module);
+        return;
+    }
+
+    const auto base = info->base;
+    const auto image_size = info->size;
+    const auto functions = info->functions;
+    const auto num_functions = functions.size();
+
+    const auto num_batches = (num_functions + FUNCTIONS_PER_BATCH - 1) / FUNCTIONS_PER_BATCH;
+
+    std::vector<std::vector<Entry>> results(num_batches);
+
+    UObjectScan::run_tasks(num_batches, [&](size_t batch) {
+        const auto first = batch * FUNCTIONS_PER_BATCH;
+        const auto last = std::min(num_functions, first + FUNCTIONS_PER_BATCH);
+
+        for (auto i = first; i < last; ++i) try {
+            const auto& fn = functions[i];
+
+            if (fn.BeginAddress >= fn.EndAddress || fn.EndAddress > image_size) {
+                continue;
+            }
+
+            decode_range(base, image_size, base + fn.BeginAddress, base + fn.EndAddress, results[batch]);
+        } catch(...) {
+            // Bad entry, the fallback scan still covers whatever was in it
+        }
+    });
+
+    size_t total = 0;
+
+    for (const auto& result : results) {
+        total += result.size();
+    }
+
+    m_entries.reserve(total);
+
+    for (auto& result : results) {
+        m_entries.insert(m_entries.end(), result.begin(), result.end());
+        result = {};
+    }
+
+    std::sort(m_entries.begin(), m_entries.end());
+    m_entries.erase(std::unique(m_entries.begin(), m_entries.end()), m_entries.end());
+    m_entries.shrink_to_fit();
+
+    SPDLOG_INFO("[XrefIndex::build_internal] Indexed {} references in {:x} ({} functions, {} batches) in {}ms",
+        m_entries.size(), base, num_functions, num_batches,
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - now).count());
+} catch(...) {
+    SPDLOG_ERROR("[XrefIndex::build_internal] Exception occurred while indexing {:x}", (uintptr_t)m_module);
+    m_entries.clear();
+}
+
+std::vector<std::pair<uintptr_t, uintptr_t>> XrefIndex::find_uncovered_ranges(const ModuleInfo& info) {
+    std::vector<std::pair<uintptr_t, uintptr_t>> covered{};
+    covered.reserve(info.functions.size());
+
+    for (const auto& fn : info.functions) {
+        if (fn.BeginAddress < fn.EndAddress && fn.EndAddress <= info.size) {
+            covered.emplace_back(info.base + fn.BeginAddress, info.base + fn.EndAddress);
+        }
+    }
+
+    // .pdata is supposed to be sorted already, but nothing checks that
+    std::sort(covered.begin(), covered.end());
+
+    std::vector<std::pair<uintptr_t, uintptr_t>> result{};
+
+    for (const auto& section : info.code) {
+        auto cursor = section.start;
+        auto it = std::lower_bound(covered.begin(), covered.end(), std::pair<uintptr_t, uintptr_t>{section.start, 0});
+
+        // One that starts before the section could still run into it
+        if (it != covered.begin()) {
+            cursor = std::max(cursor, std::prev(it)->second);
+        }
+
+        for (; it != covered.end() && it->first < section.end(); ++it) {
+            if (it->first > cursor) {
+                result.emplace_back(cursor, it->first);
+            }
+
+            cursor = std::max(cursor, it->second);
+        }
+
+        if (cursor < section.end()) {
+            result.emplace_back(cursor, section.end());
+        }
+    }
+
+    return result;
+}
+
+void XrefIndex::decode_range(uintptr_t base, size_t image_size, uintptr_t start, uintptr_t end, std::vector<Entry>& out) {
+    const auto add = [&](uintptr_t target, uintptr_t ref) {
+        if (target < base || target - base >= image_size) {
+            return;
+        }
+
+        out.push_back(Entry{ (uint32_t)(target - base), (uint32_t)(ref - base) });
+    };
+
+    for (auto ip = start; ip < end;) {
+        INSTRUX ix{};
+        const auto status = NdDecodeEx(&ix, (ND_UINT8*)ip, end - ip, ND_CODE_64, ND_DATA_64);
+
+        // Padding or data in the middle of the function, resync on the next byte
+        if (!ND_SUCCESS(status)) {
+            ++ip;
+            continue;
+        }
+
+        const auto next = ip + ix.Length;
+
+        // Only where the 4 bytes end the instruction, which is what scan_displacement_reference can see.
+        // With an immediate after them (mov [rip+x], imm) the target is relative to the end of the immediate instead
+        for (uint8_t i = 0; i < ix.OperandsCount; ++i) {
+            const auto& operand = ix.Operands[i];
+
+            if (operand.Type == ND_OP_MEM && operand.Info.Memory.IsRipRel && ix.DispLength == 4 && ix.DispOffset + 4 == ix.Length) {
+                add(next + (int64_t)(int32_t)operand.Info.Memory.Disp, ip + ix.DispOffset);
+            } else if (operand.Type == ND_OP_OFFS && ix.RelOffsLength == 4 && ix.RelOffsOffset + 4 == ix.Length) {
+                add(next + (int64_t)operand.Info.RelativeOffset.Rel, ip + ix.RelOffsOffset);
+            }
+        }
+
+        ip = next;
+    }
+}
+}
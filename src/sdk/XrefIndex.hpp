@@ -0,0 +1,78 @@
+#pragma once
+
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <unordered_map>
+
+#include <windows.h>
+
+namespace sdk {
+struct ModuleInfo;
+
+// Every RIP-relative operand and rel32 branch in a module's code, sorted by what it points at,
+// so finding the code that references a string or global is a binary search instead of a walk over the whole module.
+// Only the ones whose 4 bytes end the instruction, same as what utility::scan_displacement_reference matches.
+// Built once per module on first use by decoding every function listed in .pdata, in batches on the UObjectScan pool.
+// Code without unwind info (leaf functions, some obfuscators) isn't in there, so every new target also gets a plain
+// displacement scan over just the code outside of .pdata, merged into the result and remembered for next time.
+class XrefIndex {
+public:
+    // Always hands back something, a nullptr module just never finds anything
+    static XrefIndex& get(HMODULE module);
+
+    // Addresses of the 4 byte displacements (or rel32s) pointing at target, lowest first, from indexed and leaf code alike.
+    // Same kind of address utility::scan_displacement_reference(s) returns, so resolve_instruction etc. work on them.
+    // The scan can also hit bytes that only look like a reference (data in code sections, the middle of another instruction),
+    // inside .pdata functions those never show up here, so find() can be a later address than the scan's first byte match
+    std::vector<uintptr_t> find_all(uintptr_t target);
+    std::optional<uintptr_t> find(uintptr_t target);
+
+    // Decodes the module if that didn't happen yet, find() calls this on its own
+    void build();
+
+    size_t size() {
+        build();
+        return m_entries.size();
+    }
+
+private:
+    struct Entry {
+        uint32_t target{}; // rva
+        uint32_t ref{}; // rva of the displacement
+
+        bool operator<(const Entry& other) const {
+            return target < other.target || (target == other.target && ref < other.ref);
+        }
+
+        bool operator==(const Entry& other) const = default;
+    };
+
+    XrefIndex(HMODULE module)
+        : m_module{module}
+    {
+    }
+
+    void build_internal();
+
+    // Scans what .pdata doesn't cover, result is cached per target
+    const std::vector<uintptr_t>& find_uncovered(uintptr_t target);
+
+    // Code section ranges that aren't inside any .pdata function, in address order
+    static std::vector<std::pair<uintptr_t, uintptr_t>> find_uncovered_ranges(const ModuleInfo& info);
+    static void decode_range(uintptr_t base, size_t image_size, uintptr_t start, uintptr_t end, std::vector<Entry>& out);
+
+    HMODULE m_module{};
+
+    std::once_flag m_build_once{};
+    std::vector<Entry> m_entries{}; // immutable after build
+    std::optional<std::vector<std::pair<uintptr_t, uintptr_t>>> m_uncovered{}; // same, std::nullopt if the code sections aren't known
+
+    std::mutex m_fallback_mutex{};
+    std::unordered_map<uintptr_t, std::vector<uintptr_t>> m_fallback{};
+
+    constexpr static inline size_t FUNCTIONS_PER_BATCH = 4096;
+};
+}
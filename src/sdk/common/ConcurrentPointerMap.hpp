@@ -0,0 +1,162 @@
+#pragma once
+
+#include <bit>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+namespace sdk {
+namespace common {
+// Pointer -> pointer hash map that readers can use without taking any locks.
+// Writers serialize on a mutex. Keys are never removed, values can be swapped out.
+// When a table gets half full a new one twice the size gets built and published,
+// the old ones are kept alive so readers still probing them don't read freed memory.
+template<typename K, typename V>
+class ConcurrentPointerMap {
+    static_assert(std::is_pointer_v<K> && std::is_pointer_v<V>, "ConcurrentPointerMap only holds pointers");
+
+public:
+    ConcurrentPointerMap(size_t initial_capacity = 256) {
+        auto table = std::make_unique<Table>(std::bit_ceil(std::max<size_t>(initial_capacity, 16)));
+        m_current.store(table.get(), std::memory_order_release);
+        m_tables.push_back(std::move(table));
+    }
+
+    ConcurrentPointerMap(const ConcurrentPointerMap&) = delete;
+    ConcurrentPointerMap& operator=(const ConcurrentPointerMap&) = delete;
+
+    V find(K key) const {
+        const auto table = m_current.load(std::memory_order_acquire);
+        const auto mask = table->capacity - 1;
+
+        for (auto i = hash(key) & mask;; i = (i + 1) & mask) {
+            const auto k = table->keys[i].load(std::memory_order_acquire);
+
+            if (k == key) {
+                return table->values[i].load(std::memory_order_acquire);
+            }
+
+            if (k == nullptr) {
+                return nullptr;
+            }
+        }
+    }
+
+    // Returns whatever ends up in the map, which is the existing value if there already was one
+    V insert(K key, V value) {
+        std::scoped_lock _{m_mutex};
+
+        const auto i = find_or_add_slot(key);
+        auto table = m_current.load(std::memory_order_relaxed);
+
+        if (const auto existing = table->values[i].load(std::memory_order_relaxed); existing != nullptr) {
+            return existing;
+        }
+
+        table->values[i].store(value, std::memory_order_release);
+        return value;
+    }
+
+    // Returns the previous value, the caller decides when it's safe to free it
+    V assign(K key, V value) {
+        std::scoped_lock _{m_mutex};
+
+        const auto i = find_or_add_slot(key);
+        auto table = m_current.load(std::memory_order_relaxed);
+
+        return table->values[i].exchange(value, std::memory_order_acq_rel);
+    }
+
+    size_t size() const {
+        std::scoped_lock _{m_mutex};
+        return m_size;
+    }
+
+private:
+    struct Table {
+        Table(size_t capacity)
+            : capacity{capacity},
+            keys{std::make_unique<std::atomic<K>[]>(capacity)},
+            values{std::make_unique<std::atomic<V>[]>(capacity)}
+        {
+        }
+
+        size_t capacity{};
+        std::unique_ptr<std::atomic<K>[]> keys{};
+        std::unique_ptr<std::atomic<V>[]> values{};
+    };
+
+    static size_t hash(K key) {
+        auto x = (uint64_t)(uintptr_t)key;
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCD;
+        x ^= x >> 33;
+
+        return (size_t)x;
+    }
+
+    // Called with the mutex held
+    size_t find_or_add_slot(K key) {
+        auto table = m_current.load(std::memory_order_relaxed);
+
+        if ((m_size + 1) * 2 > table->capacity) {
+            table = grow();
+        }
+
+        const auto mask = table->capacity - 1;
+
+        for (auto i = hash(key) & mask;; i = (i + 1) & mask) {
+            const auto k = table->keys[i].load(std::memory_order_relaxed);
+
+            if (k == key) {
+                return i;
+            }
+
+            if (k == nullptr) {
+                // Value gets stored by the caller, readers treat a null value as missing until then
+                table->keys[i].store(key, std::memory_order_release);
+                ++m_size;
+                return i;
+            }
+        }
+    }
+
+    Table* grow() {
+        const auto old_table = m_current.load(std::memory_order_relaxed);
+        auto table = std::make_unique<Table>(old_table->capacity * 2);
+        const auto mask = table->capacity - 1;
+
+        for (size_t j = 0; j < old_table->capacity; ++j) {
+            const auto k = old_table->keys[j].load(std::memory_order_relaxed);
+
+            if (k == nullptr) {
+                continue;
+            }
+
+            for (auto i = hash(k) & mask;; i = (i + 1) & mask) {
+                if (table->keys[i].load(std::memory_order_relaxed) == nullptr) {
+                    table->values[i].store(old_table->values[j].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    table->keys[i].store(k, std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+
+        const auto result = table.get();
+        m_current.store(result, std::memory_order_release);
+        m_tables.push_back(std::move(table));
+
+        return result;
+    }
+
+    mutable std::mutex m_mutex{};
+    std::atomic<Table*> m_current{nullptr};
+    std::vector<std::unique_ptr<Table>> m_tables{};
+    size_t m_size{0};
+};
+}
+}
\ No newline at end of file
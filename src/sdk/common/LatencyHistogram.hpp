@@ -0,0 +1,133 @@
+#pragma once
+
+#include <bit>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+namespace sdk {
+namespace common {
+// Log-linear buckets like HdrHistogram: every power of two is split into 8 buckets,
+// so anything read back is within 12.5% of what was recorded, from nanoseconds up to years, in 4KB.
+// Recording is a couple of relaxed atomic adds, fine to do from any thread (or plain stores if only one thread records).
+class LatencyHistogram {
+public:
+    constexpr static inline size_t SUB_BUCKET_BITS = 3;
+    constexpr static inline size_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    constexpr static inline size_t NUM_BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    struct Snapshot {
+        std::array<uint64_t, NUM_BUCKETS> counts{};
+        uint64_t count{0};
+        uint64_t total{0};
+        uint64_t max{0};
+
+        // p is 0-100. Upper end of the bucket it lands in, never more than max
+        uint64_t percentile(double p) const {
+            if (count == 0) {
+                return 0;
+            }
+
+            const auto target = std::max<uint64_t>(1, (uint64_t)((std::clamp(p, 0.0, 100.0) / 100.0) * (double)count + 0.5));
+            uint64_t seen = 0;
+
+            for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+                seen += counts[i];
+
+                if (seen >= target) {
+                    return std::min(get_bucket_upper(i), max);
+                }
+            }
+
+            return max;
+        }
+
+        uint64_t mean() const {
+            return count != 0 ? total / count : 0;
+        }
+    };
+
+    void record(uint64_t value) {
+        m_counts[get_bucket(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_total.fetch_add(value, std::memory_order_relaxed);
+
+        for (auto current = m_max.load(std::memory_order_relaxed); value > current;) {
+            if (m_max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    }
+
+    // Same thing without the locked instructions, only for histograms that one thread ever records into
+    void record_single_writer(uint64_t value) {
+        const auto bump = [](std::atomic<uint64_t>& counter, uint64_t amount) {
+            counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        };
+
+        bump(m_counts[get_bucket(value)], 1);
+        bump(m_count, 1);
+        bump(m_total, value);
+
+        if (value > m_max.load(std::memory_order_relaxed)) {
+            m_max.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // Not a consistent cut if something is recording at the same time, but close enough for stats
+    Snapshot snapshot() const {
+        Snapshot result{};
+
+        for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+            result.counts[i] = m_counts[i].load(std::memory_order_relaxed);
+        }
+
+        result.count = m_count.load(std::memory_order_relaxed);
+        result.total = m_total.load(std::memory_order_relaxed);
+        result.max = m_max.load(std::memory_order_relaxed);
+
+        return result;
+    }
+
+    void reset() {
+        for (auto& count : m_counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+
+        m_count.store(0, std::memory_order_relaxed);
+        m_total.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+    static size_t get_bucket(uint64_t value) {
+        if (value < SUB_BUCKETS) {
+            return (size_t)value;
+        }
+
+        const auto exponent = (size_t)std::bit_width(value) - 1; // >= SUB_BUCKET_BITS
+        const auto sub_bucket = (size_t)(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+
+        return (exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub_bucket;
+    }
+
+    static uint64_t get_bucket_upper(size_t bucket) {
+        if (bucket < SUB_BUCKETS) {
+            return bucket;
+        }
+
+        const auto exponent = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+        const auto sub_bucket = bucket % SUB_BUCKETS;
+        const auto width = 1ull << (exponent - SUB_BUCKET_BITS);
+
+        return ((SUB_BUCKETS + sub_bucket) * width) + (width - 1);
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> m_counts{};
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_total{0};
+    std::atomic<uint64_t> m_max{0};
+};
+}
+}
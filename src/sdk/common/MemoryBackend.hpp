@@ -0,0 +1,451 @@
+#pragma once
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <unordered_map>
+
+namespace sdk {
+namespace common {
+struct MemoryRange {
+    uintptr_t address{};
+    size_t size{};
+};
+
+// Somewhere to read the target's memory from, so the same walk can run injected,
+// against another process, or against a dump sitting on disk.
+// Nothing Windows in here, so an image built in a buffer works just as well.
+class MemoryBackend {
+public:
+    virtual ~MemoryBackend() = default;
+
+    // All or nothing, false if any byte of it isn't there
+    virtual bool read(uintptr_t address, void* out, size_t size) = 0;
+
+    // Hint that these are about to be read. Backends where a read costs something
+    // fetch all of it in as few reads as they can, the rest ignore it
+    virtual void prefetch(std::span<const MemoryRange>) {}
+
+    template<typename T>
+    std::optional<T> read(uintptr_t address) {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        T result{};
+
+        if (!read(address, &result, sizeof(T))) {
+            return std::nullopt;
+        }
+
+        return result;
+    }
+};
+
+// Plain memcpy, validate gets asked first if there is one
+class InProcessBackend : public MemoryBackend {
+public:
+    using MemoryBackend::read;
+
+    InProcessBackend(std::function<bool(uintptr_t, size_t)> validate = {})
+        : m_validate{std::move(validate)}
+    {
+    }
+
+    bool read(uintptr_t address, void* out, size_t size) override {
+        if (address == 0 || (m_validate && !m_validate(address, size))) {
+            return false;
+        }
+
+        memcpy(out, (const void*)address, size);
+        return true;
+    }
+
+private:
+    std::function<bool(uintptr_t, size_t)> m_validate{};
+};
+
+// Memory captured somewhere else and laid out in one buffer, like a minidump.
+// The buffer is usually a mapped file, so reading a segment is just a page fault on the file
+class ImageBackend : public MemoryBackend {
+public:
+    using MemoryBackend::read;
+
+    struct Segment {
+        uintptr_t address{};
+        size_t size{};
+        size_t file_offset{};
+
+        bool operator<(const Segment& other) const {
+            return address < other.address;
+        }
+    };
+
+    ImageBackend(std::span<const uint8_t> data, std::vector<Segment> segments)
+        : m_data{data},
+        m_segments{std::move(segments)}
+    {
+        std::erase_if(m_segments, [&](const Segment& segment) {
+            return segment.size == 0 || segment.file_offset > m_data.size() || segment.size > m_data.size() - segment.file_offset;
+        });
+
+        std::sort(m_segments.begin(), m_segments.end());
+    }
+
+    // Memory64ListStream from full dumps, MemoryListStream from the smaller ones
+    static std::optional<ImageBackend> from_minidump(std::span<const uint8_t> data) {
+        constexpr uint32_t MINIDUMP_SIGNATURE = 0x504D444D; // "MDMP"
+        constexpr uint32_t MEMORY_LIST_STREAM = 5;
+        constexpr uint32_t MEMORY64_LIST_STREAM = 9;
+
+        const auto read_at = [&]<typename T>(size_t offset, T& out) {
+            if (offset > data.size() || sizeof(T) > data.size() - offset) {
+                return false;
+            }
+
+            memcpy(&out, data.data() + offset, sizeof(T));
+            return true;
+        };
+
+        uint32_t signature{}, num_streams{}, stream_directory{};
+
+        if (!read_at(0, signature) || signature != MINIDUMP_SIGNATURE) {
+            return std::nullopt;
+        }
+
+        if (!read_at(8, num_streams) || !read_at(12, stream_directory)) {
+            return std::nullopt;
+        }
+
+        std::vector<Segment> segments{};
+
+        for (uint32_t i = 0; i < num_streams; ++i) {
+            const auto entry = (size_t)stream_directory + i * 12;
+            uint32_t type{}, rva{};
+
+            if (!read_at(entry, type) || !read_at(entry + 8, rva)) {
+                return std::nullopt;
+            }
+
+            if (type == MEMORY64_LIST_STREAM) {
+                uint64_t count{}, base_rva{};
+
+                if (!read_at(rva, count) || !read_at(rva + 8, base_rva)) {
+                    return std::nullopt;
+                }
+
+                // Everything is back to back starting at base_rva
+                auto file_offset = base_rva;
+
+                for (uint64_t j = 0; j < count; ++j) {
+                    uint64_t start{}, size{};
+
+                    if (!read_at(rva + 16 + j * 16, start) || !read_at(rva + 16 + j * 16 + 8, size)) {
+                        return std::nullopt;
+                    }
+
+                    segments.push_back(Segment{(uintptr_t)start, (size_t)size, (size_t)file_offset});
+                    file_offset += size;
+                }
+            } else if (type == MEMORY_LIST_STREAM) {
+                uint32_t count{};
+
+                if (!read_at(rva, count)) {
+                    return std::nullopt;
+                }
+
+                for (uint32_t j = 0; j < count; ++j) {
+                    const auto descriptor = (size_t)rva + 4 + j * 16;
+                    uint64_t start{};
+                    uint32_t size{}, data_rva{};
+
+                    if (!read_at(descriptor, start) || !read_at(descriptor + 8, size) || !read_at(descriptor + 12, data_rva)) {
+                        return std::nullopt;
+                    }
+
+                    segments.push_back(Segment{(uintptr_t)start, size, data_rva});
+                }
+            }
+        }
+
+        if (segments.empty()) {
+            return std::nullopt;
+        }
+
+        return ImageBackend{data, std::move(segments)};
+    }
+
+    bool read(uintptr_t address, void* out, size_t size) override {
+        auto dst = (uint8_t*)out;
+
+        // Can straddle segments as long as they're contiguous
+        while (size > 0) {
+            const auto segment = find(address);
+
+            if (segment == nullptr) {
+                return false;
+            }
+
+            const auto offset = address - segment->address;
+            const auto count = std::min(size, segment->size - offset);
+
+            memcpy(dst, m_data.data() + segment->file_offset + offset, count);
+
+            dst += count;
+            address += count;
+            size -= count;
+        }
+
+        return true;
+    }
+
+    const std::vector<Segment>& get_segments() const {
+        return m_segments;
+    }
+
+private:
+    const Segment* find(uintptr_t address) const {
+        auto it = std::upper_bound(m_segments.begin(), m_segments.end(), address, [](uintptr_t value, const Segment& segment) {
+            return value < segment.address;
+        });
+
+        if (it == m_segments.begin()) {
+            return nullptr;
+        }
+
+        --it;
+        return address - it->address < it->size ? &*it : nullptr;
+    }
+
+    std::span<const uint8_t> m_data{};
+    std::vector<Segment> m_segments{}; // sorted
+};
+
+// Reads from somewhere slow (another process, a socket) a page at a time and keeps the pages around.
+// prefetch() merges everything it's given into runs of contiguous missing pages and reads each run once,
+// and a miss in read() pulls in a few pages after it too, since walks mostly go forward.
+// A read bigger than the whole cache goes straight to the source.
+class CachedBackend : public MemoryBackend {
+public:
+    using MemoryBackend::read;
+
+    constexpr static inline size_t CACHE_PAGE_SIZE = 0x1000;
+
+    // The slow read, same all or nothing contract as MemoryBackend::read
+    using SourceFn = std::function<bool(uintptr_t address, void* out, size_t size)>;
+
+    CachedBackend(SourceFn source, size_t max_pages = 16 * 1024, size_t readahead_pages = 8)
+        : m_source{std::move(source)},
+        m_max_pages{std::max<size_t>(max_pages, 1)},
+        m_readahead_pages{readahead_pages}
+    {
+    }
+
+    bool read(uintptr_t address, void* out, size_t size) override {
+        if (size == 0) {
+            return true;
+        }
+
+        if (address + size < address) {
+            return false;
+        }
+
+        std::scoped_lock _{m_mutex};
+
+        const auto first_page = address / CACHE_PAGE_SIZE;
+        const auto last_page = (address + size - 1) / CACHE_PAGE_SIZE;
+        const auto num_pages = last_page - first_page + 1;
+
+        // Wouldn't fit even with nothing else cached, so don't bother caching it
+        if (num_pages > m_max_pages) {
+            ++m_stats.source_reads;
+
+            if (!m_source(address, out, size)) {
+                return false;
+            }
+
+            ++m_stats.reads;
+            return true;
+        }
+
+        // Pull in whatever's missing (plus readahead) before copying anything out.
+        // The readahead can't push out the pages this read needs, so it only gets whatever room is left
+        if (!all_cached_locked(first_page, last_page)) {
+            const auto readahead = std::min(m_readahead_pages, m_max_pages - num_pages);
+
+            m_pinned_first = first_page;
+            m_pinned_last = last_page;
+            fetch_locked(first_page, last_page + readahead);
+            m_pinned_first = 1;
+            m_pinned_last = 0;
+        }
+
+        auto dst = (uint8_t*)out;
+
+        for (auto page = first_page; page <= last_page; ++page) {
+            const auto it = m_pages.find(page);
+
+            if (it == m_pages.end() || it->second == nullptr) {
+                return false;
+            }
+
+            const auto page_start = page * CACHE_PAGE_SIZE;
+            const auto from = std::max(address, page_start);
+            const auto to = std::min(address + size, page_start + CACHE_PAGE_SIZE);
+
+            memcpy(dst, it->second->data() + (from - page_start), to - from);
+            dst += to - from;
+        }
+
+        ++m_stats.reads;
+        return true;
+    }
+
+    void prefetch(std::span<const MemoryRange> ranges) override {
+        std::vector<std::pair<uintptr_t, uintptr_t>> page_ranges{};
+        page_ranges.reserve(ranges.size());
+
+        for (const auto& range : ranges) {
+            if (range.size == 0 || range.address + range.size < range.address) {
+                continue;
+            }
+
+            page_ranges.emplace_back(range.address / CACHE_PAGE_SIZE, (range.address + range.size - 1) / CACHE_PAGE_SIZE);
+        }
+
+        std::sort(page_ranges.begin(), page_ranges.end());
+
+        std::scoped_lock _{m_mutex};
+
+        // Overlapping or touching ranges turn into one read
+        for (size_t i = 0; i < page_ranges.size();) {
+            auto [first, last] = page_ranges[i];
+
+            for (++i; i < page_ranges.size() && page_ranges[i].first <= last + 1; ++i) {
+                last = std::max(last, page_ranges[i].second);
+            }
+
+            fetch_locked(first, last);
+        }
+    }
+
+    void clear() {
+        std::scoped_lock _{m_mutex};
+        m_pages.clear();
+        m_order.clear();
+    }
+
+    struct Stats {
+        size_t reads{};          // read() calls that succeeded
+        size_t source_reads{};   // calls into the source
+        size_t pages_fetched{};
+    };
+
+    Stats get_stats() {
+        std::scoped_lock _{m_mutex};
+        return m_stats;
+    }
+
+private:
+    using Page = std::vector<uint8_t>;
+
+    bool all_cached_locked(uintptr_t first_page, uintptr_t last_page) const {
+        for (auto page = first_page; page <= last_page; ++page) {
+            if (!m_pages.contains(page)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Reads every page in [first_page, last_page] that isn't cached yet, contiguous missing pages in one go
+    void fetch_locked(uintptr_t first_page, uintptr_t last_page) {
+        for (auto page = first_page; page <= last_page;) {
+            if (m_pages.contains(page)) {
+                ++page;
+                continue;
+            }
+
+            auto run_end = page;
+
+            while (run_end < last_page && !m_pages.contains(run_end + 1)) {
+                ++run_end;
+            }
+
+            fetch_run_locked(page, run_end);
+            page = run_end + 1;
+        }
+    }
+
+    void fetch_run_locked(uintptr_t first_page, uintptr_t last_page) {
+        const auto count = last_page - first_page + 1;
+        std::vector<uint8_t> buffer(count * CACHE_PAGE_SIZE);
+
+        ++m_stats.source_reads;
+
+        if (m_source(first_page * CACHE_PAGE_SIZE, buffer.data(), buffer.size())) {
+            for (size_t i = 0; i < count; ++i) {
+                insert_locked(first_page + i, std::make_unique<Page>(buffer.begin() + i * CACHE_PAGE_SIZE, buffer.begin() + (i + 1) * CACHE_PAGE_SIZE));
+            }
+
+            return;
+        }
+
+        // Something in the run isn't mapped. Unmapped pages get remembered as nullptr so they don't get asked for again
+        if (count == 1) {
+            insert_locked(first_page, nullptr);
+            return;
+        }
+
+        // Halves until the holes are found, so the mapped parts still come in a few big reads
+        const auto middle = first_page + count / 2;
+
+        fetch_run_locked(first_page, middle - 1);
+        fetch_run_locked(middle, last_page);
+    }
+
+    void insert_locked(uintptr_t page, std::unique_ptr<Page> data) {
+        if (data != nullptr) {
+            ++m_stats.pages_fetched;
+        }
+
+        // Oldest goes first, good enough for walks that don't come back to the same place much.
+        // Pages the current read() needs are skipped over
+        while (m_pages.size() >= m_max_pages) {
+            const auto victim = std::find_if(m_order.begin(), m_order.end(), [&](uintptr_t existing) {
+                return existing < m_pinned_first || existing > m_pinned_last;
+            });
+
+            if (victim == m_order.end()) {
+                break;
+            }
+
+            m_pages.erase(*victim);
+            m_order.erase(victim);
+        }
+
+        if (m_pages.insert_or_assign(page, std::move(data)).second) {
+            m_order.push_back(page);
+        }
+    }
+
+    SourceFn m_source{};
+    size_t m_max_pages{};
+    size_t m_readahead_pages{};
+
+    std::mutex m_mutex{};
+    std::unordered_map<uintptr_t, std::unique_ptr<Page>> m_pages{}; // page number -> contents, nullptr if unmapped
+    std::deque<uintptr_t> m_order{};
+    uintptr_t m_pinned_first{1}; // pages a read() is filling in, empty when first > last
+    uintptr_t m_pinned_last{0};
+    Stats m_stats{};
+};
+}
+}
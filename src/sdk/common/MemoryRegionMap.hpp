@@ -0,0 +1,223 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <algorithm>
+#include <shared_mutex>
+
+namespace sdk {
+namespace common {
+struct MemoryRegion {
+    uintptr_t start{};
+    size_t size{};
+    bool readable{false};
+
+    uintptr_t end() const {
+        return start + size;
+    }
+
+    bool contains(uintptr_t address) const {
+        return address >= start && address < end();
+    }
+};
+
+// Where MemoryRegionMap gets its regions from. VirtualQuery on Windows,
+// but anything works (/proc/self/maps, a hand written list), the map doesn't care.
+class MemoryRegionProvider {
+public:
+    virtual ~MemoryRegionProvider() = default;
+
+    // Every region the provider knows about, in any order
+    virtual std::vector<MemoryRegion> snapshot() = 0;
+
+    // Just the region containing address, if there is one
+    virtual std::optional<MemoryRegion> query(uintptr_t address) = 0;
+};
+
+// Answers "can I read [p, p+n)" with a binary search over what the provider said about each region,
+// instead of IsBadReadPtr probing every page (or an access violation getting caught) each time.
+// Regions are kept the way the provider reported them, unreadable ones included, each with when it was last asked about.
+// An answer only ever goes by regions asked about within max_age, anything older (or not known at all) gets one query()
+// and the result replaces what was there. So memory freed or allocated after the snapshot shows up within max_age,
+// and addresses that keep failing don't go back to the provider every time either.
+// The snapshot just fills everything in at once on first use (and after invalidate()).
+class MemoryRegionMap {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    MemoryRegionMap(std::unique_ptr<MemoryRegionProvider> provider, std::chrono::milliseconds max_age = std::chrono::milliseconds{100})
+        : m_provider{std::move(provider)},
+        m_max_age{max_age}
+    {
+    }
+
+    MemoryRegionMap(const MemoryRegionMap&) = delete;
+    MemoryRegionMap& operator=(const MemoryRegionMap&) = delete;
+
+    bool is_readable(uintptr_t address, size_t size) {
+        if (size == 0) {
+            size = 1;
+        }
+
+        // Small integers and non-canonical addresses, which is most of what the brute force loops throw at this
+        if (address < MIN_ADDRESS || address > MAX_ADDRESS || size > MAX_ADDRESS - address) {
+            return false;
+        }
+
+        if (!has_snapshot()) {
+            // Only one thread needs to take it, the rest just wait for it
+            std::scoped_lock _{m_refresh_mutex};
+
+            if (!has_snapshot()) {
+                refresh();
+            }
+        }
+
+        const auto end = address + size;
+        auto current = address;
+
+        while (current < end) {
+            const auto now = Clock::now();
+
+            {
+                std::shared_lock _{m_mutex};
+
+                if (const auto entry = find_locked(current); entry != nullptr && is_fresh(*entry, now)) {
+                    if (!entry->region.readable) {
+                        return false;
+                    }
+
+                    current = entry->region.end();
+                    continue;
+                }
+            }
+
+            // Not known, or hasn't been asked about in a while
+            const auto region = m_provider->query(current);
+
+            // Nothing to remember without knowing how far it goes
+            if (!region.has_value() || region->size == 0 || !region->contains(current)) {
+                return false;
+            }
+
+            {
+                std::unique_lock _{m_mutex};
+                insert_locked(Entry{*region, now});
+            }
+
+            if (!region->readable) {
+                return false;
+            }
+
+            current = region->end();
+        }
+
+        return true;
+    }
+
+    bool is_readable(const void* address, size_t size) {
+        return is_readable((uintptr_t)address, size);
+    }
+
+    void refresh() {
+        auto regions = m_provider->snapshot();
+
+        std::erase_if(regions, [](const MemoryRegion& region) { return region.size == 0; });
+        std::sort(regions.begin(), regions.end(), [](const MemoryRegion& a, const MemoryRegion& b) {
+            return a.start < b.start;
+        });
+
+        const auto now = Clock::now();
+
+        std::vector<Entry> entries{};
+        entries.reserve(regions.size());
+
+        for (const auto& region : regions) {
+            // Providers aren't supposed to overlap, first one wins if they do
+            if (!entries.empty() && region.start < entries.back().region.end()) {
+                continue;
+            }
+
+            entries.push_back(Entry{region, now});
+        }
+
+        std::unique_lock _{m_mutex};
+        m_entries = std::move(entries);
+        m_has_snapshot = true;
+    }
+
+    // Next lookup retakes the snapshot, for after something big got unloaded
+    void invalidate() {
+        std::unique_lock _{m_mutex};
+        m_has_snapshot = false;
+    }
+
+    // Regions known about, readable or not
+    size_t size() const {
+        std::shared_lock _{m_mutex};
+        return m_entries.size();
+    }
+
+private:
+    struct Entry {
+        MemoryRegion region{};
+        Clock::time_point checked{};
+    };
+
+    bool has_snapshot() const {
+        std::shared_lock _{m_mutex};
+        return m_has_snapshot;
+    }
+
+    bool is_fresh(const Entry& entry, Clock::time_point now) const {
+        return now - entry.checked <= m_max_age;
+    }
+
+    const Entry* find_locked(uintptr_t address) const {
+        auto it = std::upper_bound(m_entries.begin(), m_entries.end(), address, [](uintptr_t value, const Entry& entry) {
+            return value < entry.region.start;
+        });
+
+        if (it == m_entries.begin()) {
+            return nullptr;
+        }
+
+        --it;
+        return it->region.contains(address) ? &*it : nullptr;
+    }
+
+    void insert_locked(const Entry& entry) {
+        const auto& region = entry.region;
+
+        // Replaces everything it overlaps, what the provider just said beats anything older
+        auto first = std::lower_bound(m_entries.begin(), m_entries.end(), region.start, [](const Entry& existing, uintptr_t value) {
+            return existing.region.end() <= value;
+        });
+
+        auto last = first;
+
+        while (last != m_entries.end() && last->region.start < region.end()) {
+            ++last;
+        }
+
+        first = m_entries.erase(first, last);
+        m_entries.insert(first, entry);
+    }
+
+    constexpr static inline uintptr_t MIN_ADDRESS = 0x10000;
+    constexpr static inline uintptr_t MAX_ADDRESS = 0x7FFFFFFFFFFF;
+
+    std::unique_ptr<MemoryRegionProvider> m_provider{};
+    std::chrono::milliseconds m_max_age{};
+
+    std::mutex m_refresh_mutex{};
+    mutable std::shared_mutex m_mutex{};
+    std::vector<Entry> m_entries{}; // sorted, not overlapping, unreadable ones included
+    bool m_has_snapshot{false};
+};
+}
+}
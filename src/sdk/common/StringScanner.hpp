@@ -0,0 +1,120 @@
+#pragma once
+
+#include <span>
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+namespace sdk {
+namespace common {
+// Finds any number of byte strings in one pass over a buffer, instead of one pass per string.
+// Every position's first 4 bytes get hashed into a 64K bit filter that fits in L1,
+// only positions that hit the filter go on to the bucket of needles sharing that prefix.
+// The filter is set up so almost every byte of .rdata costs a load, a multiply and a bit test.
+// Doesn't depend on anything Windows so it can be fed synthetic images anywhere.
+class StringScanner {
+public:
+    // Anything shorter can't be hashed on its prefix
+    constexpr static inline size_t MIN_NEEDLE_SIZE = 4;
+
+    // Returns the needle's id, std::nullopt if it's too short
+    std::optional<size_t> add(std::string needle) {
+        if (needle.size() < MIN_NEEDLE_SIZE) {
+            return std::nullopt;
+        }
+
+        const auto id = m_needles.size();
+        const auto prefix = read_prefix((const uint8_t*)needle.data());
+        const auto h = hash(prefix);
+
+        m_filter[h / 64] |= 1ull << (h % 64);
+        m_buckets[prefix].push_back(id);
+        m_needles.push_back(std::move(needle));
+
+        return id;
+    }
+
+    size_t size() const {
+        return m_needles.size();
+    }
+
+    const std::string& get_needle(size_t id) const {
+        return m_needles[id];
+    }
+
+    // Calls on_match(id, offset) for every occurrence of every needle, overlapping ones included.
+    // Offsets come in increasing order
+    template<typename F>
+    void scan(std::span<const uint8_t> data, F&& on_match) const {
+        if (m_needles.empty() || data.size() < MIN_NEEDLE_SIZE) {
+            return;
+        }
+
+        const auto begin = data.data();
+        const auto end = begin + data.size();
+
+        for (auto p = begin; p + MIN_NEEDLE_SIZE <= end; ++p) {
+            const auto prefix = read_prefix(p);
+            const auto h = hash(prefix);
+
+            if ((m_filter[h / 64] & (1ull << (h % 64))) == 0) {
+                continue;
+            }
+
+            const auto bucket = m_buckets.find(prefix);
+
+            if (bucket == m_buckets.end()) {
+                continue;
+            }
+
+            const auto remaining = (size_t)(end - p);
+
+            for (const auto id : bucket->second) {
+                const auto& needle = m_needles[id];
+
+                if (needle.size() <= remaining && std::memcmp(p, needle.data(), needle.size()) == 0) {
+                    on_match(id, (size_t)(p - begin));
+                }
+            }
+        }
+    }
+
+    // The byte patterns the SDK looks for, UTF-16LE no matter how wide wchar_t is
+    static std::string to_bytes(std::wstring_view str) {
+        std::string result{};
+        result.reserve(str.size() * 2);
+
+        for (const auto c : str) {
+            result.push_back((char)(c & 0xFF));
+            result.push_back((char)((c >> 8) & 0xFF));
+        }
+
+        return result;
+    }
+
+    static std::string to_bytes(std::string_view str) {
+        return std::string{str};
+    }
+
+private:
+    static uint32_t read_prefix(const uint8_t* p) {
+        uint32_t result{};
+        std::memcpy(&result, p, sizeof(result));
+        return result;
+    }
+
+    static uint32_t hash(uint32_t prefix) {
+        return (prefix * 0x9E3779B1u) >> 16;
+    }
+
+    std::vector<std::string> m_needles{};
+    std::array<uint64_t, 65536 / 64> m_filter{};
+    std::unordered_map<uint32_t, std::vector<size_t>> m_buckets{};
+};
+}
+}
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <optional>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+#include <spdlog/spdlog.h>
+
+#include "GameThreadWorker.hpp"
+#include "RenderThreadWorker.hpp"
+
+// Spreads work over as many frames as it takes instead of running all of it in the next execute().
+// Each frame (one execute() of the worker underneath) gets a time budget, work runs highest priority first
+// until the budget is used up and the rest waits for the next frame. Work that has waited longer than its
+// max_delay goes to the front of the line, and one of those a frame gets to run even past the budget,
+// so low priority stuff gets pushed back but never starved, and a backlog of it still gets drained a bit at a time.
+// Named work gets its run time tracked, and the average is used to leave it for next frame when it clearly won't fit.
+template<typename Worker>
+class FrameScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Function = std::move_only_function<void()>;
+
+    enum class Priority : uint8_t {
+        CRITICAL, // ignores the budget, for things that can't wait a frame
+        HIGH,
+        NORMAL,
+        LOW,
+        COUNT
+    };
+
+    struct Cost {
+        uint64_t count{0};
+        Clock::duration total{};
+        Clock::duration average{}; // moving average, what the scheduler goes by
+        Clock::duration max{};
+    };
+
+    struct Stats {
+        uint64_t frames{0};
+        uint64_t tasks_run{0};
+        uint64_t frames_over_budget{0};
+        uint64_t deadline_overrides{0}; // ran past the budget because they had waited long enough
+        size_t pending{0};
+    };
+
+    static FrameScheduler& get() {
+        static FrameScheduler instance{Worker::get()};
+        return instance;
+    }
+
+    // Callable from any thread. name is what the cost gets tracked under, empty means it isn't
+    void schedule(Function func, Priority priority = Priority::NORMAL, std::string_view name = {}, std::optional<Clock::duration> max_delay = std::nullopt) {
+        const auto now = Clock::now();
+
+        // COUNT isn't a priority, anything past LOW just gets treated as LOW
+        if (priority >= Priority::COUNT) {
+            priority = Priority::LOW;
+        }
+
+        {
+            std::scoped_lock _{m_mutex};
+            m_queues[(size_t)priority].push_back(Task{
+                std::move(func),
+                std::string{name},
+                now + max_delay.value_or(get_default_max_delay(priority))
+            });
+        }
+
+        request_pump();
+    }
+
+    void set_budget(Clock::duration budget) {
+        std::scoped_lock _{m_mutex};
+        m_budget = budget;
+    }
+
+    Clock::duration get_budget() {
+        std::scoped_lock _{m_mutex};
+        return m_budget;
+    }
+
+    std::unordered_map<std::string, Cost> get_costs() {
+        std::scoped_lock _{m_mutex};
+        return m_costs;
+    }
+
+    Stats get_stats() {
+        std::scoped_lock _{m_mutex};
+
+        auto result = m_stats;
+        result.pending = 0;
+
+        for (const auto& queue : m_queues) {
+            result.pending += queue.size();
+        }
+
+        return result;
+    }
+
+    static Clock::duration get_default_max_delay(Priority priority) {
+        using namespace std::chrono_literals;
+
+        switch (priority) {
+        case Priority::CRITICAL:
+        case Priority::HIGH:
+            return 50ms;
+        case Priority::NORMAL:
+            return 250ms;
+        default:
+            return 2s;
+        }
+    }
+
+private:
+    struct Task {
+        Function func{};
+        std::string name{};
+        Clock::time_point deadline{};
+    };
+
+    FrameScheduler(Worker& worker)
+        : m_worker{worker}
+    {
+    }
+
+    void request_pump() {
+        if (!m_pump_pending.exchange(true, std::memory_order_acq_rel)) {
+            m_worker.enqueue([this]() { pump(); });
+        }
+    }
+
+    // Runs inside the worker's execute(), once per frame while there's anything left
+    void pump() {
+        // Anything scheduled from here on needs another pump, and that one lands in the next execute()
+        m_pump_pending.store(false, std::memory_order_release);
+
+        const auto frame_start = Clock::now();
+        bool ran_any = false;
+        bool overrode_budget = false;
+
+        for (;;) {
+            const auto now = Clock::now();
+            Task task{};
+            bool over_budget = false;
+
+            {
+                std::scoped_lock _{m_mutex};
+
+                const auto remaining = m_budget - (now - frame_start);
+
+                if (!pick_locked(now, remaining, ran_any, !overrode_budget, task, over_budget)) {
+                    break;
+                }
+
+                if (over_budget) {
+                    overrode_budget = true;
+                    ++m_stats.deadline_overrides;
+                }
+            }
+
+            const auto start = Clock::now();
+
+            try {
+                task.func();
+            } catch(...) {
+                // The rest of the frame still runs
+                SPDLOG_ERROR("[FrameScheduler] Exception occurred in {}", !task.name.empty() ? task.name : "unnamed task");
+            }
+
+            const auto elapsed = Clock::now() - start;
+            ran_any = true;
+
+            std::scoped_lock _{m_mutex};
+            ++m_stats.tasks_run;
+
+            if (!task.name.empty()) {
+                auto& cost = m_costs[task.name];
+                cost.average = cost.count == 0 ? elapsed : (cost.average * 7 + elapsed) / 8;
+                cost.max = std::max(cost.max, elapsed);
+                cost.total += elapsed;
+                ++cost.count;
+            }
+        }
+
+        bool has_more = false;
+
+        {
+            std::scoped_lock _{m_mutex};
+            ++m_stats.frames;
+
+            if (Clock::now() - frame_start > m_budget) {
+                ++m_stats.frames_over_budget;
+            }
+
+            for (const auto& queue : m_queues) {
+                has_more = has_more || !queue.empty();
+            }
+        }
+
+        if (has_more) {
+            request_pump();
+        }
+    }
+
+    bool pick_locked(Clock::time_point now, Clock::duration remaining, bool ran_any, bool allow_override, Task& out, bool& over_budget) {
+        const auto take = [&](std::deque<Task>& queue) {
+            out = std::move(queue.front());
+            queue.pop_front();
+            return true;
+        };
+
+        if (!m_queues[(size_t)Priority::CRITICAL].empty()) {
+            return take(m_queues[(size_t)Priority::CRITICAL]);
+        }
+
+        // Anything that has waited long enough comes first, and one of them can go past the budget
+        for (auto& queue : m_queues) {
+            if (!queue.empty() && queue.front().deadline <= now) {
+                over_budget = remaining <= Clock::duration::zero();
+
+                if (over_budget && !allow_override) {
+                    return false;
+                }
+
+                return take(queue);
+            }
+        }
+
+        if (remaining <= Clock::duration::zero()) {
+            return false;
+        }
+
+        for (auto& queue : m_queues) {
+            if (queue.empty()) {
+                continue;
+            }
+
+            // Always let one thing through per frame, otherwise something that costs more than the whole budget never runs
+            if (ran_any && get_estimate_locked(queue.front()) > remaining) {
+                return false;
+            }
+
+            return take(queue);
+        }
+
+        return false;
+    }
+
+    Clock::duration get_estimate_locked(const Task& task) const {
+        if (task.name.empty()) {
+            return Clock::duration::zero();
+        }
+
+        const auto it = m_costs.find(task.name);
+        return it != m_costs.end() ? it->second.average : Clock::duration::zero();
+    }
+
+    Worker& m_worker;
+    std::atomic<bool> m_pump_pending{false};
+
+    std::mutex m_mutex{};
+    std::array<std::deque<Task>, (size_t)Priority::COUNT> m_queues{};
+    std::unordered_map<std::string, Cost> m_costs{};
+    Clock::duration m_budget{std::chrono::microseconds{2000}};
+    Stats m_stats{};
+};
+
+using GameThreadScheduler = FrameScheduler<GameThreadWorker>;
+using RenderThreadScheduler = FrameScheduler<RenderThreadWorker>;
\ No newline at end of file
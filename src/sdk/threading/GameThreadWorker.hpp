@@ -9,4 +9,10 @@ public:
         static GameThreadWorker instance{};
         return instance;
     }
+
+private:
+    GameThreadWorker()
+        : ThreadWorker{"GameThreadWorker"}
+    {
+    }
 };
\ No newline at end of file
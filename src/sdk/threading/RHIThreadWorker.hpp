@@ -9,4 +9,10 @@ public:
         static RHIThreadWorker instance{};
         return instance;
     }
+
+private:
+    RHIThreadWorker()
+        : ThreadWorker{"RHIThreadWorker"}
+    {
+    }
 };
\ No newline at end of file
@@ -9,4 +9,10 @@ public:
         static RenderThreadWorker instance{};
         return instance;
     }
+
+private:
+    RenderThreadWorker()
+        : ThreadWorker{"RenderThreadWorker"}
+    {
+    }
 };
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <coroutine>
+#include <type_traits>
+
+#include "GameThreadWorker.hpp"
+#include "RenderThreadWorker.hpp"
+#include "RHIThreadWorker.hpp"
+
+// Coroutines that hop between threads through the ThreadWorkers, e.g.
+//
+//   sdk::Task<int> do_thing() {
+//       co_await sdk::on_game_thread();
+//       const auto x = read_something_from_the_world();
+//       co_await sdk::on_render_thread();
+//       co_return use_it_on_the_render_thread(x);
+//   }
+//
+// A Task starts running as soon as it's called, up to its first co_await, and cleans up after itself when it finishes,
+// so dropping the Task on the floor is the coroutine version of a fire and forget enqueue.
+// Keep it around to co_await it from another coroutine, or poll it from code that isn't one.
+namespace sdk {
+namespace detail {
+template<typename T>
+class TaskState {
+public:
+    bool is_done() const {
+        return m_continuation.load(std::memory_order_acquire) == done_marker();
+    }
+
+    // Called from the coroutine waiting on this, false means it already finished and there's nothing to wait for
+    bool set_continuation(std::coroutine_handle<> continuation) {
+        void* expected = nullptr;
+        return m_continuation.compare_exchange_strong(expected, continuation.address(), std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+
+    // Hands back whoever was waiting, if anyone
+    std::coroutine_handle<> complete() {
+        const auto waiting = m_continuation.exchange(done_marker(), std::memory_order_acq_rel);
+        m_continuation.notify_all();
+
+        if (waiting == nullptr) {
+            return nullptr;
+        }
+
+        return std::coroutine_handle<>::from_address(waiting);
+    }
+
+    void wait() const {
+        for (auto current = m_continuation.load(std::memory_order_acquire); current != done_marker(); current = m_continuation.load(std::memory_order_acquire)) {
+            m_continuation.wait(current, std::memory_order_acquire);
+        }
+    }
+
+    template<typename U>
+    void set_value(U&& value) {
+        m_value.emplace(std::forward<U>(value));
+    }
+
+    void set_exception(std::exception_ptr exception) {
+        m_exception = std::move(exception);
+    }
+
+    T take() {
+        if (m_exception != nullptr) {
+            std::rethrow_exception(m_exception);
+        }
+
+        if constexpr (!std::is_void_v<T>) {
+            return std::move(*m_value);
+        }
+    }
+
+private:
+    static void* done_marker() {
+        static char marker{};
+        return &marker;
+    }
+
+    struct Empty {};
+
+    std::atomic<void*> m_continuation{nullptr}; // nullptr: nobody waiting yet, done_marker(): finished, anything else: the waiting coroutine
+    std::conditional_t<std::is_void_v<T>, std::optional<Empty>, std::optional<T>> m_value{};
+    std::exception_ptr m_exception{};
+};
+
+// Tears the frame down and carries straight on with whoever was waiting
+struct TaskFinalAwaiter {
+    bool await_ready() noexcept {
+        return false;
+    }
+
+    template<typename Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept {
+        const auto state = std::move(self.promise().state);
+        self.destroy();
+
+        if (const auto continuation = state->complete(); continuation) {
+            return continuation;
+        }
+
+        return std::noop_coroutine();
+    }
+
+    void await_resume() noexcept {
+    }
+};
+
+template<typename T>
+struct TaskPromiseBase {
+    std::shared_ptr<TaskState<T>> state{std::make_shared<TaskState<T>>()};
+
+    std::suspend_never initial_suspend() noexcept {
+        return {};
+    }
+
+    TaskFinalAwaiter final_suspend() noexcept {
+        return {};
+    }
+
+    void unhandled_exception() {
+        state->set_exception(std::current_exception());
+    }
+};
+
+template<typename T>
+struct TaskPromise : TaskPromiseBase<T> {
+    template<typename U>
+    void return_value(U&& value) {
+        this->state->set_value(std::forward<U>(value));
+    }
+};
+
+template<>
+struct TaskPromise<void> : TaskPromiseBase<void> {
+    void return_void() {
+    }
+};
+}
+
+template<typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : detail::TaskPromise<T> {
+        Task get_return_object() {
+            return Task{this->state};
+        }
+    };
+
+    Task() = default;
+
+    bool valid() const {
+        return m_state != nullptr;
+    }
+
+    bool is_ready() const {
+        return m_state != nullptr && m_state->is_done();
+    }
+
+    // Blocks until it's done. Don't call this on the thread the task is waiting to get onto
+    T get() {
+        m_state->wait();
+        return m_state->take();
+    }
+
+    // Only one coroutine can co_await a given Task
+    auto operator co_await() {
+        struct Awaiter {
+            std::shared_ptr<detail::TaskState<T>> state{};
+
+            bool await_ready() const {
+                return state->is_done();
+            }
+
+            bool await_suspend(std::coroutine_handle<> continuation) {
+                return state->set_continuation(continuation);
+            }
+
+            T await_resume() {
+                return state->take();
+            }
+        };
+
+        return Awaiter{m_state};
+    }
+
+private:
+    Task(std::shared_ptr<detail::TaskState<T>> state)
+        : m_state{std::move(state)}
+    {
+    }
+
+    std::shared_ptr<detail::TaskState<T>> m_state{};
+};
+
+// co_await one of these to continue inside the worker's next execute().
+// Already being on that thread just carries on without waiting a frame
+template<typename Worker>
+struct ResumeOn {
+    Worker& worker;
+
+    bool await_ready() const {
+        return worker.is_same_thread();
+    }
+
+    void await_suspend(std::coroutine_handle<> continuation) {
+        worker.enqueue([continuation]() {
+            continuation.resume();
+        });
+    }
+
+    void await_resume() const {
+    }
+};
+
+inline ResumeOn<GameThreadWorker> on_game_thread() {
+    return {GameThreadWorker::get()};
+}
+
+inline ResumeOn<RenderThreadWorker> on_render_thread() {
+    return {RenderThreadWorker::get()};
+}
+
+inline ResumeOn<RHIThreadWorker> on_rhi_thread() {
+    return {RHIThreadWorker::get()};
+}
+}
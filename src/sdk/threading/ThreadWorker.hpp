@@ -1,45 +1,262 @@
 #pragma once
 
-#include <deque>
-#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <cstdint>
+#include <utility>
 #include <functional>
+#include <string_view>
 
-// Class that executes functions on a specific thread when inherited from
+#include <tracy/Tracy.hpp>
+
+#include "../common/LatencyHistogram.hpp"
+
+// Class that executes functions on a specific thread when inherited from.
+// enqueue() pushes onto a lock-free stack, so producers never wait on each other or on a drain in progress.
+// execute() takes everything pending with one exchange, puts it back in submission order and runs it without holding anything,
+// anything enqueued while that's happening (including from the callbacks themselves) runs on the next execute().
+// Nodes get recycled through a free list shared by every worker of the same type, so a steady stream of work doesn't allocate.
+// Every item is timestamped when it's enqueued, so how long things wait, how deep the queue gets and how long
+// each drain takes are always being tracked, see get_stats(). With Tracy enabled those get plotted too.
 template<typename... Args>
 class ThreadWorker {
 public:
+    // Move-only so captures don't need to be copyable, and small captures are stored inline instead of on the heap
+    using Function = std::move_only_function<void(Args...)>;
+
+    struct Stats {
+        uint64_t enqueued{0};
+        uint64_t executed{0};
+        int64_t depth{0};
+        int64_t max_depth{0};
+        sdk::common::LatencyHistogram::Snapshot latency{}; // ns from enqueue() to the call starting
+        sdk::common::LatencyHistogram::Snapshot drain{}; // ns per execute() that had anything to run
+    };
+
+    ThreadWorker(std::string_view name = "ThreadWorker")
+        : m_plot_depth{std::string{name} + " depth"},
+        m_plot_latency{std::string{name} + " latency (us)"},
+        m_plot_drain{std::string{name} + " drain (us)"}
+    {
+    }
+
+    ThreadWorker(const ThreadWorker&) = delete;
+    ThreadWorker& operator=(const ThreadWorker&) = delete;
+
+    ~ThreadWorker() {
+        delete_list(m_head.exchange(nullptr, std::memory_order_acquire));
+        delete_list(m_leftover);
+    }
+
     template<typename... T>
     void execute(T... args) {
-        std::scoped_lock _{m_mutex};
-        m_thread_id = std::this_thread::get_id();
+        // Single consumer. Another thread (or a callback) calling this mid drain just gets nothing
+        if (m_draining.test_and_set(std::memory_order_acquire)) {
+            return;
+        }
+
+        // Only whoever actually drains counts as the worker's thread, not someone who bounced off above
+        m_thread_id.store(std::this_thread::get_id(), std::memory_order_relaxed);
+
+        struct DrainGuard {
+            std::atomic_flag& flag;
 
-        if (m_queue.empty()) {
+            ~DrainGuard() {
+                flag.clear(std::memory_order_release);
+            }
+        } guard{m_draining};
+
+        // Whatever was left behind by a callback that threw goes first
+        auto batch = std::exchange(m_leftover, nullptr);
+        append(batch, reverse(m_head.exchange(nullptr, std::memory_order_acquire)));
+
+        if (batch == nullptr) {
             return;
         }
 
-        for (auto& func : m_queue) {
-            func(args...);
+        const auto drain_start = now();
+
+        // Only a drain takes anything out, so the queue is at its deepest right before one.
+        // Measured here so producers don't all have to fight over a shared depth counter
+        int64_t depth = 0;
+
+        for (auto it = batch; it != nullptr; it = it->next) {
+            ++depth;
+        }
+
+        if (depth > m_max_depth.load(std::memory_order_relaxed)) {
+            m_max_depth.store(depth, std::memory_order_relaxed);
+        }
+
+        TracyPlot(m_plot_depth.c_str(), depth);
+
+        while (batch != nullptr) {
+            const auto node = batch;
+            batch = node->next;
+            m_leftover = batch;
+
+            // Captures get destroyed right after the call, not whenever the node gets reused. Also when it throws
+            struct RecycleGuard {
+                Node* node;
+
+                ~RecycleGuard() {
+                    node->func = nullptr;
+                    recycle(node);
+                }
+            } recycle_guard{node};
+
+            // Only the drain writes these, no need for locked instructions
+            const auto latency = now() - node->enqueued_at;
+            m_latency.record_single_writer(latency);
+            TracyPlot(m_plot_latency.c_str(), (int64_t)(latency / 1000));
+
+            m_executed.store(m_executed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+            node->func(args...);
+        }
+
+        m_leftover = nullptr;
+
+        const auto drain = now() - drain_start;
+        m_drain.record_single_writer(drain);
+        TracyPlot(m_plot_drain.c_str(), (int64_t)(drain / 1000));
+    }
+
+    void enqueue(Function func) {
+        auto node = allocate();
+        node->func = std::move(func);
+        node->enqueued_at = now();
+
+        // Counted before it's visible, so executed can't get ahead of it
+        m_enqueued.fetch_add(1, std::memory_order_relaxed);
+
+        node->next = m_head.load(std::memory_order_relaxed);
+
+        while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
         }
+    }
 
-        m_queue.clear();
+    Stats get_stats() const {
+        return Stats {
+            .enqueued = m_enqueued.load(std::memory_order_relaxed),
+            .executed = m_executed.load(std::memory_order_relaxed),
+            .depth = (int64_t)(m_enqueued.load(std::memory_order_relaxed) - m_executed.load(std::memory_order_relaxed)),
+            .max_depth = m_max_depth.load(std::memory_order_relaxed),
+            .latency = m_latency.snapshot(),
+            .drain = m_drain.snapshot()
+        };
     }
 
-    void enqueue(std::function<void(Args...)> func) {
-        std::scoped_lock _{m_mutex};
-        m_queue.push_back(func);
+    // Histograms and the high-water mark start over, counters and the current depth keep going
+    void reset_stats() {
+        m_latency.reset();
+        m_drain.reset();
+        m_max_depth.store(0, std::memory_order_relaxed);
     }
 
     std::thread::id get_thread_id() {
-        return m_thread_id;
+        return m_thread_id.load(std::memory_order_relaxed);
     }
 
     bool is_same_thread() const {
-        return m_thread_id == std::this_thread::get_id();
+        return m_thread_id.load(std::memory_order_relaxed) == std::this_thread::get_id();
     }
 
 private:
-    std::recursive_mutex m_mutex{};
-    std::deque<std::function<void(Args...)>> m_queue{};
+    struct Node {
+        Function func{};
+        uint64_t enqueued_at{}; // ns
+        Node* next{nullptr};
+    };
+
+    static uint64_t now() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // The stack comes out newest first
+    static Node* reverse(Node* list) {
+        Node* result = nullptr;
+
+        while (list != nullptr) {
+            const auto next = list->next;
+            list->next = result;
+            result = list;
+            list = next;
+        }
+
+        return result;
+    }
+
+    static void append(Node*& list, Node* tail) {
+        auto it = &list;
+
+        while (*it != nullptr) {
+            it = &(*it)->next;
+        }
+
+        *it = tail;
+    }
+
+    // Producers never pop single nodes off the shared list (that's where ABA comes in), they take all of it at once
+    // and keep it in a thread local cache. Drains only ever push, one node at a time
+    static Node* allocate() {
+        struct Cache {
+            Node* head{nullptr};
+
+            ~Cache() {
+                delete_list(head);
+            }
+        };
+
+        thread_local Cache cache{};
+
+        if (cache.head == nullptr) {
+            cache.head = s_free.exchange(nullptr, std::memory_order_acquire);
+        }
+
+        if (cache.head == nullptr) {
+            return new Node{};
+        }
+
+        const auto node = std::exchange(cache.head, cache.head->next);
+        node->next = nullptr;
+        return node;
+    }
+
+    static void recycle(Node* node) {
+        node->next = s_free.load(std::memory_order_relaxed);
+
+        while (!s_free.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void delete_list(Node* list) {
+        while (list != nullptr) {
+            std::unique_ptr<Node> node{list};
+            list = node->next;
+        }
+    }
+
+    // Never freed, it only ever holds as many nodes as were in flight at once
+    static inline std::atomic<Node*> s_free{nullptr};
+
+    std::atomic<Node*> m_head{nullptr}; // producers push here, newest first
+    Node* m_leftover{nullptr}; // only touched while draining
+    std::atomic_flag m_draining{};
+
+    std::atomic<std::thread::id> m_thread_id{};
+
+    std::atomic<uint64_t> m_enqueued{0};
+    std::atomic<uint64_t> m_executed{0};
+    std::atomic<int64_t> m_max_depth{0}; // only written while draining
+    sdk::common::LatencyHistogram m_latency{};
+    sdk::common::LatencyHistogram m_drain{};
 
-    std::thread::id m_thread_id{};
+    // Tracy wants the same pointer every time
+    std::string m_plot_depth{};
+    std::string m_plot_latency{};
+    std::string m_plot_drain{};
 };
\ No newline at end of file
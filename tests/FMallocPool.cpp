@@ -0,0 +1,170 @@
+#include <thread>
+#include <vector>
+#include <string>
+#include <cstring>
+
+#include <sdk/FMallocAllocator.hpp>
+
+#include "Test.hpp"
+
+using namespace sdk;
+
+namespace {
+// Installs a fresh mock GMalloc for one test case
+struct MockMalloc {
+    FMalloc malloc{};
+
+    MockMalloc() {
+        FMallocPool::trim();
+        FMalloc::set(&malloc);
+    }
+
+    ~MockMalloc() {
+        FMallocPool::trim();
+        FMalloc::set(nullptr);
+    }
+};
+}
+
+TEST_CASE(fmalloc_pool_size_classes) {
+    CHECK(FMallocPool::get_class(0) == 0);
+    CHECK(FMallocPool::get_class(1) == 0);
+    CHECK(FMallocPool::get_class(16) == 0);
+    CHECK(FMallocPool::get_class(17) == 1);
+    CHECK(FMallocPool::get_class(512) == 5);
+    CHECK(FMallocPool::get_class_size(FMallocPool::get_class(300)) == 512);
+}
+
+TEST_CASE(fmalloc_pool_reuses_blocks) {
+    MockMalloc mock{};
+
+    const auto a = FMallocPool::allocate(20);
+    CHECK(mock.malloc.last_size == 32);
+
+    FMallocPool::free(a, 20);
+
+    // Same class, same block, GMalloc not involved
+    const auto b = FMallocPool::allocate(30);
+    CHECK(b == a);
+    CHECK(mock.malloc.mallocs == 1);
+
+    FMallocPool::free(b, 30);
+
+    const auto stats = FMallocPool::get_stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 1);
+    CHECK(stats.cached == 1);
+
+    FMallocPool::trim();
+    CHECK(FMallocPool::get_stats().cached == 0);
+    CHECK(mock.malloc.frees == 1);
+}
+
+TEST_CASE(fmalloc_pool_bypasses_big_and_aligned) {
+    MockMalloc mock{};
+    const auto bypassed = FMallocPool::get_stats().bypassed;
+
+    const auto big = FMallocPool::allocate(FMallocPool::MAX_BLOCK_SIZE + 1);
+    CHECK(mock.malloc.last_size == FMallocPool::MAX_BLOCK_SIZE + 1);
+
+    const auto aligned = FMallocPool::allocate(64, 64);
+    CHECK(mock.malloc.last_size == 64);
+    CHECK(mock.malloc.last_alignment == 64);
+    CHECK((uintptr_t)aligned % 64 == 0);
+
+    CHECK(FMallocPool::get_stats().bypassed == bypassed + 2);
+
+    // Neither gets cached
+    FMallocPool::free(big, FMallocPool::MAX_BLOCK_SIZE + 1);
+    FMallocPool::free(aligned, 64, 64);
+    CHECK(mock.malloc.frees == 2);
+    CHECK(FMallocPool::get_stats().cached == 0);
+}
+
+TEST_CASE(fmalloc_pool_caps_each_class) {
+    MockMalloc mock{};
+    std::vector<void*> blocks{};
+
+    for (size_t i = 0; i < FMallocPool::MAX_CACHED + 10; ++i) {
+        blocks.push_back(FMallocPool::allocate(64));
+    }
+
+    for (const auto block : blocks) {
+        FMallocPool::free(block, 64);
+    }
+
+    CHECK(FMallocPool::get_stats().cached == FMallocPool::MAX_CACHED);
+    CHECK(mock.malloc.frees == 10);
+}
+
+TEST_CASE(fmalloc_pool_after_thread_pool_is_gone) {
+    MockMalloc mock{};
+
+    size_t late_size = 0;
+    void* late_block = nullptr;
+
+    // Destroyed after the thread's pool since it's constructed before it,
+    // so its allocation goes down the path for threads whose pool is gone
+    struct LateAllocation {
+        size_t& size;
+        void*& block;
+
+        ~LateAllocation() {
+            block = FMallocPool::allocate(20);
+            size = FMalloc::get()->last_size;
+        }
+    };
+
+    std::thread{[&] {
+        thread_local LateAllocation late{late_size, late_block};
+        FMallocPool::get_stats();
+    }}.join();
+
+    // The whole class, since the block can still be freed into some other thread's cache
+    CHECK(late_size == 32);
+    REQUIRE(late_block != nullptr);
+
+    FMallocPool::free(late_block, 20);
+    CHECK(FMallocPool::get_stats().cached == 1);
+
+    // Handed out for the biggest size in the class, which has to fit
+    const auto reused = FMallocPool::allocate(32);
+    CHECK(reused == late_block);
+    memset(reused, 0xCC, 32);
+    FMallocPool::free(reused, 32);
+}
+
+TEST_CASE(fmalloc_pool_allocator_in_containers) {
+    MockMalloc mock{};
+
+    {
+        std::vector<int, FMallocPoolAllocator<int>> values{};
+
+        for (int i = 0; i < 200; ++i) {
+            values.push_back(i);
+        }
+
+        CHECK(values[199] == 199);
+
+        std::basic_string<char, std::char_traits<char>, FMallocPoolAllocator<char>> name{"SomeRatherLongObjectNameThatDoesntFitInSSO"};
+        CHECK(name.size() == 42);
+    }
+
+    FMallocPool::trim();
+    CHECK(mock.malloc.mallocs == mock.malloc.frees);
+}
+
+TEST_CASE(fmalloc_allocator_without_gmalloc) {
+    FMalloc::set(nullptr);
+
+    bool threw = false;
+
+    try {
+        std::vector<int, FMallocAllocator<int>> values{};
+        values.push_back(1);
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+
+    CHECK(threw);
+}
@@ -0,0 +1,124 @@
+#include <set>
+#include <numeric>
+
+#include <sdk/common/MemoryBackend.hpp>
+
+#include "Test.hpp"
+
+using namespace sdk::common;
+
+namespace {
+constexpr auto PAGE = CachedBackend::CACHE_PAGE_SIZE;
+constexpr uintptr_t BASE = 0x100000;
+
+// Every byte is its address' low byte, pages in holes aren't there
+struct FakeSource {
+    std::set<uintptr_t> holes{}; // page numbers
+    size_t calls{0};
+
+    bool operator()(uintptr_t address, void* out, size_t size) {
+        ++calls;
+
+        for (auto page = address / PAGE; page <= (address + size - 1) / PAGE; ++page) {
+            if (holes.contains(page)) {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            ((uint8_t*)out)[i] = (uint8_t)(address + i);
+        }
+
+        return true;
+    }
+};
+
+bool matches(uintptr_t address, const std::vector<uint8_t>& bytes) {
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        if (bytes[i] != (uint8_t)(address + i)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+}
+
+TEST_CASE(cached_backend_tiny_cache) {
+    // Default readahead is bigger than the whole cache, which used to evict the page being read
+    FakeSource source{};
+    CachedBackend backend{std::ref(source), 1};
+
+    std::vector<uint8_t> bytes(64);
+
+    for (uintptr_t address = BASE; address < BASE + PAGE * 4; address += 100) {
+        CHECK(backend.read(address, bytes.data(), bytes.size()));
+        CHECK(matches(address, bytes));
+    }
+
+    // Two pages with room for only one goes straight to the source
+    bytes.resize(PAGE + 16);
+    CHECK(backend.read(BASE + PAGE - 8, bytes.data(), bytes.size()));
+    CHECK(matches(BASE + PAGE - 8, bytes));
+}
+
+TEST_CASE(cached_backend_read_spanning_cache) {
+    FakeSource source{};
+    CachedBackend backend{std::ref(source), 4, 8};
+
+    // Three pages and four slots, readahead only gets the one left over
+    std::vector<uint8_t> bytes(PAGE * 3);
+    CHECK(backend.read(BASE, bytes.data(), bytes.size()));
+    CHECK(matches(BASE, bytes));
+    CHECK(source.calls == 1);
+
+    // Fourth page came in with it
+    CHECK(backend.read(BASE + PAGE * 3, bytes.data(), 16));
+    CHECK(source.calls == 1);
+
+    // Pages from the last read get evicted, never the ones this one needs
+    CHECK(backend.read(BASE + PAGE * 10, bytes.data(), bytes.size()));
+    CHECK(matches(BASE + PAGE * 10, bytes));
+}
+
+TEST_CASE(cached_backend_hole_in_run) {
+    FakeSource source{};
+    source.holes = {BASE / PAGE + 37};
+
+    CachedBackend backend{std::ref(source)};
+
+    const MemoryRange range{BASE, PAGE * 64};
+    backend.prefetch({&range, 1});
+
+    // One for the run, then halving down to the hole, not a read per page
+    CHECK(source.calls <= 1 + 2 * 7);
+
+    const auto calls = source.calls;
+    std::vector<uint8_t> bytes(16);
+
+    for (size_t page = 0; page < 64; ++page) {
+        const auto ok = backend.read(BASE + page * PAGE, bytes.data(), bytes.size());
+        CHECK(ok == (page != 37));
+    }
+
+    // Both the mapped pages and the hole are remembered
+    CHECK(source.calls == calls);
+}
+
+TEST_CASE(cached_backend_prefetch_merges_ranges) {
+    FakeSource source{};
+    CachedBackend backend{std::ref(source)};
+
+    const std::vector<MemoryRange> ranges{
+        {BASE + PAGE * 2, 8},
+        {BASE, PAGE},
+        {BASE + PAGE + 8, 16},
+        {BASE + PAGE * 10, 8},
+    };
+
+    backend.prefetch(ranges);
+
+    // 0-2 touch, 10 is on its own
+    CHECK(source.calls == 2);
+    CHECK(backend.get_stats().pages_fetched == 4);
+}
@@ -0,0 +1,302 @@
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <sdk/common/MemoryRegionMap.hpp>
+
+#include "Test.hpp"
+
+using namespace sdk::common;
+using namespace std::chrono_literals;
+
+namespace {
+// Regions the test hands out, shared with the test so it can change them under the map
+struct FakeMemory {
+    std::vector<MemoryRegion> regions{};
+    size_t snapshots{0};
+    size_t queries{0};
+};
+
+class FakeProvider : public MemoryRegionProvider {
+public:
+    FakeProvider(std::shared_ptr<FakeMemory> memory)
+        : m_memory{std::move(memory)}
+    {
+    }
+
+    std::vector<MemoryRegion> snapshot() override {
+        ++m_memory->snapshots;
+        return m_memory->regions;
+    }
+
+    std::optional<MemoryRegion> query(uintptr_t address) override {
+        ++m_memory->queries;
+
+        for (const auto& region : m_memory->regions) {
+            if (region.contains(address)) {
+                return region;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    std::shared_ptr<FakeMemory> m_memory{};
+};
+
+#ifdef __linux__
+// The real thing on Linux, what VirtualQuery is on Windows
+class ProcMapsProvider : public MemoryRegionProvider {
+public:
+    std::vector<MemoryRegion> snapshot() override {
+        std::vector<MemoryRegion> result{};
+        std::ifstream maps{"/proc/self/maps"};
+        std::string line{};
+
+        while (std::getline(maps, line)) {
+            uintptr_t start{};
+            uintptr_t end{};
+            char dash{};
+            std::string perms{};
+
+            std::istringstream stream{line};
+            stream >> std::hex >> start >> dash >> end >> perms;
+
+            if (!stream || end <= start) {
+                continue;
+            }
+
+            result.push_back(MemoryRegion{start, end - start, !perms.empty() && perms[0] == 'r'});
+        }
+
+        return result;
+    }
+
+    std::optional<MemoryRegion> query(uintptr_t address) override {
+        for (const auto& region : snapshot()) {
+            if (region.contains(address)) {
+                return region;
+            }
+        }
+
+        return std::nullopt;
+    }
+};
+#endif
+
+constexpr uintptr_t BASE = 0x100000;
+}
+
+TEST_CASE(memory_region_map_reads_within_and_across_regions) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {
+        {BASE, 0x1000, true},
+        {BASE + 0x1000, 0x2000, true},
+        {BASE + 0x3000, 0x1000, false},
+    };
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 1h};
+
+    CHECK(map.is_readable(BASE, 8));
+    CHECK(map.is_readable(BASE + 0xFF8, 0x10)); // straddles the first two
+    CHECK(map.is_readable(BASE, 0x3000));
+    CHECK(!map.is_readable(BASE + 0x2FF8, 0x10)); // runs into the unreadable one
+    CHECK(!map.is_readable(BASE + 0x3000, 1));
+    CHECK(map.is_readable(BASE + 0x10, 0)); // same as 1 byte
+
+    CHECK(memory->snapshots == 1);
+    CHECK(memory->queries == 0);
+    CHECK(map.size() == 3);
+}
+
+TEST_CASE(memory_region_map_rejects_junk_without_asking) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 1h};
+
+    CHECK(!map.is_readable((uintptr_t)0, 8));
+    CHECK(!map.is_readable((uintptr_t)0x1234, 8));
+    CHECK(!map.is_readable((uintptr_t)0xFFFF800000000000, 8));
+    CHECK(!map.is_readable((uintptr_t)0x7FFFFFFFFFF0, 0x100)); // wraps past the top
+
+    CHECK(memory->snapshots == 0);
+    CHECK(memory->queries == 0);
+}
+
+TEST_CASE(memory_region_map_remembers_unreadable_regions) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 1h};
+    CHECK(map.is_readable(BASE, 8));
+
+    // Shows up after the snapshot, the first miss asks and the rest don't
+    memory->regions.push_back({BASE + 0x10000, 0x1000, false});
+
+    for (size_t i = 0; i < 100; ++i) {
+        CHECK(!map.is_readable(BASE + 0x10000 + i * 8, 8));
+    }
+
+    CHECK(memory->queries == 1);
+}
+
+TEST_CASE(memory_region_map_picks_up_new_regions) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 1h};
+    CHECK(map.is_readable(BASE, 8));
+
+    // Nothing known there yet, so it doesn't wait for max_age
+    memory->regions.push_back({BASE + 0x5000, 0x1000, true});
+
+    CHECK(map.is_readable(BASE + 0x5000, 8));
+    CHECK(map.is_readable(BASE + 0x5100, 8));
+    CHECK(memory->queries == 1);
+
+    // Nothing there at all isn't remembered, there's no size to remember it by
+    CHECK(!map.is_readable(BASE + 0x9000, 8));
+    CHECK(!map.is_readable(BASE + 0x9000, 8));
+    CHECK(memory->queries == 3);
+}
+
+TEST_CASE(memory_region_map_rechecks_stale_regions) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}, {BASE + 0x1000, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 20ms};
+    CHECK(map.is_readable(BASE + 0x1000, 8));
+
+    // Freed, the map still goes by what it knew until that's too old
+    memory->regions[1].readable = false;
+    CHECK(map.is_readable(BASE + 0x1000, 8));
+    CHECK(memory->queries == 0);
+
+    std::this_thread::sleep_for(40ms);
+
+    CHECK(!map.is_readable(BASE + 0x1000, 8));
+    CHECK(memory->queries == 1);
+
+    // And that answer is fresh again
+    CHECK(!map.is_readable(BASE + 0x1000, 8));
+    CHECK(memory->queries == 1);
+
+    // The other one didn't change, asking again just confirms it
+    CHECK(map.is_readable(BASE, 8));
+    CHECK(memory->queries == 2);
+}
+
+TEST_CASE(memory_region_map_query_replaces_overlapping_entries) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}, {BASE + 0x1000, 0x1000, false}, {BASE + 0x2000, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 20ms};
+    CHECK(map.size() == 0);
+    CHECK(map.is_readable(BASE, 8));
+    CHECK(map.size() == 3);
+
+    // Merged into one big readable region
+    memory->regions = {{BASE, 0x3000, true}};
+    std::this_thread::sleep_for(40ms);
+
+    CHECK(map.is_readable(BASE, 0x3000));
+    CHECK(map.size() == 1);
+}
+
+TEST_CASE(memory_region_map_invalidate_retakes_snapshot) {
+    auto memory = std::make_shared<FakeMemory>();
+    memory->regions = {{BASE, 0x1000, true}};
+
+    MemoryRegionMap map{std::make_unique<FakeProvider>(memory), 1h};
+    CHECK(map.is_readable(BASE, 8));
+
+    memory->regions = {{BASE, 0x1000, false}};
+    CHECK(map.is_readable(BASE, 8));
+
+    map.invalidate();
+    CHECK(!map.is_readable(BASE, 8));
+    CHECK(memory->snapshots == 2);
+}
+
+#ifdef __linux__
+TEST_CASE(memory_region_map_proc_self_maps) {
+    MemoryRegionMap map{std::make_unique<ProcMapsProvider>(), 0ms};
+
+    const auto page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const auto page = mmap(nullptr, page_size * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(page != MAP_FAILED);
+
+    const auto address = (uintptr_t)page;
+    const int local = 0;
+
+    CHECK(map.is_readable(&local, sizeof(local)));
+    CHECK(map.is_readable(address, page_size * 2));
+
+    mprotect((void*)(address + page_size), page_size, PROT_NONE);
+    CHECK(map.is_readable(address, page_size));
+    CHECK(!map.is_readable(address, page_size * 2));
+
+    munmap(page, page_size * 2);
+    CHECK(!map.is_readable(address, 8));
+}
+#endif
+
+TEST_CASE(memory_region_map_concurrent_lookups) {
+    auto memory = std::make_shared<FakeMemory>();
+
+    for (size_t i = 0; i < 64; ++i) {
+        memory->regions.push_back({BASE + i * 0x2000, 0x1000, true});
+    }
+
+    // Provider isn't thread safe on its own, the counters are the only thing racing though
+    class LockedProvider : public FakeProvider {
+    public:
+        using FakeProvider::FakeProvider;
+
+        std::vector<MemoryRegion> snapshot() override {
+            std::scoped_lock _{m_mutex};
+            return FakeProvider::snapshot();
+        }
+
+        std::optional<MemoryRegion> query(uintptr_t address) override {
+            std::scoped_lock _{m_mutex};
+            return FakeProvider::query(address);
+        }
+
+    private:
+        std::mutex m_mutex{};
+    };
+
+    MemoryRegionMap map{std::make_unique<LockedProvider>(memory), 0ms};
+    std::atomic<size_t> wrong{0};
+    std::vector<std::thread> threads{};
+
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (size_t i = 0; i < 2000; ++i) {
+                const auto region = (i + t) % 64;
+                const auto address = BASE + region * 0x2000;
+
+                if (!map.is_readable(address + 8, 8) || map.is_readable(address + 0x1000, 8)) {
+                    ++wrong;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(wrong == 0);
+}
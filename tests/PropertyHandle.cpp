@@ -0,0 +1,125 @@
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include <sdk/PropertyHandle.hpp>
+
+#include "Test.hpp"
+
+using namespace sdk;
+
+namespace {
+// Offset and mask the way find_property would have resolved them
+template<typename T>
+struct FixedHandle : PropertyHandle<T> {
+    FixedHandle(int32_t offset, uint8_t byte_offset = 0, uint8_t byte_mask = 0) {
+        this->m_offset = offset;
+        this->m_byte_offset = byte_offset;
+        this->m_byte_mask = byte_mask;
+    }
+};
+
+struct Objects {
+    std::vector<std::unique_ptr<uint8_t[]>> storage{};
+    std::vector<UObject*> objects{};
+
+    Objects(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            storage.push_back(std::make_unique<uint8_t[]>(0x100));
+            objects.push_back((UObject*)storage.back().get());
+        }
+    }
+};
+}
+
+TEST_CASE(property_handle_default_is_invalid) {
+    const PropertyHandle<float> handle{};
+    CHECK(!handle.is_valid());
+    CHECK(!handle);
+    CHECK(handle.get_byte_mask() == 0);
+}
+
+TEST_CASE(property_handle_gather_and_scatter) {
+    Objects o{64};
+    const FixedHandle<float> handle{0x24};
+
+    for (size_t i = 0; i < o.objects.size(); ++i) {
+        handle.write(o.objects[i], (float)i * 1.5f);
+    }
+
+    std::vector<float> out(o.objects.size());
+    handle.read(o.objects, out);
+
+    for (size_t i = 0; i < out.size(); ++i) {
+        CHECK(out[i] == (float)i * 1.5f);
+        CHECK(handle.get(o.objects[i]) == out[i]);
+    }
+
+    // Shorter output just gets fewer
+    std::vector<float> few(3);
+    handle.read(o.objects, few);
+    CHECK(few[2] == 3.0f);
+
+    handle.write(o.objects, 42.0f);
+    handle.read(o.objects, out);
+    CHECK(std::ranges::all_of(out, [](float v) { return v == 42.0f; }));
+
+    std::vector<float> values(o.objects.size(), -1.0f);
+    handle.write(o.objects, std::span<const float>{values});
+    CHECK(handle.read(o.objects[63]) == -1.0f);
+}
+
+TEST_CASE(property_handle_bitfield_bool) {
+    Objects o{16};
+
+    // uint32 bFoo : 1 style, the bit lives in the second byte of the field
+    const FixedHandle<bool> handle{0x40, 1, 0x08};
+
+    for (size_t i = 0; i < o.objects.size(); ++i) {
+        auto bytes = (uint8_t*)o.objects[i];
+        bytes[0x40] = 0xFF;
+        bytes[0x41] = 0xF7; // everything but our bit
+        bytes[0x42] = 0xFF;
+    }
+
+    CHECK(!handle.read(o.objects[0]));
+
+    handle.write(o.objects[0], true);
+    CHECK(handle.read(o.objects[0]));
+
+    // Neighbouring bits and bytes are left alone
+    const auto bytes = (uint8_t*)o.objects[0];
+    CHECK(bytes[0x40] == 0xFF);
+    CHECK(bytes[0x41] == 0xFF);
+    CHECK(bytes[0x42] == 0xFF);
+
+    handle.write(o.objects[0], false);
+    CHECK(bytes[0x41] == 0xF7);
+
+    std::vector<uint8_t> set(o.objects.size());
+
+    for (size_t i = 0; i < set.size(); ++i) {
+        set[i] = i % 3 == 0;
+    }
+
+    handle.write(o.objects, std::span{(const bool*)set.data(), set.size()});
+
+    auto out = std::make_unique<bool[]>(o.objects.size());
+    handle.read(o.objects, std::span{out.get(), o.objects.size()});
+
+    for (size_t i = 0; i < set.size(); ++i) {
+        CHECK(out[i] == (i % 3 == 0));
+    }
+}
+
+TEST_CASE(property_handle_plain_bool) {
+    Objects o{4};
+    const FixedHandle<bool> handle{0x10};
+
+    handle.write(o.objects[1], true);
+    CHECK(((uint8_t*)o.objects[1])[0x10] == 1);
+    CHECK(handle.read(o.objects[1]));
+
+    handle.write(o.objects[1], false);
+    CHECK(!handle.read(o.objects[1]));
+}
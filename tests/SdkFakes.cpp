@@ -0,0 +1,34 @@
+// Stand-ins for the SDK functions the sources in SdkSources.cpp call into but that live in
+// translation units the tests can't build (they need a running game). Just enough for the fixtures
+#include <sdk/UObject.hpp>
+#include <sdk/UFunction.hpp>
+#include <sdk/UObjectArray.hpp>
+
+#include "SdkFakes.hpp"
+
+namespace sdk {
+// Resolving goes through a NameResolver in the tests
+std::optional<FNameCasePreserving> FName::find(std::wstring_view) {
+    return std::nullopt;
+}
+
+bool UObjectBase::full_name_equals(std::wstring_view full_name) const {
+    const auto& names = test::get_fake_full_names();
+    const auto it = names.find(this);
+
+    return it != names.end() && it->second == full_name;
+}
+
+// The fixtures don't have class hierarchies, a class is only ever itself
+bool UObject::is_a(UClass* cmp) const {
+    return get_class() == cmp;
+}
+
+FUObjectArray* FUObjectArray::get() {
+    return test::get_fake_object_array();
+}
+
+UClass* UFunction::static_class() {
+    return nullptr;
+}
+}
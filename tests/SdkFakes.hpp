@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace sdk {
+struct FUObjectArray;
+class UObjectBase;
+}
+
+namespace test {
+// What FUObjectArray::get() hands out in the tests, whoever builds a fixture sets it
+inline sdk::FUObjectArray*& get_fake_object_array() {
+    static sdk::FUObjectArray* objects{nullptr};
+    return objects;
+}
+
+// What UObjectBase::full_name_equals compares against, there's no name pool to build them from
+inline std::unordered_map<const sdk::UObjectBase*, std::wstring>& get_fake_full_names() {
+    static std::unordered_map<const sdk::UObjectBase*, std::wstring> names{};
+    return names;
+}
+}
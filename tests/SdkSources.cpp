@@ -0,0 +1,5 @@
+// The SDK sources the tests need. Pulled in here instead of listed in cmake.toml,
+// they're outside this directory and the uesdk target itself only builds with MSVC
+#include <sdk/UObjectArrayReader.cpp>
+#include <sdk/UObjectScan.cpp>
+#include <sdk/UObjectNameIndex.cpp>
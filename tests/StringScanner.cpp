@@ -0,0 +1,158 @@
+#include <tuple>
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+#include <sdk/common/StringScanner.hpp>
+
+#include "Test.hpp"
+
+using sdk::common::StringScanner;
+
+namespace {
+// What one needle at a time used to find, the scanner has to agree with it
+std::vector<std::pair<size_t, size_t>> naive_scan(const std::vector<std::string>& needles, std::span<const uint8_t> data) {
+    std::vector<std::pair<size_t, size_t>> result{};
+
+    for (size_t offset = 0; offset < data.size(); ++offset) {
+        for (size_t id = 0; id < needles.size(); ++id) {
+            const auto& needle = needles[id];
+
+            if (needle.size() <= data.size() - offset && memcmp(data.data() + offset, needle.data(), needle.size()) == 0) {
+                result.emplace_back(id, offset);
+            }
+        }
+    }
+
+    return result;
+}
+
+// A few .rdata-ish sections: random bytes with some of the needles planted in them, some right at the edges
+std::vector<std::vector<uint8_t>> make_sections(const std::vector<std::string>& needles, uint32_t seed) {
+    std::mt19937 rng{seed};
+    std::vector<std::vector<uint8_t>> sections{};
+
+    for (const auto size : {0x10000, 0x3000, 0x801}) {
+        std::vector<uint8_t> section(size);
+
+        // Mostly ASCII and zeroes like real string tables, so prefixes collide now and then
+        for (auto& b : section) {
+            b = rng() % 4 == 0 ? 0 : (uint8_t)(0x20 + rng() % 0x5F);
+        }
+
+        for (size_t i = 0; i < 40; ++i) {
+            const auto& needle = needles[rng() % needles.size()];
+            const auto offset = rng() % (section.size() - needle.size());
+            memcpy(section.data() + offset, needle.data(), needle.size());
+        }
+
+        const auto& last = needles[rng() % needles.size()];
+        memcpy(section.data() + section.size() - last.size(), last.data(), last.size());
+        memcpy(section.data(), needles[0].data(), needles[0].size());
+
+        sections.push_back(std::move(section));
+    }
+
+    return sections;
+}
+
+std::vector<std::string> sdk_needles() {
+    std::vector<std::string> result{};
+
+    for (const auto str : {L"FTagMetaData", L"FNavigationMetaData", L"/Temp/%s", L"r.OneFrameThreadLag", L"++UE", L"++ue", L"SceneDepthZ"}) {
+        result.push_back(StringScanner::to_bytes(std::wstring_view{str}));
+    }
+
+    for (const auto str : {"FTagMetaData", "r.DumpingMovie", "AnimGraphRuntime", "Bone"}) {
+        result.push_back(StringScanner::to_bytes(std::string_view{str}));
+    }
+
+    return result;
+}
+}
+
+TEST_CASE(string_scanner_rejects_short_needles) {
+    StringScanner scanner{};
+
+    CHECK(!scanner.add("abc").has_value());
+    CHECK(scanner.add("abcd") == 0);
+    CHECK(scanner.add(StringScanner::to_bytes(std::wstring_view{L"ab"})) == 1); // 4 bytes as UTF-16
+    CHECK(scanner.size() == 2);
+}
+
+TEST_CASE(string_scanner_utf16_bytes) {
+    const auto bytes = StringScanner::to_bytes(std::wstring_view{L"Aé中"});
+    CHECK(bytes == std::string("A\0\xe9\0\x2d\x4e", 6));
+}
+
+TEST_CASE(string_scanner_overlapping_and_shared_prefixes) {
+    StringScanner scanner{};
+    const std::vector<std::string> needles{"aaaa", "aaaaa", "aaab", "FTagMetaData", "FTagMeta"};
+
+    for (const auto& needle : needles) {
+        scanner.add(needle);
+    }
+
+    const std::string text = "xxaaaaabxxFTagMetaDataFTagMeta";
+    const std::span data{(const uint8_t*)text.data(), text.size()};
+
+    std::vector<std::pair<size_t, size_t>> matches{};
+    scanner.scan(data, [&](size_t id, size_t offset) { matches.emplace_back(id, offset); });
+
+    std::vector<std::pair<size_t, size_t>> expected = naive_scan(needles, data);
+
+    // Same set, offsets in order, ids within an offset in whatever order the bucket has them
+    CHECK(std::is_sorted(matches.begin(), matches.end(), [](const auto& a, const auto& b) { return a.second < b.second; }));
+    std::sort(matches.begin(), matches.end(), [](const auto& a, const auto& b) { return std::tie(a.second, a.first) < std::tie(b.second, b.first); });
+    std::sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) { return std::tie(a.second, a.first) < std::tie(b.second, b.first); });
+    CHECK(matches == expected);
+    CHECK(matches.size() == 7);
+}
+
+TEST_CASE(string_scanner_synthetic_sections) {
+    const auto needles = sdk_needles();
+
+    StringScanner scanner{};
+
+    for (const auto& needle : needles) {
+        REQUIRE(scanner.add(needle).has_value());
+    }
+
+    for (uint32_t seed = 1; seed <= 5; ++seed) {
+        for (const auto& section : make_sections(needles, seed)) {
+            std::vector<std::pair<size_t, size_t>> matches{};
+            scanner.scan(section, [&](size_t id, size_t offset) { matches.emplace_back(id, offset); });
+
+            auto expected = naive_scan(needles, section);
+
+            const auto by_offset = [](const auto& a, const auto& b) { return std::tie(a.second, a.first) < std::tie(b.second, b.first); };
+            std::sort(matches.begin(), matches.end(), by_offset);
+            std::sort(expected.begin(), expected.end(), by_offset);
+
+            CHECK(!expected.empty());
+            CHECK(matches == expected);
+        }
+    }
+}
+
+TEST_CASE(string_scanner_tiny_and_empty_input) {
+    StringScanner scanner{};
+    scanner.add("abcd");
+
+    size_t calls = 0;
+    const auto count = [&](size_t, size_t) { ++calls; };
+
+    scanner.scan({}, count);
+    scanner.scan(std::span{(const uint8_t*)"abc", 3}, count);
+    CHECK(calls == 0);
+
+    scanner.scan(std::span{(const uint8_t*)"abcd", 4}, count);
+    CHECK(calls == 1);
+
+    // Nothing added, nothing found
+    StringScanner empty{};
+    empty.scan(std::span{(const uint8_t*)"abcd", 4}, count);
+    CHECK(calls == 1);
+}
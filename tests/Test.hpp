@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <string_view>
+
+// Just enough of a test framework to not need one.
+// TEST_CASE registers itself, CHECK keeps going after a failure, REQUIRE stops the case.
+namespace test {
+struct Case {
+    std::string_view name{};
+    void (*fn)(){nullptr};
+};
+
+struct RequireFailed {};
+
+inline std::vector<Case>& get_cases() {
+    static std::vector<Case> cases{};
+    return cases;
+}
+
+inline size_t& get_failures() {
+    static size_t failures{0};
+    return failures;
+}
+
+inline void fail(const char* file, int line, const char* expr) {
+    std::fprintf(stderr, "    %s:%d: failed: %s\n", file, line, expr);
+    ++get_failures();
+}
+
+struct Registrar {
+    Registrar(std::string_view name, void (*fn)()) {
+        get_cases().push_back(Case{name, fn});
+    }
+};
+}
+
+#define TEST_CASE(name) \
+    static void name(); \
+    static test::Registrar name##_registrar{#name, name}; \
+    static void name()
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            test::fail(__FILE__, __LINE__, #expr); \
+        } \
+    } while (0)
+
+#define REQUIRE(expr) \
+    do { \
+        if (!(expr)) { \
+            test::fail(__FILE__, __LINE__, #expr); \
+            throw test::RequireFailed{}; \
+        } \
+    } while (0)
@@ -0,0 +1,192 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <sdk/threading/ThreadWorker.hpp>
+
+#include "Test.hpp"
+
+TEST_CASE(thread_worker_runs_in_submission_order) {
+    ThreadWorker<> worker{};
+    std::vector<int> order{};
+
+    for (int i = 0; i < 100; ++i) {
+        worker.enqueue([&, i] { order.push_back(i); });
+    }
+
+    worker.execute();
+
+    REQUIRE(order.size() == 100);
+
+    for (int i = 0; i < 100; ++i) {
+        CHECK(order[i] == i);
+    }
+
+    const auto stats = worker.get_stats();
+    CHECK(stats.enqueued == 100);
+    CHECK(stats.executed == 100);
+    CHECK(stats.depth == 0);
+    CHECK(stats.max_depth == 100);
+    CHECK(stats.latency.count == 100);
+    CHECK(stats.drain.count == 1);
+}
+
+TEST_CASE(thread_worker_passes_arguments) {
+    ThreadWorker<int, int&> worker{};
+    int total = 0;
+
+    worker.enqueue([](int value, int& out) { out += value; });
+    worker.enqueue([](int value, int& out) { out += value * 10; });
+    worker.execute(3, std::ref(total));
+
+    CHECK(total == 33);
+}
+
+TEST_CASE(thread_worker_enqueue_from_callback_runs_next_time) {
+    ThreadWorker<> worker{};
+    int runs = 0;
+
+    worker.enqueue([&] {
+        ++runs;
+        worker.enqueue([&] { ++runs; });
+
+        // Already draining, does nothing
+        worker.execute();
+    });
+
+    worker.execute();
+    CHECK(runs == 1);
+
+    worker.execute();
+    CHECK(runs == 2);
+}
+
+TEST_CASE(thread_worker_throwing_callback_keeps_the_rest) {
+    ThreadWorker<> worker{};
+    std::vector<int> order{};
+
+    worker.enqueue([&] { order.push_back(0); });
+    worker.enqueue([&] { throw std::runtime_error{"oops"}; });
+    worker.enqueue([&] { order.push_back(2); });
+
+    bool threw = false;
+
+    try {
+        worker.execute();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+
+    CHECK(threw);
+    CHECK(order == std::vector<int>{0});
+
+    // The ones after it are still there, ahead of anything newer
+    worker.enqueue([&] { order.push_back(3); });
+    worker.execute();
+
+    CHECK((order == std::vector<int>{0, 2, 3}));
+}
+
+TEST_CASE(thread_worker_destroys_captures_after_running) {
+    ThreadWorker<> worker{};
+    auto shared = std::make_shared<int>(0);
+
+    worker.enqueue([shared] { ++*shared; });
+    CHECK(shared.use_count() == 2);
+
+    worker.execute();
+
+    // Node went back to the free list, what it captured didn't go with it
+    CHECK(*shared == 1);
+    CHECK(shared.use_count() == 1);
+
+    // And whatever's still pending gets destroyed with the worker
+    {
+        ThreadWorker<> other{};
+        other.enqueue([shared] {});
+        CHECK(shared.use_count() == 2);
+    }
+
+    CHECK(shared.use_count() == 1);
+}
+
+TEST_CASE(thread_worker_thread_id_is_the_drainer) {
+    ThreadWorker<> worker{};
+    std::atomic<bool> inside{false};
+    std::atomic<bool> release{false};
+
+    worker.enqueue([&] {
+        inside = true;
+
+        while (!release) {
+            std::this_thread::yield();
+        }
+    });
+
+    std::thread drainer{[&] { worker.execute(); }};
+
+    while (!inside) {
+        std::this_thread::yield();
+    }
+
+    const auto drainer_id = drainer.get_id();
+
+    // Bounces off the drain in progress and doesn't get to claim the thread
+    worker.execute();
+    CHECK(worker.get_thread_id() == drainer_id);
+    CHECK(!worker.is_same_thread());
+
+    release = true;
+    drainer.join();
+
+    // Nothing queued still counts, that's what a frame with no work looks like
+    worker.execute();
+    CHECK(worker.is_same_thread());
+}
+
+TEST_CASE(thread_worker_many_producers) {
+    ThreadWorker<> worker{};
+
+    constexpr size_t PRODUCERS = 4;
+    constexpr size_t PER_PRODUCER = 20000;
+
+    std::atomic<size_t> done_producing{0};
+    std::vector<size_t> last_seen(PRODUCERS, 0);
+    size_t out_of_order = 0;
+    size_t executed = 0;
+
+    std::vector<std::thread> producers{};
+
+    for (size_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (size_t i = 1; i <= PER_PRODUCER; ++i) {
+                worker.enqueue([&, p, i] {
+                    // Each producer's items still come out in the order it pushed them
+                    if (last_seen[p] + 1 != i) {
+                        ++out_of_order;
+                    }
+
+                    last_seen[p] = i;
+                    ++executed;
+                });
+            }
+
+            ++done_producing;
+        });
+    }
+
+    while (done_producing < PRODUCERS) {
+        worker.execute();
+    }
+
+    worker.execute();
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    CHECK(executed == PRODUCERS * PER_PRODUCER);
+    CHECK(out_of_order == 0);
+    CHECK(worker.get_stats().depth == 0);
+}
@@ -0,0 +1,280 @@
+#include <map>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <iterator>
+#include <filesystem>
+
+#include <sdk/UObjectArrayReader.hpp>
+
+#include "Test.hpp"
+
+using namespace sdk;
+using namespace sdk::common;
+
+namespace {
+// Builds a made up address space one write at a time, then lays it out as ImageBackend segments
+class SyntheticImage {
+public:
+    template<typename T>
+    void write(uintptr_t address, const T& value) {
+        write_bytes(address, &value, sizeof(T));
+    }
+
+    void write_bytes(uintptr_t address, const void* data, size_t size) {
+        auto& segment = m_segments[address & ~(uintptr_t)0xFFFF];
+        segment.resize(0x10000);
+        memcpy(segment.data() + (address & 0xFFFF), data, size);
+    }
+
+    // Segments back to back in one buffer, like a dump
+    std::pair<std::vector<uint8_t>, std::vector<ImageBackend::Segment>> build() const {
+        std::vector<uint8_t> data{};
+        std::vector<ImageBackend::Segment> segments{};
+
+        for (const auto& [address, bytes] : m_segments) {
+            segments.push_back({address, bytes.size(), data.size()});
+            data.insert(data.end(), bytes.begin(), bytes.end());
+        }
+
+        return {std::move(data), std::move(segments)};
+    }
+
+private:
+    std::map<uintptr_t, std::vector<uint8_t>> m_segments{};
+};
+
+constexpr uintptr_t ARRAY = 0x10000000;
+constexpr uintptr_t CHUNK_TABLE = 0x20000000;
+constexpr uintptr_t CHUNKS = 0x30000000;
+
+uintptr_t object_at(size_t index) {
+    return 0x7F0000000000 + index * 0x100;
+}
+
+// Chunked GUObjectArray the way 4.11+ lays it out, with every 7th slot empty
+SyntheticImage make_chunked(const FUObjectArrayReader::Layout& layout, int32_t count) {
+    SyntheticImage image{};
+    const auto objects = ARRAY + layout.objects_offset;
+    const auto num_chunks = (count + layout.objects_per_chunk - 1) / layout.objects_per_chunk;
+
+    image.write<uintptr_t>(objects, CHUNK_TABLE);
+    image.write<int32_t>(objects + 8 + 8 + 4, count);
+
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        image.write<uintptr_t>(CHUNK_TABLE + chunk * 8, CHUNKS + chunk * 0x10000);
+    }
+
+    for (int32_t i = 0; i < count; ++i) {
+        const auto chunk = i / layout.objects_per_chunk;
+        const auto item = CHUNKS + chunk * 0x10000 + (i % layout.objects_per_chunk) * layout.item_distance;
+
+        image.write<uintptr_t>(item, i % 7 == 3 ? 0 : object_at(i));
+        image.write<int32_t>(item + 8, 0x1234); // flags, shouldn't matter
+    }
+
+    return image;
+}
+
+std::vector<uintptr_t> expected_objects(int32_t count) {
+    std::vector<uintptr_t> result{};
+
+    for (int32_t i = 0; i < count; ++i) {
+        if (i % 7 != 3) {
+            result.push_back(object_at(i));
+        }
+    }
+
+    return result;
+}
+}
+
+TEST_CASE(uobject_array_reader_chunked) {
+    FUObjectArrayReader::Layout layout{};
+    layout.objects_per_chunk = 64; // so a few hundred objects span several chunks
+
+    const auto image = make_chunked(layout, 300);
+    const auto [data, segments] = image.build();
+    ImageBackend backend{data, segments};
+
+    FUObjectArrayReader reader{backend, ARRAY, layout};
+
+    CHECK(reader.get_object_count() == 300);
+    CHECK(reader.get_objects() == expected_objects(300));
+    CHECK(reader.get_failed_chunks() == 0);
+}
+
+TEST_CASE(uobject_array_reader_layout_offsets) {
+    // Something other than the defaults, a reader still using FUObjectArray's statics would miss these
+    FUObjectArrayReader::Layout layout{};
+    layout.objects_offset = 0x28;
+    layout.item_distance = 0x20;
+    layout.objects_per_chunk = 16;
+
+    const auto image = make_chunked(layout, 50);
+    const auto [data, segments] = image.build();
+    ImageBackend backend{data, segments};
+
+    FUObjectArrayReader reader{backend, ARRAY, layout};
+
+    CHECK(reader.get_object_count() == 50);
+    CHECK(reader.get_objects() == expected_objects(50));
+}
+
+TEST_CASE(uobject_array_reader_flat_and_inlined) {
+    // Not chunked, one big run of items
+    {
+        FUObjectArrayReader::Layout layout{};
+        layout.chunked = false;
+
+        SyntheticImage image{};
+        image.write<uintptr_t>(ARRAY + layout.objects_offset, CHUNKS);
+        image.write<int32_t>(ARRAY + layout.objects_offset + 8, 20);
+
+        for (int32_t i = 0; i < 20; ++i) {
+            image.write<uintptr_t>(CHUNKS + i * layout.item_distance, i % 7 == 3 ? 0 : object_at(i));
+        }
+
+        const auto [data, segments] = image.build();
+        ImageBackend backend{data, segments};
+        FUObjectArrayReader reader{backend, ARRAY, layout};
+
+        CHECK(reader.get_objects() == expected_objects(20));
+    }
+
+    // <= 4.10, the chunk table sits in the array itself with the count after it
+    {
+        FUObjectArrayReader::Layout layout{};
+        layout.chunked = false;
+        layout.inlined = true;
+        layout.objects_per_chunk_inlined = 8;
+        layout.max_inlined_chunks = 4;
+
+        SyntheticImage image{};
+        const auto objects = ARRAY + layout.objects_offset;
+        image.write<int32_t>(objects + layout.max_inlined_chunks * 8, 30);
+
+        for (size_t chunk = 0; chunk < 4; ++chunk) {
+            image.write<uintptr_t>(objects + chunk * 8, CHUNKS + chunk * 0x10000);
+        }
+
+        for (int32_t i = 0; i < 30; ++i) {
+            image.write<uintptr_t>(CHUNKS + (i / 8) * 0x10000 + (i % 8) * layout.item_distance, i % 7 == 3 ? 0 : object_at(i));
+        }
+
+        const auto [data, segments] = image.build();
+        ImageBackend backend{data, segments};
+        FUObjectArrayReader reader{backend, ARRAY, layout};
+
+        CHECK(reader.get_object_count() == 30);
+        CHECK(reader.get_objects() == expected_objects(30));
+
+        // More chunks than the array has room for means the count is garbage
+        image.write<int32_t>(objects + layout.max_inlined_chunks * 8, 1000);
+        const auto [bad_data, bad_segments] = image.build();
+        ImageBackend bad_backend{bad_data, bad_segments};
+        FUObjectArrayReader bad_reader{bad_backend, ARRAY, layout};
+
+        CHECK(bad_reader.get_objects().empty());
+    }
+}
+
+TEST_CASE(uobject_array_reader_missing_chunk) {
+    FUObjectArrayReader::Layout layout{};
+    layout.objects_per_chunk = 64;
+
+    auto image = make_chunked(layout, 200);
+
+    // Second chunk points somewhere the image doesn't have
+    image.write<uintptr_t>(CHUNK_TABLE + 8, 0x40000000);
+
+    const auto [data, segments] = image.build();
+    ImageBackend backend{data, segments};
+    FUObjectArrayReader reader{backend, ARRAY, layout};
+
+    auto expected = expected_objects(200);
+    std::erase_if(expected, [](uintptr_t object) { return object >= object_at(64) && object < object_at(128); });
+
+    CHECK(reader.get_objects() == expected);
+    CHECK(reader.get_failed_chunks() == 1);
+}
+
+TEST_CASE(uobject_array_reader_from_file) {
+    FUObjectArrayReader::Layout layout{};
+    layout.objects_per_chunk = 128;
+
+    const auto image = make_chunked(layout, 1000);
+    const auto [data, segments] = image.build();
+
+    const auto path = std::filesystem::temp_directory_path() / "uesdk_tests_image.bin";
+
+    {
+        std::ofstream file{path, std::ios::binary};
+        file.write((const char*)data.data(), data.size());
+    }
+
+    std::ifstream file{path, std::ios::binary};
+    const std::vector<uint8_t> loaded{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    std::filesystem::remove(path);
+
+    REQUIRE(loaded.size() == data.size());
+
+    ImageBackend image_backend{loaded, segments};
+
+    // Reading from the "file" through the cache, the way a remote process would be read
+    CachedBackend backend{[&](uintptr_t address, void* out, size_t size) {
+        return image_backend.read(address, out, size);
+    }};
+
+    FUObjectArrayReader reader{backend, ARRAY, layout};
+    const auto objects = reader.get_objects();
+
+    CHECK(objects == expected_objects(1000));
+
+    // ClassPrivate-style reads off every object, none of which exist in the image
+    const auto pointers = reader.read_pointers(std::span{objects}.first(10), 0x10);
+    CHECK(pointers.size() == 10);
+    CHECK(std::ranges::all_of(pointers, [](const auto& p) { return !p.has_value(); }));
+
+    // Every chunk went in as part of one prefetch run, not a read per object
+    CHECK(backend.get_stats().source_reads < 30);
+}
+
+TEST_CASE(image_backend_from_minidump) {
+    // Header, one directory entry pointing at a Memory64ListStream with two ranges
+    std::vector<uint8_t> dump(0x200);
+
+    const auto put32 = [&](size_t offset, uint32_t value) { memcpy(dump.data() + offset, &value, sizeof(value)); };
+    const auto put64 = [&](size_t offset, uint64_t value) { memcpy(dump.data() + offset, &value, sizeof(value)); };
+
+    put32(0, 0x504D444D);
+    put32(8, 1);
+    put32(12, 0x20);
+
+    put32(0x20, 9);
+    put32(0x28, 0x40);
+
+    put64(0x40, 2);
+    put64(0x48, 0x100);
+    put64(0x50, 0x10000);
+    put64(0x58, 0x10);
+    put64(0x60, 0x10010);
+    put64(0x68, 0x20);
+
+    for (size_t i = 0; i < 0x30; ++i) {
+        dump[0x100 + i] = (uint8_t)i;
+    }
+
+    auto backend = ImageBackend::from_minidump(dump);
+    REQUIRE(backend.has_value());
+    CHECK(backend->get_segments().size() == 2);
+
+    // Straddles both ranges
+    uint8_t out[0x20]{};
+    CHECK(backend->read(0x10008, out, sizeof(out)));
+    CHECK(out[0] == 8 && out[0x1F] == 0x27);
+
+    CHECK(!backend->read(0x10028, out, sizeof(out)));
+    CHECK(!ImageBackend::from_minidump(std::span{dump}.first(8)).has_value());
+}
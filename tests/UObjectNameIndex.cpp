@@ -0,0 +1,272 @@
+#include <array>
+#include <deque>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <cwctype>
+#include <algorithm>
+#include <unordered_map>
+
+#include <sdk/UObject.hpp>
+#include <sdk/UObjectNameIndex.hpp>
+
+#include "Test.hpp"
+#include "SdkFakes.hpp"
+
+using namespace sdk;
+
+namespace {
+// Flat GUObjectArray plus a made up name pool. Like the real one, names that only differ in case
+// share a comparison index, and the fake full names keep the case they were created with
+class NameFixture {
+public:
+    NameFixture(int32_t capacity)
+        : m_items(capacity)
+    {
+        FUObjectArray::set_layout(false, false, sizeof(FUObjectItem));
+
+        const auto items = (void*)m_items.data();
+        memcpy(m_header.data() + FUObjectArray::get_objects_offset(), &items, sizeof(items));
+        set_count(0);
+
+        m_class_class = create(nullptr, L"Class", nullptr);
+    }
+
+    ~NameFixture() {
+        test::get_fake_full_names().clear();
+    }
+
+    FUObjectArray* get() {
+        return (FUObjectArray*)m_header.data();
+    }
+
+    UObjectNameIndex::NameResolver resolver() {
+        return [this](std::wstring_view name) -> std::optional<UObjectNameIndex::NameKey> {
+            const auto it = m_pool.find(fold(name));
+
+            // Not in the pool resolves to None, like FName's FNAME_Find does
+            return UObjectNameIndex::NameKey{it != m_pool.end() ? it->second : 0, 0};
+        };
+    }
+
+    // klass == nullptr makes a UClass
+    UObjectBase* create(UObjectBase* klass, std::wstring_view name, UObjectBase* outer) {
+        auto& memory = m_objects.emplace_back();
+        const auto object = (UObjectBase*)memory.data();
+
+        if (klass == nullptr) {
+            klass = m_class_class != nullptr ? m_class_class : object;
+        }
+
+        FName fname{};
+        fname.a1 = intern(name);
+
+        memcpy(memory.data() + UObjectBase::get_class_private_offset(), &klass, sizeof(klass));
+        memcpy(memory.data() + UObjectBase::get_fname_offset(), &fname, sizeof(fname));
+        memcpy(memory.data() + UObjectBase::get_outer_private_offset(), &outer, sizeof(outer));
+
+        m_names[object] = std::wstring{name};
+
+        // Same format get_full_name makes
+        std::wstring path{name};
+
+        for (auto o = outer; o != nullptr; o = o->get_outer()) {
+            path = m_names[o] + L"." + path;
+        }
+
+        test::get_fake_full_names()[object] = m_names[klass] + L" " + path;
+
+        return object;
+    }
+
+    void place(int32_t index, UObjectBase* object) {
+        m_items[index].object = object;
+        set_count(std::max(m_count, index + 1));
+    }
+
+private:
+    static std::wstring fold(std::wstring_view name) {
+        std::wstring result{name};
+
+        for (auto& c : result) {
+            c = (wchar_t)std::towlower(c);
+        }
+
+        return result;
+    }
+
+    int32_t intern(std::wstring_view name) {
+        const auto [it, inserted] = m_pool.try_emplace(fold(name), (int32_t)m_pool.size() + 1);
+        return it->second;
+    }
+
+    void set_count(int32_t count) {
+        m_count = count;
+        memcpy(m_header.data() + FUObjectArray::get_objects_offset() + 8, &count, sizeof(count));
+    }
+
+    std::array<uint8_t, 0x40> m_header{};
+    std::vector<FUObjectItem> m_items{};
+    std::deque<std::array<uint8_t, 0x40>> m_objects{};
+    std::unordered_map<UObjectBase*, std::wstring> m_names{};
+    std::unordered_map<std::wstring, int32_t> m_pool{};
+    UObjectBase* m_class_class{nullptr};
+    int32_t m_count{0};
+};
+}
+
+TEST_CASE(name_index_finds_objects) {
+    NameFixture fixture{64};
+
+    const auto package_c = fixture.create(nullptr, L"Package", nullptr);
+    const auto package = fixture.create(package_c, L"/Script/Engine", nullptr);
+    const auto actor_c = fixture.create(nullptr, L"Actor", package);
+    const auto actor = fixture.create(actor_c, L"Default__Actor", package);
+
+    fixture.place(0, package_c);
+    fixture.place(1, package);
+    fixture.place(2, actor_c);
+    fixture.place(5, actor);
+
+    UObjectNameIndex index{fixture.get(), fixture.resolver()};
+
+    CHECK(index.find(L"Class /Script/Engine.Actor") == actor_c);
+    CHECK(index.find(L"Package /Script/Engine") == package);
+    CHECK(index.find(L"Actor /Script/Engine.Default__Actor") == actor);
+
+    // Right names, wrong class or wrong outer
+    CHECK(index.find(L"Package /Script/Engine.Actor") == nullptr);
+    CHECK(index.find(L"Class /Script/Actor") == nullptr);
+
+    // Not in the name pool at all
+    CHECK(index.find(L"Class /Script/Engine.Pawn") == nullptr);
+
+    // Can't be parsed, the caller has to walk
+    CHECK(index.find(L"Actor") == std::nullopt);
+}
+
+TEST_CASE(name_index_is_case_sensitive) {
+    NameFixture fixture{16};
+
+    const auto package = fixture.create(fixture.create(nullptr, L"Package", nullptr), L"/Script/Engine", nullptr);
+    const auto actor_c = fixture.create(nullptr, L"Actor", package);
+
+    fixture.place(0, package);
+    fixture.place(1, actor_c);
+
+    UObjectNameIndex index{fixture.get(), fixture.resolver()};
+
+    // Resolves to the same comparison indices, but get_full_name() == name wouldn't have matched
+    CHECK(index.find(L"Class /Script/Engine.Actor") == actor_c);
+    CHECK(index.find(L"class /script/engine.actor") == nullptr);
+    CHECK(index.find(L"Class /Script/Engine.ACTOR") == nullptr);
+}
+
+TEST_CASE(name_index_lowest_index_wins) {
+    NameFixture fixture{128};
+
+    const auto package = fixture.create(fixture.create(nullptr, L"Package", nullptr), L"/Game/Map", nullptr);
+    const auto thing_c = fixture.create(nullptr, L"Thing", package);
+
+    fixture.place(0, package);
+    fixture.place(1, thing_c);
+
+    // Three objects with the same full name, showing up in an order that doesn't match their slots
+    const auto a = fixture.create(thing_c, L"Dup", package);
+    const auto b = fixture.create(thing_c, L"Dup", package);
+    const auto c = fixture.create(thing_c, L"Dup", package);
+
+    fixture.place(40, a);
+
+    UObjectNameIndex index{fixture.get(), fixture.resolver()};
+    CHECK(index.find(L"Thing /Game/Map.Dup") == a);
+
+    fixture.place(10, b);
+    index.refresh();
+    CHECK(index.find(L"Thing /Game/Map.Dup") == b);
+
+    fixture.place(100, c);
+    index.refresh();
+    CHECK(index.find(L"Thing /Game/Map.Dup") == b);
+
+    // Lowest one gone, next lowest takes over
+    fixture.place(10, nullptr);
+    index.refresh();
+    CHECK(index.find(L"Thing /Game/Map.Dup") == a);
+}
+
+TEST_CASE(name_index_picks_up_new_objects) {
+    NameFixture fixture{64};
+
+    const auto package = fixture.create(fixture.create(nullptr, L"Package", nullptr), L"/Game/Map", nullptr);
+    const auto thing_c = fixture.create(nullptr, L"Thing", package);
+
+    fixture.place(0, package);
+    fixture.place(1, thing_c);
+
+    UObjectNameIndex index{fixture.get(), fixture.resolver()};
+    CHECK(index.find(L"Thing /Game/Map.Late") == nullptr);
+
+    // The array grew, so the miss refreshes even though the last one was just now
+    fixture.place(20, fixture.create(thing_c, L"Late", package));
+    CHECK(index.find(L"Thing /Game/Map.Late") != nullptr);
+    CHECK(*index.find(L"Thing /Game/Map.Late") != nullptr);
+}
+
+TEST_CASE(name_index_concurrent_lookups) {
+    NameFixture fixture{20000};
+
+    const auto package = fixture.create(fixture.create(nullptr, L"Package", nullptr), L"/Game/Map", nullptr);
+    const auto thing_c = fixture.create(nullptr, L"Thing", package);
+
+    fixture.place(0, package);
+    fixture.place(1, thing_c);
+
+    for (int32_t i = 2; i < 20000; ++i) {
+        fixture.place(i, fixture.create(thing_c, L"Thing_" + std::to_wstring(i), package));
+    }
+
+    const auto target = fixture.create(thing_c, L"Target", package);
+    fixture.place(19999, target);
+
+    // The resolver isn't thread safe, resolve everything up front
+    const auto resolver = fixture.resolver();
+    std::unordered_map<std::wstring, UObjectNameIndex::NameKey> resolved{};
+
+    for (const auto name : {L"Thing", L"/Game/Map", L"Target"}) {
+        resolved[name] = *resolver(name);
+    }
+
+    UObjectNameIndex index{fixture.get(), [&](std::wstring_view name) -> std::optional<UObjectNameIndex::NameKey> {
+        return resolved.at(std::wstring{name});
+    }};
+
+    // While one thread builds, the others get told to walk instead of waiting. Nobody gets a wrong answer
+    std::atomic<size_t> wrong{0};
+    std::atomic<size_t> answered{0};
+    std::vector<std::jthread> threads{};
+
+    for (auto t = 0; t < 4; ++t) {
+        threads.emplace_back([&] {
+            for (auto i = 0; i < 200; ++i) {
+                const auto result = index.find(L"Thing /Game/Map.Target");
+
+                if (result.has_value()) {
+                    answered.fetch_add(1);
+                    wrong.fetch_add(*result != target);
+                }
+
+                if (i % 50 == 0) {
+                    index.refresh();
+                }
+            }
+        });
+    }
+
+    threads.clear();
+
+    CHECK(wrong == 0);
+    CHECK(answered > 0);
+    CHECK(index.find(L"Thing /Game/Map.Target") == target);
+}
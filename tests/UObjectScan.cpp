@@ -0,0 +1,257 @@
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstring>
+
+#include <sdk/UObject.hpp>
+#include <sdk/UObjectScan.hpp>
+
+#include "Test.hpp"
+#include "SdkFakes.hpp"
+
+using namespace sdk;
+
+namespace {
+// GUObjectArray laid out in memory the way each engine version has it, backed by made up objects.
+// Every 7th slot is empty and the objects only have a ClassPrivate, which alternates between two classes
+class FakeObjectArray {
+public:
+    enum class Kind {
+        FLAT,
+        CHUNKED, // 4.11+
+        INLINED  // <= 4.10, chunk table inside FUObjectArray itself
+    };
+
+    FakeObjectArray(Kind kind, int32_t count, int32_t item_distance = sizeof(FUObjectItem), std::vector<size_t> missing_chunks = {})
+        : m_count{count},
+        m_objects(count)
+    {
+        FUObjectArray::set_layout(kind == Kind::CHUNKED, kind == Kind::INLINED, item_distance);
+
+        const auto objects_offset = FUObjectArray::get_objects_offset();
+        const auto objects_per_chunk = kind == Kind::INLINED ? FUObjectArray::OBJECTS_PER_CHUNK_INLINED : FUObjectArray::OBJECTS_PER_CHUNK;
+        const auto num_chunks = kind == Kind::FLAT ? 1 : (size_t)(count + objects_per_chunk - 1) / objects_per_chunk;
+        const auto chunk_size = kind == Kind::FLAT ? (size_t)count : (size_t)objects_per_chunk;
+
+        m_header.resize(objects_offset + FUObjectArray::MAX_INLINED_CHUNKS * sizeof(void*) + 0x10);
+        m_chunk_table.resize(num_chunks);
+
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            if (std::find(missing_chunks.begin(), missing_chunks.end(), chunk) != missing_chunks.end()) {
+                continue;
+            }
+
+            m_chunks.emplace_back(std::make_unique<uint8_t[]>(chunk_size * item_distance));
+            memset(m_chunks.back().get(), 0, chunk_size * item_distance);
+            m_chunk_table[chunk] = m_chunks.back().get();
+        }
+
+        for (int32_t i = 0; i < count; ++i) {
+            const auto chunk = (size_t)i / chunk_size;
+            const auto items = (uint8_t*)m_chunk_table[chunk];
+
+            if (items == nullptr) {
+                continue;
+            }
+
+            if (i % 7 != 3) {
+                auto& object = m_objects[i];
+                memcpy(object.data() + UObjectBase::get_class_private_offset(), &m_classes[i & 1], sizeof(void*));
+
+                const auto object_ptr = (void*)object.data();
+                memcpy(items + (i % chunk_size) * item_distance, &object_ptr, sizeof(void*));
+                m_present.push_back(i);
+            }
+        }
+
+        switch (kind) {
+        case Kind::FLAT:
+            write(objects_offset, m_chunk_table[0]);
+            write(objects_offset + 8, count);
+            break;
+        case Kind::CHUNKED:
+            write(objects_offset, (void*)m_chunk_table.data());
+            write(objects_offset + 8 + 8 + 4, count);
+            break;
+        case Kind::INLINED:
+            for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                write(objects_offset + chunk * sizeof(void*), m_chunk_table[chunk]);
+            }
+
+            write(objects_offset + FUObjectArray::MAX_INLINED_CHUNKS * sizeof(void*), count);
+            break;
+        }
+    }
+
+    // The layout is global, put back what FUObjectArray starts out with
+    ~FakeObjectArray() {
+        FUObjectArray::set_layout(false, false, sizeof(FUObjectItem));
+    }
+
+    FUObjectArray* get() {
+        return (FUObjectArray*)m_header.data();
+    }
+
+    UObjectBase* object(int32_t index) {
+        return (UObjectBase*)m_objects[index].data();
+    }
+
+    UClass* get_class(size_t which) {
+        return m_classes[which];
+    }
+
+    // Indices of the slots that have an object, in order
+    const std::vector<int32_t>& present() const {
+        return m_present;
+    }
+
+private:
+    template<typename T>
+    void write(size_t offset, const T& value) {
+        memcpy(m_header.data() + offset, &value, sizeof(T));
+    }
+
+    int32_t m_count{0};
+    std::vector<uint8_t> m_header{};
+    std::vector<void*> m_chunk_table{};
+    std::vector<std::unique_ptr<uint8_t[]>> m_chunks{};
+    std::vector<std::array<uint8_t, 0x40>> m_objects{};
+    std::vector<int32_t> m_present{};
+    std::array<UClass*, 2> m_classes{(UClass*)0x1000, (UClass*)0x2000};
+};
+
+// Every present object visited exactly once with the right index, nothing else
+void check_for_each(FakeObjectArray& array, int32_t count) {
+    std::vector<std::atomic<int32_t>> visits(count);
+    std::atomic<size_t> wrong_object{0};
+
+    UObjectScan::for_each([&](int32_t i, UObjectBase* object) {
+        visits[i].fetch_add(1);
+
+        if (object != array.object(i)) {
+            wrong_object.fetch_add(1);
+        }
+    }, array.get());
+
+    CHECK(wrong_object == 0);
+
+    std::vector<int32_t> expected(count, 0);
+
+    for (const auto i : array.present()) {
+        expected[i] = 1;
+    }
+
+    size_t mismatches = 0;
+
+    for (int32_t i = 0; i < count; ++i) {
+        mismatches += visits[i].load() != expected[i];
+    }
+
+    CHECK(mismatches == 0);
+}
+
+std::vector<UObjectBase*> expected_objects(FakeObjectArray& array, bool (*pred)(int32_t)) {
+    std::vector<UObjectBase*> result{};
+
+    for (const auto i : array.present()) {
+        if (pred(i)) {
+            result.push_back(array.object(i));
+        }
+    }
+
+    return result;
+}
+}
+
+TEST_CASE(uobject_scan_chunked) {
+    // Three chunks, the last one partial, so there are ranges on both sides of every chunk boundary
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK * 2 + 1000;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count};
+
+    check_for_each(array, count);
+
+    const auto all = UObjectScan::find_all([](UObjectBase*) { return true; }, array.get());
+    CHECK(all == expected_objects(array, [](int32_t) { return true; }));
+    CHECK(all.size() == array.present().size());
+}
+
+TEST_CASE(uobject_scan_item_distance) {
+    // Older versions pad FUObjectItem out, the stride has to come from get_item_distance
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK + 5000;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count, 0x20};
+
+    check_for_each(array, count);
+}
+
+TEST_CASE(uobject_scan_missing_chunk) {
+    // A chunk that was never allocated is skipped as a whole instead of read through
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK * 3;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count, sizeof(FUObjectItem), {1}};
+
+    check_for_each(array, count);
+
+    for (const auto i : array.present()) {
+        CHECK(i / FUObjectArray::OBJECTS_PER_CHUNK != 1);
+    }
+}
+
+TEST_CASE(uobject_scan_flat_and_inlined) {
+    {
+        constexpr int32_t count = 40000;
+        FakeObjectArray array{FakeObjectArray::Kind::FLAT, count};
+
+        check_for_each(array, count);
+    }
+
+    {
+        constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK_INLINED * 3 + 10;
+        FakeObjectArray array{FakeObjectArray::Kind::INLINED, count};
+
+        check_for_each(array, count);
+    }
+}
+
+TEST_CASE(uobject_scan_find_first) {
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK * 2;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count};
+
+    // Matches in several ranges, has to be the lowest index no matter which range finishes first
+    const auto first = UObjectScan::find_first([&](UObjectBase* object) {
+        return object == array.object(70001) || object == array.object(90000) || object == array.object(120000);
+    }, array.get());
+
+    CHECK(first == array.object(70001));
+
+    const auto none = UObjectScan::find_first([](UObjectBase*) { return false; }, array.get());
+    CHECK(none == nullptr);
+}
+
+TEST_CASE(uobject_scan_find_instances) {
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK + 100;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count};
+
+    test::get_fake_object_array() = array.get();
+
+    const auto instances = UObjectScan::find_instances_of(array.get_class(1));
+    const auto expected = expected_objects(array, [](int32_t i) { return (i & 1) == 1; });
+
+    CHECK(std::vector<UObjectBase*>(instances.begin(), instances.end()) == expected);
+
+    test::get_fake_object_array() = nullptr;
+}
+
+TEST_CASE(uobject_scan_nested) {
+    // A scan started from inside a scan runs serially on that thread instead of waiting on the busy pool
+    constexpr int32_t count = FUObjectArray::OBJECTS_PER_CHUNK;
+    FakeObjectArray array{FakeObjectArray::Kind::CHUNKED, count};
+
+    std::atomic<size_t> inner_total{0};
+
+    UObjectScan::run_tasks(4, [&](size_t) {
+        inner_total.fetch_add(UObjectScan::find_all([](UObjectBase*) { return true; }, array.get()).size());
+    });
+
+    CHECK(inner_total == array.present().size() * 4);
+}
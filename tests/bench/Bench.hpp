@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+
+// Registers like TEST_CASE, each benchmark prints its own numbers through report()
+namespace bench {
+struct Case {
+    std::string_view name{};
+    void (*fn)(){nullptr};
+};
+
+inline std::vector<Case>& get_cases() {
+    static std::vector<Case> cases{};
+    return cases;
+}
+
+struct Registrar {
+    Registrar(std::string_view name, void (*fn)()) {
+        get_cases().push_back(Case{name, fn});
+    }
+};
+
+// Wall time of fn in nanoseconds
+template<typename Fn>
+double time_ns(Fn&& fn) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline void report(std::string_view what, size_t iterations, double total_ns) {
+    std::printf("    %-40.*s %12zu ops %10.1f ns/op\n", (int)what.size(), what.data(), iterations, total_ns / (double)iterations);
+}
+
+// Keeps the compiler from throwing away a result nothing else uses
+template<typename T>
+void keep(const T& value) {
+#ifdef _MSC_VER
+    static volatile const void* sink{};
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+}
+
+#define BENCHMARK(name) \
+    static void name(); \
+    static bench::Registrar name##_registrar{#name, name}; \
+    static void name()
@@ -0,0 +1,107 @@
+#include <vector>
+#include <string>
+#include <random>
+#include <cstdlib>
+
+#include <sdk/FMallocAllocator.hpp>
+
+#include "Bench.hpp"
+
+using namespace sdk;
+
+namespace {
+constexpr size_t ITERATIONS = 2000000;
+
+// Mixed small sizes like name strings and parameter buffers, allocated and freed a few at a time
+template<typename Allocate, typename Free>
+double churn(const std::vector<size_t>& sizes, Allocate&& allocate, Free&& free) {
+    std::vector<std::pair<void*, size_t>> live(8);
+
+    return bench::time_ns([&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            auto& slot = live[i % live.size()];
+
+            if (slot.first != nullptr) {
+                free(slot.first, slot.second);
+            }
+
+            const auto size = sizes[i % sizes.size()];
+            slot = {allocate(size), size};
+            bench::keep(slot.first);
+        }
+
+        for (auto& slot : live) {
+            free(slot.first, slot.second);
+            slot = {};
+        }
+    });
+}
+}
+
+// The mock GMalloc is the CRT heap, so "FMalloc direct" is the CRT plus a call and what the pool has to beat
+BENCHMARK(fmalloc_pool_vs_crt) {
+    FMalloc mock{};
+    FMalloc::set(&mock);
+
+    std::mt19937 rng{42};
+    std::vector<size_t> sizes(4096);
+
+    for (auto& size : sizes) {
+        size = 8 + rng() % 500;
+    }
+
+    const auto crt_ns = churn(sizes,
+        [](size_t size) { return std::malloc(size); },
+        [](void* p, size_t) { std::free(p); });
+
+    const auto direct_ns = churn(sizes,
+        [](size_t size) { return detail::fmalloc_allocate(size, 16); },
+        [](void* p, size_t) { detail::fmalloc_free(p); });
+
+    const auto pool_ns = churn(sizes,
+        [](size_t size) { return FMallocPool::allocate(size); },
+        [](void* p, size_t size) { FMallocPool::free(p, size); });
+
+    bench::report("CRT malloc/free", ITERATIONS, crt_ns);
+    bench::report("FMalloc direct", ITERATIONS, direct_ns);
+    bench::report("FMallocPool", ITERATIONS, pool_ns);
+
+    const auto stats = FMallocPool::get_stats();
+    std::printf("    pool hit rate %.1f%%\n", 100.0 * (double)stats.hits / (double)(stats.hits + stats.misses));
+
+    FMallocPool::trim();
+    FMalloc::set(nullptr);
+}
+
+BENCHMARK(fmalloc_pool_strings) {
+    FMalloc mock{};
+    FMalloc::set(&mock);
+
+    using PoolString = std::basic_string<wchar_t, std::char_traits<wchar_t>, FMallocPoolAllocator<wchar_t>>;
+    using DirectString = std::basic_string<wchar_t, std::char_traits<wchar_t>, FMallocAllocator<wchar_t>>;
+
+    // What building a full name for every object in a lookup looks like
+    constexpr auto name = L"/Script/Engine.Default__PlayerCameraManager";
+
+    const auto direct_ns = bench::time_ns([&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            DirectString str{name};
+            str += L".Something";
+            bench::keep(str.data());
+        }
+    });
+
+    const auto pool_ns = bench::time_ns([&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            PoolString str{name};
+            str += L".Something";
+            bench::keep(str.data());
+        }
+    });
+
+    bench::report("FMallocAllocator string", ITERATIONS, direct_ns);
+    bench::report("FMallocPoolAllocator string", ITERATIONS, pool_ns);
+
+    FMallocPool::trim();
+    FMalloc::set(nullptr);
+}
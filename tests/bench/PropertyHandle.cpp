@@ -0,0 +1,161 @@
+#include <mutex>
+#include <string>
+#include <vector>
+#include <memory>
+#include <random>
+#include <algorithm>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <sdk/PropertyHandle.hpp>
+
+#include "Bench.hpp"
+
+using namespace sdk;
+
+namespace {
+constexpr size_t NUM_OBJECTS = 10000;
+constexpr size_t NUM_PROPERTIES = 20;
+constexpr size_t OBJECT_SIZE = 0x400;
+
+// Handles normally get their offset from find_property, there's no UStruct to ask here
+template<typename T>
+struct FixedHandle : PropertyHandle<T> {
+    FixedHandle(int32_t offset, uint8_t byte_mask = 0) {
+        this->m_offset = offset;
+        this->m_byte_mask = byte_mask;
+    }
+};
+
+// Same shape as UObject::get_property_data(name): FName::find (a string hash lookup under a shared lock),
+// then a binary search of the class' member snapshot, then the offset. No engine to run the real one against
+class PerCallLookup {
+public:
+    PerCallLookup(const std::vector<std::wstring>& names, const std::vector<int32_t>& offsets) {
+        for (size_t i = 0; i < names.size(); ++i) {
+            const auto index = (int32_t)(i * 7 + 100);
+            m_names[names[i]] = index;
+            m_members.push_back({index, offsets[i]});
+        }
+
+        // Padding so the search has something to do, classes have inherited members too
+        for (int32_t i = 0; i < 200; ++i) {
+            m_members.push_back({100000 + i, 0});
+        }
+
+        std::sort(m_members.begin(), m_members.end());
+    }
+
+    void* get_property_data(const void* object, std::wstring_view name) const {
+        int32_t index{};
+
+        {
+            std::shared_lock _{m_mutex};
+            const auto it = m_names.find(std::wstring{name});
+
+            if (it == m_names.end()) {
+                return nullptr;
+            }
+
+            index = it->second;
+        }
+
+        const auto it = std::lower_bound(m_members.begin(), m_members.end(), std::pair{index, INT32_MIN});
+
+        if (it == m_members.end() || it->first != index) {
+            return nullptr;
+        }
+
+        return (void*)((uintptr_t)object + it->second);
+    }
+
+private:
+    mutable std::shared_mutex m_mutex{};
+    std::unordered_map<std::wstring, int32_t> m_names{};
+    std::vector<std::pair<int32_t, int32_t>> m_members{};
+};
+}
+
+BENCHMARK(property_handle_vs_per_call) {
+    std::mt19937 rng{7};
+
+    // Scattered like real actors, not one neat array
+    std::vector<std::unique_ptr<uint8_t[]>> storage{};
+    std::vector<UObject*> objects{};
+
+    for (size_t i = 0; i < NUM_OBJECTS; ++i) {
+        storage.push_back(std::make_unique<uint8_t[]>(OBJECT_SIZE));
+
+        for (size_t j = 0; j < OBJECT_SIZE; ++j) {
+            storage.back()[j] = (uint8_t)rng();
+        }
+
+        objects.push_back((UObject*)storage.back().get());
+    }
+
+    std::shuffle(objects.begin(), objects.end(), rng);
+
+    std::vector<std::wstring> names{};
+    std::vector<int32_t> offsets{};
+
+    for (size_t i = 0; i < NUM_PROPERTIES; ++i) {
+        names.push_back(L"SomeFloatProperty" + std::to_wstring(i));
+        offsets.push_back((int32_t)(0x30 + i * 0x28));
+    }
+
+    const PerCallLookup lookup{names, offsets};
+
+    std::vector<FixedHandle<float>> handles{};
+
+    for (const auto offset : offsets) {
+        handles.emplace_back(offset);
+    }
+
+    const auto reads = NUM_OBJECTS * NUM_PROPERTIES;
+    double sink = 0.0;
+
+    const auto per_call_ns = bench::time_ns([&] {
+        for (const auto& name : names) {
+            for (const auto object : objects) {
+                sink += *(float*)lookup.get_property_data(object, name);
+            }
+        }
+    });
+
+    const auto single_ns = bench::time_ns([&] {
+        for (const auto& handle : handles) {
+            for (const auto object : objects) {
+                sink += handle.read(object);
+            }
+        }
+    });
+
+    std::vector<float> out(NUM_OBJECTS);
+
+    const auto batch_ns = bench::time_ns([&] {
+        for (const auto& handle : handles) {
+            handle.read(objects, out);
+            sink += out[NUM_OBJECTS / 2];
+        }
+    });
+
+    bench::keep(sink);
+
+    bench::report("get_property_data(name) per read", reads, per_call_ns);
+    bench::report("PropertyHandle::read(object)", reads, single_ns);
+    bench::report("PropertyHandle::read(span)", reads, batch_ns);
+
+    // Bitfield bools go through the mask instead of a plain load
+    const FixedHandle<bool> flag{0x21, 0x04};
+    auto flags = std::make_unique<bool[]>(NUM_OBJECTS);
+
+    const auto bool_ns = bench::time_ns([&] {
+        for (size_t i = 0; i < NUM_PROPERTIES; ++i) {
+            flag.read(objects, std::span{flags.get(), NUM_OBJECTS});
+            bench::keep(flags[i]);
+        }
+    });
+
+    bench::report("PropertyHandle<bool> span, bitfield", reads, bool_ns);
+}
@@ -0,0 +1,75 @@
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include <sdk/common/StringScanner.hpp>
+
+#include "Bench.hpp"
+
+using sdk::common::StringScanner;
+
+// A 32MB synthetic .rdata with ~30 needles, one pass for all of them against one std::search per needle
+BENCHMARK(string_scanner_vs_per_needle) {
+    std::vector<std::string> needles{};
+
+    for (const auto str : {
+        L"NullDrvFailure", L"FTagMetaData", L"FNavigationMetaData", L"SceneDepthZ", L"r.TranslucentSortPolicy",
+        L"bEnableOnScreenDebugMessages", L"PC_InputComponent0", L"emulatestereo", L"UEngine::Tick", L"causeevent=",
+        L"CanvasObject", L"/Temp/%s", L"r.DumpingMovie", L"vr.pixeldensity", L"Current detail mode;",
+        L"r.EnableStereoEmulation", L"Slate.DrawToVRRenderTarget", L"r.OneFrameThreadLag", L"++UE", L"++ue",
+        L"TAutoWeakObjectPtr<%s%s>", L"Commandlet %s finished execution (result %d)",
+    }) {
+        needles.push_back(StringScanner::to_bytes(std::wstring_view{str}));
+    }
+
+    for (const auto str : {"FTagMetaData", "AnimGraphRuntime", "r.DumpingMovie", "Bone: %s", "GameThread", "RenderThread", "RHIThread", "/Script/Engine"}) {
+        needles.push_back(std::string{str});
+    }
+
+    std::mt19937 rng{1234};
+    std::vector<uint8_t> section(32 * 1024 * 1024);
+
+    // Mostly printable and UTF-16 looking, the worst case for a prefix filter
+    for (size_t i = 0; i < section.size(); i += 2) {
+        section[i] = (uint8_t)(0x20 + rng() % 0x5F);
+        section[i + 1] = rng() % 8 == 0 ? (uint8_t)rng() : 0;
+    }
+
+    for (const auto& needle : needles) {
+        const auto offset = rng() % (section.size() - needle.size());
+        std::copy(needle.begin(), needle.end(), section.begin() + offset);
+    }
+
+    StringScanner scanner{};
+
+    for (const auto& needle : needles) {
+        scanner.add(needle);
+    }
+
+    size_t batched = 0;
+    const auto batched_ns = bench::time_ns([&] {
+        scanner.scan(section, [&](size_t, size_t) { ++batched; });
+    });
+
+    size_t separate = 0;
+    const auto separate_ns = bench::time_ns([&] {
+        for (const auto& needle : needles) {
+            const std::boyer_moore_horspool_searcher searcher{needle.begin(), needle.end()};
+
+            for (auto it = section.begin(); (it = std::search(it, section.end(), searcher)) != section.end(); ++it) {
+                ++separate;
+            }
+        }
+    });
+
+    bench::keep(batched);
+    bench::keep(separate);
+
+    const auto mb = (double)section.size() / (1024.0 * 1024.0);
+
+    std::printf("    %zu needles over %.0f MB, %zu/%zu matches\n", needles.size(), mb, batched, separate);
+    std::printf("    %-40s %10.1f ms %8.0f MB/s\n", "StringScanner, one pass", batched_ns / 1e6, mb / (batched_ns / 1e9));
+    std::printf("    %-40s %10.1f ms %8.0f MB/s (of image)\n", "one search per needle", separate_ns / 1e6, mb / (separate_ns / 1e9));
+}
@@ -0,0 +1,112 @@
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+
+#include <sdk/threading/ThreadWorker.hpp>
+
+#include "Bench.hpp"
+
+namespace {
+// What ThreadWorker used to be, for comparison
+template<typename... Args>
+class LockedWorker {
+public:
+    void execute(Args... args) {
+        std::scoped_lock _{m_mutex};
+
+        for (auto& func : m_queue) {
+            func(args...);
+        }
+
+        m_queue.clear();
+    }
+
+    void enqueue(std::function<void(Args...)> func) {
+        std::scoped_lock _{m_mutex};
+        m_queue.push_back(std::move(func));
+    }
+
+private:
+    std::recursive_mutex m_mutex{};
+    std::deque<std::function<void(Args...)>> m_queue{};
+};
+
+// producers threads enqueue per_producer items each while this thread keeps draining, like a game thread would
+template<typename Worker>
+double run(Worker& worker, size_t producers, size_t per_producer) {
+    std::atomic<size_t> executed{0};
+    std::atomic<size_t> done{0};
+
+    return bench::time_ns([&] {
+        std::vector<std::thread> threads{};
+
+        for (size_t p = 0; p < producers; ++p) {
+            threads.emplace_back([&] {
+                for (size_t i = 0; i < per_producer; ++i) {
+                    worker.enqueue([&executed] { executed.fetch_add(1, std::memory_order_relaxed); });
+                }
+
+                ++done;
+            });
+        }
+
+        while (executed.load(std::memory_order_relaxed) < producers * per_producer) {
+            worker.execute();
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+}
+}
+
+BENCHMARK(thread_worker_throughput) {
+    constexpr size_t PER_PRODUCER = 200000;
+
+    for (const size_t producers : {1, 2, 4}) {
+        ThreadWorker<> lock_free{};
+        LockedWorker<> locked{};
+
+        // Once to fill the free list, once for real
+        run(lock_free, producers, PER_PRODUCER);
+        lock_free.reset_stats();
+
+        const auto lock_free_ns = run(lock_free, producers, PER_PRODUCER);
+        const auto locked_ns = run(locked, producers, PER_PRODUCER);
+
+        char label[64]{};
+
+        std::snprintf(label, sizeof(label), "ThreadWorker, %zu producers", producers);
+        bench::report(label, producers * PER_PRODUCER, lock_free_ns);
+
+        std::snprintf(label, sizeof(label), "mutex + deque, %zu producers", producers);
+        bench::report(label, producers * PER_PRODUCER, locked_ns);
+
+        const auto stats = lock_free.get_stats();
+        std::printf("    enqueue -> run latency p50 %llu ns, p99 %llu ns, max %llu ns, deepest drain %lld\n",
+            (unsigned long long)stats.latency.percentile(50), (unsigned long long)stats.latency.percentile(99),
+            (unsigned long long)stats.latency.max, (long long)stats.max_depth);
+    }
+}
+
+BENCHMARK(thread_worker_per_frame) {
+    // One item a "frame", which is where the per-enqueue allocation used to show up
+    constexpr size_t FRAMES = 1000000;
+
+    ThreadWorker<> worker{};
+    size_t counter = 0;
+
+    const auto ns = bench::time_ns([&] {
+        for (size_t i = 0; i < FRAMES; ++i) {
+            worker.enqueue([&counter] { ++counter; });
+            worker.execute();
+        }
+    });
+
+    bench::keep(counter);
+    bench::report("enqueue + execute, same thread", FRAMES, ns);
+}
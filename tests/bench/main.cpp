@@ -0,0 +1,20 @@
+#include <cstdio>
+#include <string_view>
+
+#include "Bench.hpp"
+
+// uesdk_bench [filter], only runs the benchmarks with filter somewhere in their name
+int main(int argc, char** argv) {
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+
+    for (const auto& c : bench::get_cases()) {
+        if (!filter.empty() && c.name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+
+        std::printf("%.*s\n", (int)c.name.size(), c.name.data());
+        c.fn();
+    }
+
+    return 0;
+}
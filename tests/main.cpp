@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <exception>
+#include <string_view>
+
+#include "Test.hpp"
+
+// uesdk_tests [filter], only runs the cases with filter somewhere in their name
+int main(int argc, char** argv) {
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+
+    size_t ran = 0;
+    size_t failed = 0;
+
+    for (const auto& c : test::get_cases()) {
+        if (!filter.empty() && c.name.find(filter) == std::string_view::npos) {
+            continue;
+        }
+
+        std::printf("%.*s\n", (int)c.name.size(), c.name.data());
+
+        const auto failures_before = test::get_failures();
+
+        try {
+            c.fn();
+        } catch (const test::RequireFailed&) {
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "    threw: %s\n", e.what());
+            ++test::get_failures();
+        } catch (...) {
+            std::fprintf(stderr, "    threw something\n");
+            ++test::get_failures();
+        }
+
+        ++ran;
+
+        if (test::get_failures() != failures_before) {
+            ++failed;
+        }
+    }
+
+    std::printf("%zu of %zu cases passed\n", ran - failed, ran);
+    return failed == 0 ? 0 : 1;
+}
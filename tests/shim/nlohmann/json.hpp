@@ -0,0 +1,11 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Only declared, so headers mentioning nlohmann::json (UObject.hpp) build without fetching it.
+// Anything that actually builds JSON can't be tested against this
+namespace nlohmann {
+class json;
+}
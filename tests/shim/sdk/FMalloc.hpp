@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+
+// Stands in for the engine's GMalloc: the CRT heap plus a few counters.
+// Found before the real sdk/FMalloc.hpp, which calls through the engine's vtable
+namespace sdk {
+class FMalloc {
+public:
+    static FMalloc* get() {
+        return s_current;
+    }
+
+    // nullptr is GMalloc not having been found
+    static void set(FMalloc* malloc) {
+        s_current = malloc;
+    }
+
+    virtual ~FMalloc() {}
+
+    void* malloc(size_t size, uint32_t alignment = 0) {
+        ++mallocs;
+        last_size = size;
+        last_alignment = alignment;
+
+        const size_t align = alignment > 16 ? alignment : 16;
+
+#ifdef _WIN32
+        return _aligned_malloc(size != 0 ? size : 1, align);
+#else
+        void* result{};
+        return posix_memalign(&result, align, size != 0 ? size : 1) == 0 ? result : nullptr;
+#endif
+    }
+
+    void* realloc(void* original, size_t size, uint32_t alignment = 0) {
+        if (original == nullptr) {
+            return malloc(size, alignment);
+        }
+
+        ++reallocs;
+        last_size = size;
+        last_alignment = alignment;
+
+        // std::realloc only keeps malloc's own alignment, which is 16
+#ifdef _WIN32
+        return _aligned_realloc(original, size != 0 ? size : 1, alignment > 16 ? alignment : 16);
+#else
+        return alignment > 16 ? nullptr : std::realloc(original, size != 0 ? size : 1);
+#endif
+    }
+
+    void free(void* original) {
+        if (original == nullptr) {
+            return;
+        }
+
+        ++frees;
+
+#ifdef _WIN32
+        _aligned_free(original);
+#else
+        std::free(original);
+#endif
+    }
+
+    std::atomic<size_t> mallocs{0};
+    std::atomic<size_t> reallocs{0};
+    std::atomic<size_t> frees{0};
+    std::atomic<size_t> last_size{0};
+    std::atomic<uint32_t> last_alignment{0};
+
+private:
+    static inline std::atomic<FMalloc*> s_current{nullptr};
+};
+}
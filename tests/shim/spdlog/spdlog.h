@@ -0,0 +1,15 @@
+#pragma once
+
+// Logging is just noise in the tests, the SDK sources that log get these instead.
+// The arguments still get used so whatever only exists to be logged doesn't warn
+namespace spdlog_shim {
+template<typename... Args>
+inline void discard(const Args&...) {}
+}
+
+#define SPDLOG_TRACE(...) ::spdlog_shim::discard(__VA_ARGS__)
+#define SPDLOG_DEBUG(...) ::spdlog_shim::discard(__VA_ARGS__)
+#define SPDLOG_INFO(...) ::spdlog_shim::discard(__VA_ARGS__)
+#define SPDLOG_WARN(...) ::spdlog_shim::discard(__VA_ARGS__)
+#define SPDLOG_ERROR(...) ::spdlog_shim::discard(__VA_ARGS__)
+#define SPDLOG_CRITICAL(...) ::spdlog_shim::discard(__VA_ARGS__)
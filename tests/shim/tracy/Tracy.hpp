@@ -0,0 +1,7 @@
+#pragma once
+
+// What <tracy/Tracy.hpp> boils down to with TRACY_ENABLE off, so the headers that use it build without fetching Tracy
+#define ZoneScoped
+#define ZoneScopedN(name)
+#define FrameMark
+#define TracyPlot(name, value)